@@ -29,6 +29,7 @@ QUANTUM_SRC += \
     $(QUANTUM_DIR)/logging/debug.c \
     $(QUANTUM_DIR)/logging/sendchar.c \
     $(QUANTUM_DIR)/process_keycode/process_default_layer.c \
+    $(QUANTUM_DIR)/process_keycode/process_dispatch.c \
 
 VPATH += $(QUANTUM_DIR)/logging
 # Fall back to lib/printf if there is no platform provided print
@@ -131,6 +132,8 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         VPATH += $(QUANTUM_DIR)/pointing_device
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_auto_mouse.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_hires.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_gestures.c
         ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
             SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
             OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
@@ -147,12 +150,10 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
             I2C_DRIVER_REQUIRED = yes
             SRC += drivers/sensors/cirque_pinnacle.c
             SRC += drivers/sensors/cirque_pinnacle_gestures.c
-            SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_gestures.c
         else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), cirque_pinnacle_spi)
             SPI_DRIVER_REQUIRED = yes
             SRC += drivers/sensors/cirque_pinnacle.c
             SRC += drivers/sensors/cirque_pinnacle_gestures.c
-            SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_gestures.c
         else ifeq ($(strip $(POINTING_DEVICE_DRIVER)), pimoroni_trackball)
             I2C_DRIVER_REQUIRED = yes
         else ifneq ($(filter $(strip $(POINTING_DEVICE_DRIVER)),pmw3360 pmw3389),)
@@ -635,7 +636,7 @@ ifeq ($(strip $(VIA_ENABLE)), yes)
     TRI_LAYER_ENABLE := yes
 endif
 
-VALID_CUSTOM_MATRIX_TYPES:= yes lite no
+VALID_CUSTOM_MATRIX_TYPES:= yes lite analog no
 
 CUSTOM_MATRIX ?= no
 ifneq ($(strip $(CUSTOM_MATRIX)), yes)
@@ -646,8 +647,16 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     # Include common stuff for all non custom matrix users
     QUANTUM_SRC += $(QUANTUM_DIR)/matrix_common.c
 
-    # if 'lite' then skip the actual matrix implementation
-    ifneq ($(strip $(CUSTOM_MATRIX)), lite)
+    ifeq ($(strip $(CUSTOM_MATRIX)), analog)
+        # Analog keys are scanned through the 'lite' hooks, and debounced by their own hysteresis
+        OPT_DEFS += -DANALOG_MATRIX_ENABLE
+        COMMON_VPATH += $(QUANTUM_DIR)/analog_matrix
+        QUANTUM_SRC += $(QUANTUM_DIR)/analog_matrix/analog_key.c
+        QUANTUM_SRC += $(QUANTUM_DIR)/analog_matrix/analog_matrix.c
+        ANALOG_DRIVER_REQUIRED = yes
+        DEBOUNCE_TYPE ?= none
+    else ifneq ($(strip $(CUSTOM_MATRIX)), lite)
+        # if 'lite' then skip the actual matrix implementation
         # Include the standard or split matrix code if needed
         QUANTUM_SRC += $(QUANTUM_DIR)/matrix.c
     endif
@@ -832,6 +841,7 @@ ifeq ($(strip $(PS2_ENABLE)), yes)
     endif
 
     SRC += ps2_$(strip $(PS2_DRIVER)).c
+    SRC += ps2_stream.c
 endif
 
 JOYSTICK_ENABLE ?= no
@@ -165,6 +165,12 @@ uint32_t oled_scroll_timeout;
 #if OLED_UPDATE_INTERVAL > 0
 uint16_t oled_update_timeout;
 #endif
+#ifdef OLED_SHADOW_BUFFER
+// Copy of what the panel's memory currently holds, so that only changed bytes need to be sent.
+// Blocks flagged as stale may not match the panel, and are always sent in full.
+static uint8_t         oled_shadow[OLED_MATRIX_SIZE];
+static OLED_BLOCK_TYPE oled_shadow_stale = OLED_ALL_BLOCKS_MASK;
+#endif
 
 #if defined(OLED_TRANSPORT_SPI)
 #    ifndef OLED_DC_PIN
@@ -274,15 +280,6 @@ __attribute__((weak)) void oled_driver_init(void) {
 #endif
 }
 
-// Flips the rendering bits for a character at the current cursor position
-static void InvertCharacter(uint8_t *cursor) {
-    const uint8_t *end = cursor + OLED_FONT_WIDTH;
-    while (cursor < end) {
-        *cursor = ~(*cursor);
-        cursor++;
-    }
-}
-
 bool oled_init(oled_rotation_t rotation) {
 #if defined(USE_I2C) && defined(SPLIT_KEYBOARD) && defined(OLED_TRANSPORT_I2C)
     if (!is_keyboard_master()) {
@@ -363,6 +360,9 @@ bool oled_init(oled_rotation_t rotation) {
 #endif
 
     oled_clear();
+#ifdef OLED_SHADOW_BUFFER
+    oled_shadow_stale = OLED_ALL_BLOCKS_MASK;
+#endif
     oled_initialized = true;
     oled_active      = true;
     oled_scrolling   = false;
@@ -446,6 +446,58 @@ static void rotate_90(const uint8_t *src, uint8_t *dest) {
     }
 }
 
+#ifdef OLED_SHADOW_BUFFER
+// Sends only the columns of each page within the block that differ from what the panel currently holds
+static bool render_block_diff(uint8_t block) {
+    const bool stale = oled_shadow_stale & ((OLED_BLOCK_TYPE)1 << block);
+    uint16_t   start = OLED_BLOCK_SIZE * block;
+    uint16_t   end   = start + OLED_BLOCK_SIZE;
+
+    while (start < end) {
+        // Each page is addressed separately, so work out the changed column range one page at a time
+        uint16_t page_end = (start / OLED_DISPLAY_WIDTH + 1) * OLED_DISPLAY_WIDTH;
+        if (page_end > end) {
+            page_end = end;
+        }
+
+        uint16_t first = start;
+        uint16_t last  = page_end;
+        if (!stale) {
+            while (first < last && oled_buffer[first] == oled_shadow[first]) {
+                ++first;
+            }
+            while (last > first && oled_buffer[last - 1] == oled_shadow[last - 1]) {
+                --last;
+            }
+        }
+
+        if (first < last) {
+            uint8_t page   = first / OLED_DISPLAY_WIDTH;
+            uint8_t column = first % OLED_DISPLAY_WIDTH + OLED_COLUMN_OFFSET;
+#    if OLED_IC_HAS_HORIZONTAL_MODE
+            uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, column, column + (last - first) - 1, PAGE_ADDR, page, page};
+#    else
+            uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR | page, PAM_SETCOLUMN_LSB | (column & 0x0f), PAM_SETCOLUMN_MSB | (column >> 4 & 0x0f)};
+#    endif
+            if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+                print("oled_render offset command failed\n");
+                return false;
+            }
+            if (!oled_send_data(&oled_buffer[first], last - first)) {
+                print("oled_render data failed\n");
+                return false;
+            }
+            memcpy(&oled_shadow[first], &oled_buffer[first], last - first);
+        }
+
+        start = page_end;
+    }
+
+    oled_shadow_stale &= ~((OLED_BLOCK_TYPE)1 << block);
+    return true;
+}
+#endif
+
 void oled_render_dirty(bool all) {
     // Do we have work to do?
     oled_dirty &= OLED_ALL_BLOCKS_MASK;
@@ -464,6 +516,22 @@ void oled_render_dirty(bool all) {
             ++update_start;
         }
 
+#ifdef OLED_SHADOW_BUFFER
+        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+            if (!render_block_diff(update_start)) {
+                return;
+            }
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+            continue;
+        }
+
+        // Rotated blocks are sent whole, but can still be skipped if the panel already holds them
+        if (!(oled_shadow_stale & ((OLED_BLOCK_TYPE)1 << update_start)) && !memcmp(&oled_shadow[OLED_BLOCK_SIZE * update_start], &oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+            continue;
+        }
+#endif
+
         // Set column & page position
 #if OLED_IC_HAS_HORIZONTAL_MODE
         static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
@@ -527,6 +595,11 @@ void oled_render_dirty(bool all) {
 #endif
         }
 
+#ifdef OLED_SHADOW_BUFFER
+        memcpy(&oled_shadow[OLED_BLOCK_SIZE * update_start], &oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE);
+        oled_shadow_stale &= ~((OLED_BLOCK_TYPE)1 << update_start);
+#endif
+
         // Clear dirty flag of just rendered block
         oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
     }
@@ -597,28 +670,23 @@ void oled_write_char(const char data, bool invert) {
         return;
     }
 
-    // copy the current render buffer to check for dirty after
-    static uint8_t oled_temp_buffer[OLED_FONT_WIDTH];
-    memcpy(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH);
-
     _Static_assert(sizeof(font) >= ((OLED_FONT_END + 1 - OLED_FONT_START) * OLED_FONT_WIDTH), "OLED_FONT_END references outside array");
 
-    // set the reder buffer data
-    uint8_t cast_data = (uint8_t)data; // font based on unsigned type for index
-    if (cast_data < OLED_FONT_START || cast_data > OLED_FONT_END) {
-        memset(oled_cursor, 0x00, OLED_FONT_WIDTH);
-    } else {
-        const uint8_t *glyph = &font[(cast_data - OLED_FONT_START) * OLED_FONT_WIDTH];
-        memcpy_P(oled_cursor, glyph, OLED_FONT_WIDTH);
-    }
-
-    // Invert if needed
-    if (invert) {
-        InvertCharacter(oled_cursor);
+    // set the render buffer data, comparing against the existing contents as we go
+    uint8_t        cast_data = (uint8_t)data; // font based on unsigned type for index
+    const uint8_t *glyph     = (cast_data < OLED_FONT_START || cast_data > OLED_FONT_END) ? NULL : &font[(cast_data - OLED_FONT_START) * OLED_FONT_WIDTH];
+    const uint8_t  mask      = invert ? 0xFF : 0x00;
+    bool           changed   = false;
+    for (uint8_t i = 0; i < OLED_FONT_WIDTH; i++) {
+        uint8_t column = (glyph ? pgm_read_byte(&glyph[i]) : 0x00) ^ mask;
+        if (oled_cursor[i] != column) {
+            oled_cursor[i] = column;
+            changed        = true;
+        }
     }
 
     // Dirty check
-    if (memcmp(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH)) {
+    if (changed) {
         uint16_t index = oled_cursor - &oled_buffer[0];
         oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
         // Edgecase check if the written data spans the 2 chunks
@@ -878,6 +946,10 @@ bool oled_scroll_off(void) {
         }
         oled_scrolling = false;
         oled_dirty     = OLED_ALL_BLOCKS_MASK;
+#ifdef OLED_SHADOW_BUFFER
+        // Scrolling moves the panel's memory contents around
+        oled_shadow_stale = OLED_ALL_BLOCKS_MASK;
+#endif
     }
     return !oled_scrolling;
 }
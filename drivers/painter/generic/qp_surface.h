@@ -21,6 +21,28 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef TILED_SURFACE_NUM_DEVICES
+/**
+ * @def This controls the maximum number of tiled surface devices that Quantum Painter can use at any one time.
+ *      Each requires its own band buffer as well as storage for its display list.
+ */
+#    define TILED_SURFACE_NUM_DEVICES 1
+#endif
+
+#ifndef TILED_SURFACE_MAX_OPS
+/**
+ * @def This controls the maximum number of draw operations which can be recorded in a tiled surface's display list.
+ */
+#    define TILED_SURFACE_MAX_OPS 32
+#endif
+
+#ifndef TILED_SURFACE_MAX_BANDS
+/**
+ * @def This controls the maximum number of bands a tiled surface can be split into, i.e. `ceil(panel_height / band_height)`.
+ */
+#    define TILED_SURFACE_MAX_BANDS 32
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -64,4 +86,80 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
  */
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
 
+/**
+ * Factory method for a tiled RGB565 surface.
+ *
+ * Tiled surfaces only hold a horizontal band of the panel in RAM at any one time. Drawing is recorded into a display
+ * list using the `qp_tiled_surface_?????` APIs below, which is replayed into each band in turn when drawing to the
+ * target device.
+ *
+ * @param panel_width[in] the width of the display panel
+ * @param panel_height[in] the height of the display panel
+ * @param band_height[in] the number of rows rendered at a time
+ * @param buffer[in] pointer to a preallocated uint8_t buffer of size `SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, band_height, 16)`
+ * @return the device handle used with the tiled surface APIs
+ */
+painter_device_t qp_make_rgb565_tiled_surface(uint16_t panel_width, uint16_t panel_height, uint16_t band_height, void *buffer);
+
+/**
+ * Clears the display list of a tiled surface, so that the next scene can be recorded.
+ *
+ * @param surface[in] the tiled surface
+ * @return whether the display list was cleared
+ */
+bool qp_tiled_surface_reset(painter_device_t surface);
+
+/**
+ * Records a `qp_rect()` into the display list of a tiled surface. Parameters match `qp_rect()`.
+ *
+ * @return whether there was space in the display list
+ */
+bool qp_tiled_surface_rect(painter_device_t surface, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Records a `qp_line()` into the display list of a tiled surface. Parameters match `qp_line()`.
+ *
+ * @return whether there was space in the display list
+ */
+bool qp_tiled_surface_line(painter_device_t surface, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val);
+
+/**
+ * Records a `qp_circle()` into the display list of a tiled surface. Parameters match `qp_circle()`.
+ *
+ * @return whether there was space in the display list
+ */
+bool qp_tiled_surface_circle(painter_device_t surface, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
+
+/**
+ * Records a `qp_drawimage_recolor()` into the display list of a tiled surface. Parameters match `qp_drawimage_recolor()`.
+ *
+ * The image must remain loaded until the tiled surface has been drawn.
+ *
+ * @return whether there was space in the display list
+ */
+bool qp_tiled_surface_drawimage_recolor(painter_device_t surface, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+/**
+ * Records a `qp_drawtext_recolor()` into the display list of a tiled surface. Parameters match `qp_drawtext_recolor()`.
+ *
+ * The font must remain loaded, and the string must remain valid, until the tiled surface has been drawn.
+ *
+ * @return whether there was space in the display list
+ */
+bool qp_tiled_surface_drawtext_recolor(painter_device_t surface, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+/**
+ * Renders the display list of a tiled surface band by band, sending each band to the target device.
+ *
+ * Bands whose contents are unchanged since the previous draw are skipped.
+ *
+ * @param surface[in] the tiled surface to render
+ * @param target[in] the target device to draw into
+ * @param x[in] the x-location of the surface on the target
+ * @param y[in] the y-location of the surface on the target
+ * @param entire_surface[in] whether every band should be sent, regardless of whether it changed
+ * @return whether the draw operation completed successfully
+ */
+bool qp_tiled_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
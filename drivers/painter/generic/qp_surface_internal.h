@@ -4,6 +4,7 @@
 
 #ifdef QUANTUM_PAINTER_SURFACE_ENABLE
 
+#    include "color.h"
 #    include "qp_surface.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,6 +55,66 @@ typedef struct surface_painter_device_t {
     surface_dirty_data_t dirty;
 } surface_painter_device_t;
 
+// Tiled surface display list
+typedef enum qp_tiled_surface_op_type_t {
+    TILED_SURFACE_OP_RECT,
+    TILED_SURFACE_OP_LINE,
+    TILED_SURFACE_OP_CIRCLE,
+    TILED_SURFACE_OP_IMAGE,
+    TILED_SURFACE_OP_TEXT,
+} qp_tiled_surface_op_type_t;
+
+typedef struct qp_tiled_surface_op_t {
+    qp_tiled_surface_op_type_t type;
+
+    // Bounding box of the operation, used to skip it for bands it doesn't touch
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+
+    // Operation-specific parameters
+    union {
+        struct {
+            uint16_t x0;
+            uint16_t y0;
+            uint16_t x1;
+            uint16_t y1;
+            uint16_t radius;
+            hsv_t    color;
+            bool     filled;
+        } shape;
+        struct {
+            uint16_t x;
+            uint16_t y;
+            union {
+                painter_image_handle_t image;
+                painter_font_handle_t  font;
+            };
+            const char *str;
+            hsv_t       fg;
+            hsv_t       bg;
+        } asset;
+    };
+} qp_tiled_surface_op_t;
+
+// Tiled surface struct
+typedef struct tiled_surface_painter_device_t {
+    surface_painter_device_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    // The band currently being rendered
+    uint16_t band_height;
+    uint16_t band_top;
+
+    // The recorded display list
+    uint16_t              op_count;
+    qp_tiled_surface_op_t ops[TILED_SURFACE_MAX_OPS];
+
+    // Hash of each band's contents when it was last sent to the target, so unchanged bands can be skipped
+    bool     band_hash_valid;
+    uint32_t band_hash[TILED_SURFACE_MAX_BANDS];
+} tiled_surface_painter_device_t;
+
 /**
  * Factory method for an RGB565 surface (aka framebuffer). Accepts an external device table.
  *
@@ -90,6 +151,11 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
 
+// RGB565 pixel format helpers, shared with the tiled surface
+bool qp_surface_palette_convert_rgb565_swapped(painter_device_t device, int16_t palette_size, qp_pixel_t *palette);
+bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices);
+bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
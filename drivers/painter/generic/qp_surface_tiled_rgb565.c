@@ -0,0 +1,320 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+
+#    include "color.h"
+#    include "qp_draw.h"
+#    include "qp_surface_internal.h"
+#    include "qp_comms_dummy.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Driver storage
+
+static tiled_surface_painter_device_t tiled_surface_drivers[TILED_SURFACE_NUM_DEVICES] = {0};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tiled surface driver impl: rgb565
+//
+// The tiled surface only holds the rows [band_top, band_top + band_height) in RAM. The normal Quantum Painter drawing
+// routines write to it as if it were a full-size surface, and anything outside the current band is discarded.
+
+static inline uint16_t tiled_band_rows(tiled_surface_painter_device_t *tiled) {
+    uint16_t remaining = tiled->base.base.panel_height - tiled->band_top;
+    return remaining < tiled->band_height ? remaining : tiled->band_height;
+}
+
+static inline void append_pixel_tiled_rgb565(tiled_surface_painter_device_t *tiled, uint16_t rgb565) {
+    surface_painter_device_t *surface = &tiled->base;
+    uint16_t                  x       = surface->viewport.pixdata_x;
+    uint16_t                  y       = surface->viewport.pixdata_y;
+
+    // Only keep the pixel if it lands within the current band
+    if (x < surface->base.panel_width && y >= tiled->band_top && (y - tiled->band_top) < tiled->band_height) {
+        surface->u16buffer[(y - tiled->band_top) * surface->base.panel_width + x] = rgb565;
+    }
+
+    qp_surface_increment_pixdata_location(&surface->viewport);
+}
+
+static bool qp_tiled_surface_pixdata_rgb565(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    tiled_surface_painter_device_t *tiled = (tiled_surface_painter_device_t *)device;
+    const uint16_t                 *data  = (const uint16_t *)pixel_data;
+    for (uint32_t pixel_counter = 0; pixel_counter < native_pixel_count; ++pixel_counter) {
+        append_pixel_tiled_rgb565(tiled, data[pixel_counter]);
+    }
+    return true;
+}
+
+static bool qp_tiled_surface_init(painter_device_t device, painter_rotation_t rotation) {
+    tiled_surface_painter_device_t *tiled = (tiled_surface_painter_device_t *)device;
+    memset(tiled->base.buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(tiled->base.base.panel_width, tiled->band_height, 16));
+    tiled->band_top        = 0;
+    tiled->op_count        = 0;
+    tiled->band_hash_valid = false;
+    return true;
+}
+
+static bool qp_tiled_surface_flush(painter_device_t device) {
+    // No-op, the display list is only rendered by qp_tiled_surface_draw().
+    return true;
+}
+
+const painter_driver_vtable_t rgb565_tiled_surface_driver_vtable = {
+    .init            = qp_tiled_surface_init,
+    .power           = qp_surface_power,
+    .clear           = qp_surface_clear,
+    .flush           = qp_tiled_surface_flush,
+    .pixdata         = qp_tiled_surface_pixdata_rgb565,
+    .viewport        = qp_surface_viewport,
+    .palette_convert = qp_surface_palette_convert_rgb565_swapped,
+    .append_pixels   = qp_surface_append_pixels_rgb565,
+    .append_pixdata  = qp_surface_append_pixdata_rgb565,
+};
+
+painter_device_t qp_make_rgb565_tiled_surface(uint16_t panel_width, uint16_t panel_height, uint16_t band_height, void *buffer) {
+    if (band_height == 0 || ((panel_height + band_height - 1) / band_height) > TILED_SURFACE_MAX_BANDS) {
+        qp_dprintf("qp_make_rgb565_tiled_surface: fail (band height %d invalid for panel height %d)\n", (int)band_height, (int)panel_height);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < TILED_SURFACE_NUM_DEVICES; ++i) {
+        tiled_surface_painter_device_t *tiled  = &tiled_surface_drivers[i];
+        painter_driver_t               *driver = &tiled->base.base;
+        if (!driver->driver_vtable) {
+            driver->driver_vtable         = &rgb565_tiled_surface_driver_vtable;
+            driver->native_bits_per_pixel = 16;
+            driver->comms_vtable          = &dummy_comms_vtable;
+            driver->panel_width           = panel_width;
+            driver->panel_height          = panel_height;
+            driver->rotation              = QP_ROTATION_0;
+            driver->offset_x              = 0;
+            driver->offset_y              = 0;
+            tiled->base.buffer            = buffer;
+            tiled->band_height            = band_height;
+            return (painter_device_t)tiled;
+        }
+    }
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Display list recording
+
+static tiled_surface_painter_device_t *tiled_surface_validate(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok || driver->driver_vtable != &rgb565_tiled_surface_driver_vtable) {
+        qp_dprintf("tiled surface: fail (invalid device)\n");
+        return NULL;
+    }
+    return (tiled_surface_painter_device_t *)device;
+}
+
+static qp_tiled_surface_op_t *tiled_surface_append_op(painter_device_t device, qp_tiled_surface_op_type_t type, int32_t l, int32_t t, int32_t r, int32_t b) {
+    tiled_surface_painter_device_t *tiled = tiled_surface_validate(device);
+    if (!tiled) {
+        return NULL;
+    }
+
+    if (tiled->op_count >= TILED_SURFACE_MAX_OPS) {
+        qp_dprintf("tiled surface: fail (display list full, increase TILED_SURFACE_MAX_OPS)\n");
+        return NULL;
+    }
+
+    qp_tiled_surface_op_t *op = &tiled->ops[tiled->op_count++];
+    op->type                  = type;
+    op->l                     = l < 0 ? 0 : (l > UINT16_MAX ? UINT16_MAX : l);
+    op->t                     = t < 0 ? 0 : (t > UINT16_MAX ? UINT16_MAX : t);
+    op->r                     = r < 0 ? 0 : (r > UINT16_MAX ? UINT16_MAX : r);
+    op->b                     = b < 0 ? 0 : (b > UINT16_MAX ? UINT16_MAX : b);
+    return op;
+}
+
+bool qp_tiled_surface_reset(painter_device_t device) {
+    tiled_surface_painter_device_t *tiled = tiled_surface_validate(device);
+    if (!tiled) {
+        return false;
+    }
+    tiled->op_count = 0;
+    return true;
+}
+
+bool qp_tiled_surface_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    qp_tiled_surface_op_t *op = tiled_surface_append_op(device, TILED_SURFACE_OP_RECT, QP_MIN(left, right), QP_MIN(top, bottom), QP_MAX(left, right), QP_MAX(top, bottom));
+    if (!op) {
+        return false;
+    }
+    op->shape.x0     = left;
+    op->shape.y0     = top;
+    op->shape.x1     = right;
+    op->shape.y1     = bottom;
+    op->shape.color  = (hsv_t){hue, sat, val};
+    op->shape.filled = filled;
+    return true;
+}
+
+bool qp_tiled_surface_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val) {
+    qp_tiled_surface_op_t *op = tiled_surface_append_op(device, TILED_SURFACE_OP_LINE, QP_MIN(x0, x1), QP_MIN(y0, y1), QP_MAX(x0, x1), QP_MAX(y0, y1));
+    if (!op) {
+        return false;
+    }
+    op->shape.x0    = x0;
+    op->shape.y0    = y0;
+    op->shape.x1    = x1;
+    op->shape.y1    = y1;
+    op->shape.color = (hsv_t){hue, sat, val};
+    return true;
+}
+
+bool qp_tiled_surface_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
+    qp_tiled_surface_op_t *op = tiled_surface_append_op(device, TILED_SURFACE_OP_CIRCLE, (int32_t)x - radius, (int32_t)y - radius, (int32_t)x + radius, (int32_t)y + radius);
+    if (!op) {
+        return false;
+    }
+    op->shape.x0     = x;
+    op->shape.y0     = y;
+    op->shape.radius = radius;
+    op->shape.color  = (hsv_t){hue, sat, val};
+    op->shape.filled = filled;
+    return true;
+}
+
+bool qp_tiled_surface_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    if (!image) {
+        return false;
+    }
+    qp_tiled_surface_op_t *op = tiled_surface_append_op(device, TILED_SURFACE_OP_IMAGE, x, y, (int32_t)x + image->width - 1, (int32_t)y + image->height - 1);
+    if (!op) {
+        return false;
+    }
+    op->asset.x     = x;
+    op->asset.y     = y;
+    op->asset.image = image;
+    op->asset.fg    = (hsv_t){hue_fg, sat_fg, val_fg};
+    op->asset.bg    = (hsv_t){hue_bg, sat_bg, val_bg};
+    return true;
+}
+
+bool qp_tiled_surface_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    if (!font || !str) {
+        return false;
+    }
+    int16_t width = qp_textwidth(font, str);
+    if (width <= 0) {
+        return width == 0;
+    }
+    qp_tiled_surface_op_t *op = tiled_surface_append_op(device, TILED_SURFACE_OP_TEXT, x, y, (int32_t)x + width - 1, (int32_t)y + font->line_height - 1);
+    if (!op) {
+        return false;
+    }
+    op->asset.x    = x;
+    op->asset.y    = y;
+    op->asset.font = font;
+    op->asset.str  = str;
+    op->asset.fg   = (hsv_t){hue_fg, sat_fg, val_fg};
+    op->asset.bg   = (hsv_t){hue_bg, sat_bg, val_bg};
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Band rendering
+
+static bool tiled_surface_replay_op(painter_device_t device, qp_tiled_surface_op_t *op) {
+    switch (op->type) {
+        case TILED_SURFACE_OP_RECT:
+            return qp_rect(device, op->shape.x0, op->shape.y0, op->shape.x1, op->shape.y1, op->shape.color.h, op->shape.color.s, op->shape.color.v, op->shape.filled);
+        case TILED_SURFACE_OP_LINE:
+            return qp_line(device, op->shape.x0, op->shape.y0, op->shape.x1, op->shape.y1, op->shape.color.h, op->shape.color.s, op->shape.color.v);
+        case TILED_SURFACE_OP_CIRCLE:
+            return qp_circle(device, op->shape.x0, op->shape.y0, op->shape.radius, op->shape.color.h, op->shape.color.s, op->shape.color.v, op->shape.filled);
+        case TILED_SURFACE_OP_IMAGE:
+            return qp_drawimage_recolor(device, op->asset.x, op->asset.y, op->asset.image, op->asset.fg.h, op->asset.fg.s, op->asset.fg.v, op->asset.bg.h, op->asset.bg.s, op->asset.bg.v);
+        case TILED_SURFACE_OP_TEXT:
+            return qp_drawtext_recolor(device, op->asset.x, op->asset.y, op->asset.font, op->asset.str, op->asset.fg.h, op->asset.fg.s, op->asset.fg.v, op->asset.bg.h, op->asset.bg.s, op->asset.bg.v) >= 0;
+    }
+    return false;
+}
+
+static uint32_t tiled_surface_band_hash(const uint8_t *data, uint32_t length) {
+    // 32-bit FNV-1a
+    uint32_t hash = 0x811C9DC5;
+    for (uint32_t i = 0; i < length; ++i) {
+        hash ^= data[i];
+        hash *= 0x01000193;
+    }
+    return hash;
+}
+
+static bool tiled_surface_render_band(tiled_surface_painter_device_t *tiled, uint16_t band_top) {
+    painter_device_t device = (painter_device_t)tiled;
+    uint16_t         width  = tiled->base.base.panel_width;
+
+    tiled->band_top = band_top;
+    uint16_t band_b = band_top + tiled_band_rows(tiled) - 1;
+
+    // Start off with a blank band
+    memset(tiled->base.buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(width, tiled->band_height, 16));
+
+    // Replay each operation which touches this band, in the order they were recorded, so later operations are layered over earlier ones
+    for (uint16_t i = 0; i < tiled->op_count; ++i) {
+        qp_tiled_surface_op_t *op = &tiled->ops[i];
+        if (op->b < band_top || op->t > band_b) {
+            continue;
+        }
+        if (!tiled_surface_replay_op(device, op)) {
+            qp_dprintf("qp_tiled_surface_draw: fail (could not replay op %d)\n", (int)i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool qp_tiled_surface_draw(painter_device_t device, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface) {
+    tiled_surface_painter_device_t *tiled         = tiled_surface_validate(device);
+    painter_driver_t               *target_driver = (painter_driver_t *)target;
+    if (!tiled || !target_driver) {
+        qp_dprintf("qp_tiled_surface_draw: fail (invalid device)\n");
+        return false;
+    }
+
+    // If we have incompatible bit depths, drop out
+    if (target_driver->native_bits_per_pixel != 16) {
+        qp_dprintf("qp_tiled_surface_draw: fail (incompatible bpp: surface=16, target=%d)\n", (int)target_driver->native_bits_per_pixel);
+        return false;
+    }
+
+    uint16_t width  = tiled->base.base.panel_width;
+    uint16_t height = tiled->base.base.panel_height;
+    for (uint16_t band = 0, band_top = 0; band_top < height; ++band, band_top += tiled->band_height) {
+        if (!tiled_surface_render_band(tiled, band_top)) {
+            return false;
+        }
+
+        // Skip sending anything if the band is identical to what was previously sent
+        uint16_t rows = tiled_band_rows(tiled);
+        uint32_t hash = tiled_surface_band_hash(tiled->base.u8buffer, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(width, rows, 16));
+        if (!entire_surface && tiled->band_hash_valid && tiled->band_hash[band] == hash) {
+            continue;
+        }
+        tiled->band_hash[band] = hash;
+
+        // The band buffer is already in the panel's native format, so it can be sent as-is
+        if (!qp_viewport(target, x, y + band_top, x + width - 1, y + band_top + rows - 1)) {
+            qp_dprintf("qp_tiled_surface_draw: fail (could not set target viewport)\n");
+            tiled->band_hash_valid = false;
+            return false;
+        }
+        if (!qp_pixdata(target, tiled->base.buffer, (uint32_t)width * rows)) {
+            qp_dprintf("qp_tiled_surface_draw: fail (could not stream pixdata to target)\n");
+            tiled->band_hash_valid = false;
+            return false;
+        }
+    }
+
+    tiled->band_hash_valid = true;
+    qp_dprintf("qp_tiled_surface_draw: ok\n");
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -91,6 +91,12 @@ uint8_t ps2_host_recv(void);
 void    ps2_host_set_led(uint8_t usb_led);
 bool    pbuf_has_data(void);
 
+#ifdef PS2_DRIVER_INTERRUPT
+bool ps2_host_transmit(uint8_t data);
+bool ps2_host_recv_nowait(uint8_t *data);
+bool ps2_host_recv_overflow(void);
+#endif
+
 /*--------------------------------------------------------------------
  * static functions
  *------------------------------------------------------------------*/
@@ -52,7 +52,9 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include "ps2.h"
 #include "ps2_io.h"
+#include "ps2_stream.h"
 #include "print.h"
+#include "timer.h"
 #include "wait.h"
 
 #define WAIT(stat, us, err)     \
@@ -63,11 +65,16 @@ POSSIBILITY OF SUCH DAMAGE.
         }                       \
     } while (0)
 
+// A frame's clock edges are at most 100us apart, a longer gap means an edge was missed
+#ifndef PS2_FRAME_TIMEOUT
+#    define PS2_FRAME_TIMEOUT 1
+#endif
+
 uint8_t ps2_error = PS2_ERR_NONE;
 
+static ps2_ring_t pbuf;
+
 static inline uint8_t pbuf_dequeue(void);
-static inline void    pbuf_enqueue(uint8_t data);
-static inline void    pbuf_clear(void);
 bool                  pbuf_has_data(void);
 
 #if defined(PROTOCOL_CHIBIOS)
@@ -89,6 +96,11 @@ void palCallback(void *arg) {
         do {                                    \
             palDisableLineEvent(PS2_CLOCK_PIN); \
         } while (0)
+
+// timer_read() takes the system lock, which can't be done from the clock interrupt
+#    define PS2_EDGE_TIME() ((uint16_t)TIME_I2MS(chVTGetSystemTimeX()))
+#else
+#    define PS2_EDGE_TIME() timer_read()
 #endif // PROTOCOL_CHIBIOS
 
 void ps2_host_init(void) {
@@ -99,7 +111,8 @@ void ps2_host_init(void) {
     // wait_ms(2500);
 }
 
-uint8_t ps2_host_send(uint8_t data) {
+/* send a byte without waiting for the device to answer, the answer ends up in the receive buffer */
+bool ps2_host_transmit(uint8_t data) {
     bool parity = true;
     ps2_error   = PS2_ERR_NONE;
 
@@ -150,11 +163,18 @@ uint8_t ps2_host_send(uint8_t data) {
 
     idle();
     PS2_INT_ON();
-    return ps2_host_recv_response();
+    return true;
 ERROR:
     idle();
     PS2_INT_ON();
-    return 0;
+    return false;
+}
+
+uint8_t ps2_host_send(uint8_t data) {
+    if (!ps2_host_transmit(data)) {
+        return 0;
+    }
+    return ps2_host_recv_response();
 }
 
 uint8_t ps2_host_recv_response(void) {
@@ -177,74 +197,43 @@ uint8_t ps2_host_recv(void) {
     }
 }
 
+/* get data received by interrupt, if any, without touching ps2_error */
+bool ps2_host_recv_nowait(uint8_t *data) {
+    return ps2_ring_pop(&pbuf, data);
+}
+
+/* whether data was dropped because the receive buffer was full, since the last call */
+bool ps2_host_recv_overflow(void) {
+    return ps2_ring_take_overflow(&pbuf);
+}
+
 void ps2_interrupt_service_routine(void) {
-    static enum {
-        INIT,
-        START,
-        BIT0,
-        BIT1,
-        BIT2,
-        BIT3,
-        BIT4,
-        BIT5,
-        BIT6,
-        BIT7,
-        PARITY,
-        STOP,
-    } state               = INIT;
-    static uint8_t data   = 0;
-    static uint8_t parity = 1;
-
-    // TODO: abort if elapse 100us from previous interrupt
+    static ps2_frame_t frame     = {.parity = 1};
+    static uint16_t    last_edge = 0;
 
     // return unless falling edge
     if (clock_in()) {
-        goto RETURN;
+        return;
     }
 
-    state++;
-    switch (state) {
-        case START:
-            if (data_in()) goto ERROR;
-            break;
-        case BIT0:
-        case BIT1:
-        case BIT2:
-        case BIT3:
-        case BIT4:
-        case BIT5:
-        case BIT6:
-        case BIT7:
-            data >>= 1;
-            if (data_in()) {
-                data |= 0x80;
-                parity++;
-            }
-            break;
-        case PARITY:
-            if (data_in()) {
-                if (!(parity & 0x01)) goto ERROR;
-            } else {
-                if (parity & 0x01) goto ERROR;
-            }
+    // Start over on a frame which stalled halfway, rather than misreading the following ones
+    uint16_t now = PS2_EDGE_TIME();
+    if (frame.bit && TIMER_DIFF_16(now, last_edge) > PS2_FRAME_TIMEOUT) {
+        ps2_frame_reset(&frame);
+    }
+    last_edge = now;
+
+    uint8_t data;
+    switch (ps2_frame_clock(&frame, data_in(), &data)) {
+        case PS2_FRAME_DONE:
+            ps2_ring_push(&pbuf, data);
             break;
-        case STOP:
-            if (!data_in()) goto ERROR;
-            pbuf_enqueue(data);
-            goto DONE;
+        case PS2_FRAME_ERROR:
+            ps2_error = frame.error;
             break;
         default:
-            goto ERROR;
+            break;
     }
-    goto RETURN;
-ERROR:
-    ps2_error = state;
-DONE:
-    state  = INIT;
-    data   = 0;
-    parity = 1;
-RETURN:
-    return;
 }
 
 #if defined(__AVR__)
@@ -261,86 +250,14 @@ void ps2_host_set_led(uint8_t led) {
 
 /*--------------------------------------------------------------------
  * Ring buffer to store scan codes from keyboard
+ *
+ * Written only by the interrupt and read only by the main loop, so neither side needs to mask interrupts.
  *------------------------------------------------------------------*/
-#define PBUF_SIZE 32
-static uint8_t     pbuf[PBUF_SIZE];
-static uint8_t     pbuf_head = 0;
-static uint8_t     pbuf_tail = 0;
-static inline void pbuf_enqueue(uint8_t data) {
-#if defined(__AVR__)
-    uint8_t sreg = SREG;
-    cli();
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysLockFromISR();
-#endif
-
-    uint8_t next = (pbuf_head + 1) % PBUF_SIZE;
-    if (next != pbuf_tail) {
-        pbuf[pbuf_head] = data;
-        pbuf_head       = next;
-    } else {
-        print("pbuf: full\n");
-    }
-
-#if defined(__AVR__)
-    SREG = sreg;
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysUnlockFromISR();
-#endif
-}
 static inline uint8_t pbuf_dequeue(void) {
     uint8_t val = 0;
-
-#if defined(__AVR__)
-    uint8_t sreg = SREG;
-    cli();
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysLock();
-#endif
-
-    if (pbuf_head != pbuf_tail) {
-        val       = pbuf[pbuf_tail];
-        pbuf_tail = (pbuf_tail + 1) % PBUF_SIZE;
-    }
-
-#if defined(__AVR__)
-    SREG = sreg;
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysUnlock();
-#endif
-
+    ps2_ring_pop(&pbuf, &val);
     return val;
 }
 bool pbuf_has_data(void) {
-#if defined(__AVR__)
-    uint8_t sreg = SREG;
-    cli();
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysLock();
-#endif
-
-    bool has_data = (pbuf_head != pbuf_tail);
-
-#if defined(__AVR__)
-    SREG = sreg;
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysUnlock();
-#endif
-    return has_data;
-}
-static inline void pbuf_clear(void) {
-#if defined(__AVR__)
-    uint8_t sreg = SREG;
-    cli();
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysLock();
-#endif
-
-    pbuf_head = pbuf_tail = 0;
-
-#if defined(__AVR__)
-    SREG = sreg;
-#elif defined(PROTOCOL_CHIBIOS)
-    chSysUnlock();
-#endif
+    return ps2_ring_count(&pbuf) != 0;
 }
@@ -24,12 +24,53 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "print.h"
 #include "report.h"
 #include "debug.h"
+#include "util.h"
 #include "ps2.h"
 
+/* Stream mode on the interrupt driver is read without blocking the main loop */
+#if defined(PS2_DRIVER_INTERRUPT) && !defined(PS2_MOUSE_USE_REMOTE_MODE)
+#    define PS2_MOUSE_NONBLOCKING
+#    include "ps2_stream.h"
+#endif
+
 /* ============================= MACROS ============================ */
 
 static report_mouse_t mouse_report = {};
 
+#ifdef PS2_MOUSE_NONBLOCKING
+static enum {
+    PS2_MOUSE_POWER_UP,
+    PS2_MOUSE_SETUP,
+    PS2_MOUSE_READY,
+} ps2_mouse_state;
+static uint16_t           ps2_mouse_state_time;
+static ps2_sequence_t     ps2_mouse_sequence;
+static ps2_mouse_packet_t ps2_mouse_packet;
+static uint8_t            ps2_mouse_reset_response[2];
+static uint8_t            ps2_mouse_device_id;
+
+static const ps2_command_t ps2_mouse_setup_commands[] = {
+    // The self test after a reset may take 500ms([3]p.20), then the device sends BAT and its id
+    {PS2_MOUSE_RESET, 2, 1000, ps2_mouse_reset_response},
+    {PS2_MOUSE_SET_STREAM_MODE},
+#    ifdef PS2_MOUSE_ENABLE_SCROLLING
+    {PS2_MOUSE_SET_SAMPLE_RATE},
+    {200},
+    {PS2_MOUSE_SET_SAMPLE_RATE},
+    {100},
+    {PS2_MOUSE_SET_SAMPLE_RATE},
+    {80},
+    {PS2_MOUSE_GET_DEVICE_ID, 1, 0, &ps2_mouse_device_id},
+#    endif
+#    ifdef PS2_MOUSE_USE_2_1_SCALING
+    {PS2_MOUSE_SET_SCALING_2_1},
+#    endif
+    {PS2_MOUSE_ENABLE_DATA_REPORTING},
+};
+
+static bool ps2_mouse_setup_task(void);
+#endif
+
 static inline void ps2_mouse_print_report(report_mouse_t *mouse_report);
 static inline void ps2_mouse_convert_report_to_hid(report_mouse_t *mouse_report);
 static inline void ps2_mouse_clear_report(report_mouse_t *mouse_report);
@@ -42,6 +83,11 @@ static inline void ps2_mouse_scroll_button_task(report_mouse_t *mouse_report);
 void ps2_mouse_init(void) {
     ps2_host_init();
 
+#ifdef PS2_MOUSE_NONBLOCKING
+    // The device is set up by ps2_mouse_task(), once it has had time to power up
+    ps2_mouse_state      = PS2_MOUSE_POWER_UP;
+    ps2_mouse_state_time = timer_read();
+#else
     wait_ms(PS2_MOUSE_INIT_DELAY); // wait for powering up
 
     PS2_MOUSE_SEND(PS2_MOUSE_RESET, "ps2_mouse_init: sending reset");
@@ -49,22 +95,23 @@ void ps2_mouse_init(void) {
     PS2_MOUSE_RECEIVE("ps2_mouse_init: read BAT");
     PS2_MOUSE_RECEIVE("ps2_mouse_init: read DevID");
 
-#ifdef PS2_MOUSE_USE_REMOTE_MODE
+#    ifdef PS2_MOUSE_USE_REMOTE_MODE
     ps2_mouse_set_remote_mode();
-#else
+#    else
     ps2_mouse_enable_data_reporting();
     ps2_mouse_set_stream_mode();
-#endif
+#    endif
 
-#ifdef PS2_MOUSE_ENABLE_SCROLLING
+#    ifdef PS2_MOUSE_ENABLE_SCROLLING
     ps2_mouse_enable_scrolling();
-#endif
+#    endif
 
-#ifdef PS2_MOUSE_USE_2_1_SCALING
+#    ifdef PS2_MOUSE_USE_2_1_SCALING
     ps2_mouse_set_scaling_2_1();
-#endif
+#    endif
 
     ps2_mouse_init_user();
+#endif // PS2_MOUSE_NONBLOCKING
 }
 
 __attribute__((weak)) void ps2_mouse_init_user(void) {}
@@ -91,6 +138,34 @@ void ps2_mouse_task(void) {
         /* return here to avoid updating the mouse button state */
         return;
     }
+#elif defined(PS2_MOUSE_NONBLOCKING)
+    if (!ps2_mouse_setup_task()) {
+        return;
+    }
+
+    if (ps2_host_recv_overflow()) {
+        if (debug_mouse) print("ps2_mouse: receive buffer overflow\n");
+        ps2_mouse_packet_reset(&ps2_mouse_packet, ps2_mouse_packet.size);
+    }
+
+    uint8_t data;
+    bool    complete = false;
+    while (!complete && ps2_host_recv_nowait(&data)) {
+        complete = ps2_mouse_packet_feed(&ps2_mouse_packet, data);
+    }
+    if (!complete) {
+        /* return here to avoid updating the mouse button state */
+        return;
+    }
+
+    mouse_report.buttons = ps2_mouse_packet.bytes[0];
+    mouse_report.x       = ps2_mouse_packet.bytes[1];
+    mouse_report.y       = ps2_mouse_packet.bytes[2];
+#    ifdef PS2_MOUSE_ENABLE_SCROLLING
+    if (ps2_mouse_packet.size == 4) {
+        mouse_report.v = -(ps2_mouse_packet.bytes[3] & PS2_MOUSE_SCROLL_MASK);
+    }
+#    endif
 #else
     if (pbuf_has_data()) {
         mouse_report.buttons = ps2_host_recv_response();
@@ -167,6 +242,61 @@ void ps2_mouse_set_sample_rate(ps2_mouse_sample_rate_t sample_rate) {
 
 /* ============================= HELPERS ============================ */
 
+#ifdef PS2_MOUSE_NONBLOCKING
+/* steps through setting the device up, returns true once it streams packets */
+static bool ps2_mouse_setup_task(void) {
+    uint8_t data;
+
+    if (ps2_mouse_state == PS2_MOUSE_READY) {
+        return true;
+    }
+
+    if (ps2_mouse_state == PS2_MOUSE_POWER_UP) {
+        if (timer_elapsed(ps2_mouse_state_time) < PS2_MOUSE_INIT_DELAY) {
+            return false;
+        }
+        // Drop whatever the device sent while powering up
+        while (ps2_host_recv_nowait(&data)) {
+        }
+        ps2_host_recv_overflow();
+        ps2_mouse_device_id = 0;
+        ps2_sequence_start(&ps2_mouse_sequence, ps2_mouse_setup_commands, ARRAY_SIZE(ps2_mouse_setup_commands));
+        ps2_mouse_state = PS2_MOUSE_SETUP;
+    }
+
+    while (ps2_host_recv_nowait(&data)) {
+        ps2_sequence_receive(&ps2_mouse_sequence, data);
+    }
+
+    uint8_t command;
+    if (ps2_sequence_next(&ps2_mouse_sequence, &command)) {
+        // A failed transmission is caught by the timeout
+        ps2_host_transmit(command);
+        ps2_sequence_sent(&ps2_mouse_sequence, timer_read());
+    }
+
+    switch (ps2_sequence_task(&ps2_mouse_sequence, timer_read())) {
+        case PS2_SEQUENCE_DONE:
+            // Only devices which took the scroll wheel sequence send the fourth byte
+            ps2_mouse_packet_reset(&ps2_mouse_packet, ps2_mouse_device_id == 3 || ps2_mouse_device_id == 4 ? 4 : 3);
+            ps2_mouse_mode  = PS2_MOUSE_STREAM_MODE;
+            ps2_mouse_state = PS2_MOUSE_READY;
+            if (debug_mouse) xprintf("ps2_mouse: ready, BAT: %X, device id: %X\n", ps2_mouse_reset_response[0], ps2_mouse_device_id);
+            ps2_mouse_init_user();
+            break;
+        case PS2_SEQUENCE_FAILED:
+            if (debug_mouse) xprintf("ps2_mouse: command %X failed, error: %X\n", ps2_mouse_setup_commands[ps2_mouse_sequence.index].command, ps2_error);
+            // Start over, giving the device time to recover
+            ps2_mouse_state      = PS2_MOUSE_POWER_UP;
+            ps2_mouse_state_time = timer_read();
+            break;
+        default:
+            break;
+    }
+    return false;
+}
+#endif // PS2_MOUSE_NONBLOCKING
+
 #define X_IS_NEG (mouse_report->buttons & (1 << PS2_MOUSE_X_SIGN))
 #define Y_IS_NEG (mouse_report->buttons & (1 << PS2_MOUSE_Y_SIGN))
 #define X_IS_OVF (mouse_report->buttons & (1 << PS2_MOUSE_X_OVFLW))
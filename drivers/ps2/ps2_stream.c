@@ -0,0 +1,197 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include "ps2_stream.h"
+#include "timer.h"
+
+#define PS2_STREAM_ACK 0xFA
+#define PS2_STREAM_RESEND 0xFE
+
+/* ============================= FRAME ============================ */
+
+// Edges of a frame: start bit, 8 data bits LSB first, odd parity, stop bit
+enum {
+    PS2_FRAME_START  = 1,
+    PS2_FRAME_BIT7   = 9,
+    PS2_FRAME_PARITY = 10,
+    PS2_FRAME_STOP   = 11,
+};
+
+void ps2_frame_reset(ps2_frame_t *frame) {
+    frame->bit    = 0;
+    frame->data   = 0;
+    frame->parity = 1;
+    frame->bad    = false;
+}
+
+/**
+ * @brief Decodes the data line sampled on a falling clock edge
+ *
+ * @param[in,out] frame decoder state, reset once a frame completes or fails
+ * @param[in] data_bit level of the data line
+ * @param[out] data byte received, when the frame is done
+ * @return PS2_FRAME_DONE when a byte has been received, PS2_FRAME_ERROR when the frame was dropped
+ */
+ps2_frame_status_t ps2_frame_clock(ps2_frame_t *frame, bool data_bit, uint8_t *data) {
+    frame->bit++;
+
+    if (frame->bit == PS2_FRAME_START) {
+        if (data_bit) goto ERROR;
+    } else if (frame->bit <= PS2_FRAME_BIT7) {
+        frame->data >>= 1;
+        if (data_bit) {
+            frame->data |= 0x80;
+            frame->parity++;
+        }
+    } else if (frame->bit == PS2_FRAME_PARITY) {
+        // Keep counting edges, so that the stop bit isn't mistaken for the start of the next frame
+        if (data_bit != (frame->parity & 0x01)) {
+            frame->bad   = true;
+            frame->error = frame->bit;
+        }
+    } else if (frame->bit == PS2_FRAME_STOP) {
+        if (frame->bad) {
+            ps2_frame_reset(frame);
+            return PS2_FRAME_ERROR;
+        }
+        if (!data_bit) goto ERROR;
+        *data = frame->data;
+        ps2_frame_reset(frame);
+        return PS2_FRAME_DONE;
+    } else {
+        goto ERROR;
+    }
+    return PS2_FRAME_PENDING;
+
+ERROR:
+    frame->error = frame->bit;
+    ps2_frame_reset(frame);
+    return PS2_FRAME_ERROR;
+}
+
+/* ============================= COMMANDS ============================ */
+
+static void ps2_sequence_advance(ps2_sequence_t *sequence) {
+    sequence->index++;
+    sequence->resends = 0;
+    sequence->state   = sequence->index < sequence->count ? PS2_SEQUENCE_SEND : PS2_SEQUENCE_DONE;
+}
+
+/**
+ * @brief Starts sending a list of commands, each one once the previous has been answered
+ */
+void ps2_sequence_start(ps2_sequence_t *sequence, const ps2_command_t *commands, uint8_t count) {
+    sequence->commands = commands;
+    sequence->count    = count;
+    sequence->index    = 0;
+    sequence->resends  = 0;
+    sequence->state    = count ? PS2_SEQUENCE_SEND : PS2_SEQUENCE_DONE;
+}
+
+/**
+ * @brief Gets the command to send next
+ *
+ * @param[out] command byte to send to the device, followed by a call to ps2_sequence_sent()
+ * @return true when a command is due
+ */
+bool ps2_sequence_next(ps2_sequence_t *sequence, uint8_t *command) {
+    if (sequence->state != PS2_SEQUENCE_SEND) {
+        return false;
+    }
+    *command = sequence->commands[sequence->index].command;
+    return true;
+}
+
+/**
+ * @brief Starts waiting for the answer to the command just sent
+ *
+ * @param[in] now timer_read() when the command was sent
+ */
+void ps2_sequence_sent(ps2_sequence_t *sequence, uint16_t now) {
+    sequence->state     = PS2_SEQUENCE_WAIT;
+    sequence->acked     = false;
+    sequence->received  = 0;
+    sequence->sent_time = now;
+}
+
+/**
+ * @brief Hands a byte received from the device to the sequence
+ *
+ * Bytes received while no command is waiting for an answer are ignored.
+ */
+void ps2_sequence_receive(ps2_sequence_t *sequence, uint8_t data) {
+    if (sequence->state != PS2_SEQUENCE_WAIT) {
+        return;
+    }
+
+    const ps2_command_t *command = &sequence->commands[sequence->index];
+    if (!sequence->acked) {
+        if (data == PS2_STREAM_ACK) {
+            sequence->acked = true;
+        } else if (data == PS2_STREAM_RESEND && sequence->resends < PS2_COMMAND_RESENDS) {
+            sequence->resends++;
+            sequence->state = PS2_SEQUENCE_SEND;
+            return;
+        } else {
+            sequence->state = PS2_SEQUENCE_FAILED;
+            return;
+        }
+    } else {
+        if (command->response) {
+            command->response[sequence->received] = data;
+        }
+        sequence->received++;
+    }
+
+    if (sequence->received == command->responses) {
+        ps2_sequence_advance(sequence);
+    }
+}
+
+/**
+ * @brief Fails the sequence when the device takes too long to answer
+ *
+ * @param[in] now timer_read()
+ * @return state of the sequence
+ */
+ps2_sequence_state_t ps2_sequence_task(ps2_sequence_t *sequence, uint16_t now) {
+    if (sequence->state == PS2_SEQUENCE_WAIT) {
+        uint16_t timeout = sequence->commands[sequence->index].timeout;
+        if (TIMER_DIFF_16(now, sequence->sent_time) > (timeout ? timeout : PS2_COMMAND_TIMEOUT)) {
+            sequence->state = PS2_SEQUENCE_FAILED;
+        }
+    }
+    return sequence->state;
+}
+
+/* ============================= MOUSE PACKETS ============================ */
+
+// Bit 3 of the first byte of a packet is always set, see the data format in ps2_mouse.h
+#define PS2_MOUSE_PACKET_SYNC (1 << 3)
+
+void ps2_mouse_packet_reset(ps2_mouse_packet_t *packet, uint8_t size) {
+    packet->length = 0;
+    packet->size   = size;
+}
+
+/**
+ * @brief Adds a byte received in stream mode to the packet being assembled
+ *
+ * A byte which can't start a packet is skipped, so that after lost bytes the packets line up again.
+ *
+ * @return true when a whole packet is in packet->bytes
+ */
+bool ps2_mouse_packet_feed(ps2_mouse_packet_t *packet, uint8_t data) {
+    if (packet->length == 0 && !(data & PS2_MOUSE_PACKET_SYNC)) {
+        return false;
+    }
+
+    packet->bytes[packet->length++] = data;
+    if (packet->length < packet->size) {
+        return false;
+    }
+
+    packet->length = 0;
+    return true;
+}
@@ -0,0 +1,147 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Hardware independent parts of the PS/2 host
+ *
+ * - a frame decoder, fed one data bit per falling clock edge
+ * - a single producer, single consumer ring buffer, written from the clock interrupt and read from the main loop
+ *   without masking interrupts
+ * - a non-blocking command sequencer, for the exchanges needed to set a device up
+ * - a mouse packet assembler, which keeps packets aligned in stream mode
+ */
+
+#ifndef PS2_BUFFER_SIZE
+#    define PS2_BUFFER_SIZE 64
+#endif
+#if PS2_BUFFER_SIZE < 2 || PS2_BUFFER_SIZE > 128 || (PS2_BUFFER_SIZE & (PS2_BUFFER_SIZE - 1)) != 0
+#    error "PS2_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+
+#ifndef PS2_COMMAND_TIMEOUT
+#    define PS2_COMMAND_TIMEOUT 25
+#endif
+#ifndef PS2_COMMAND_RESENDS
+#    define PS2_COMMAND_RESENDS 3
+#endif
+
+/* ============================= FRAME ============================ */
+
+typedef enum {
+    PS2_FRAME_PENDING,
+    PS2_FRAME_DONE,
+    PS2_FRAME_ERROR,
+} ps2_frame_status_t;
+
+typedef struct {
+    uint8_t bit;    // clock edges seen in the current frame
+    uint8_t data;   // data bits shifted in so far
+    uint8_t parity; // count of 1 bits, starting at 1 for odd parity
+    bool    bad;    // parity didn't match, the frame is dropped at its stop bit
+    uint8_t error;  // edge of the frame the last error was detected at
+} ps2_frame_t;
+
+void               ps2_frame_reset(ps2_frame_t *frame);
+ps2_frame_status_t ps2_frame_clock(ps2_frame_t *frame, bool data_bit, uint8_t *data);
+
+/* ============================= RING ============================ */
+
+typedef struct {
+    volatile uint8_t head;           // written by the producer only
+    volatile uint8_t tail;           // written by the consumer only
+    volatile uint8_t overflows;      // written by the producer only
+    uint8_t          overflows_seen; // written by the consumer only
+    volatile uint8_t buffer[PS2_BUFFER_SIZE];
+} ps2_ring_t;
+
+/* producer side, safe to call from an interrupt */
+static inline bool ps2_ring_push(ps2_ring_t *ring, uint8_t data) {
+    uint8_t head = ring->head;
+    if ((uint8_t)(head - ring->tail) >= PS2_BUFFER_SIZE) {
+        ring->overflows++;
+        return false;
+    }
+    ring->buffer[head & (PS2_BUFFER_SIZE - 1)] = data;
+    // Publish the byte only once it's in the buffer
+    ring->head = head + 1;
+    return true;
+}
+
+/* consumer side */
+static inline bool ps2_ring_pop(ps2_ring_t *ring, uint8_t *data) {
+    uint8_t tail = ring->tail;
+    if (tail == ring->head) {
+        return false;
+    }
+    *data      = ring->buffer[tail & (PS2_BUFFER_SIZE - 1)];
+    ring->tail = tail + 1;
+    return true;
+}
+
+static inline uint8_t ps2_ring_count(const ps2_ring_t *ring) {
+    return ring->head - ring->tail;
+}
+
+/* consumer side, drops everything received so far */
+static inline void ps2_ring_clear(ps2_ring_t *ring) {
+    ring->tail = ring->head;
+}
+
+/* consumer side, reports whether bytes were dropped since the last call */
+static inline bool ps2_ring_take_overflow(ps2_ring_t *ring) {
+    uint8_t overflows = ring->overflows;
+    if (overflows == ring->overflows_seen) {
+        return false;
+    }
+    ring->overflows_seen = overflows;
+    return true;
+}
+
+/* ============================= COMMANDS ============================ */
+
+typedef struct {
+    uint8_t  command;
+    uint8_t  responses; // bytes the device sends after its ACK
+    uint16_t timeout;   // ms to wait for the ACK and responses, PS2_COMMAND_TIMEOUT when 0
+    uint8_t *response;  // where the responses are stored, or NULL
+} ps2_command_t;
+
+typedef enum {
+    PS2_SEQUENCE_SEND,
+    PS2_SEQUENCE_WAIT,
+    PS2_SEQUENCE_DONE,
+    PS2_SEQUENCE_FAILED,
+} ps2_sequence_state_t;
+
+typedef struct {
+    const ps2_command_t *commands;
+    uint8_t              count;
+    uint8_t              index;
+    uint8_t              received;
+    uint8_t              resends;
+    bool                 acked;
+    ps2_sequence_state_t state;
+    uint16_t             sent_time;
+} ps2_sequence_t;
+
+void                 ps2_sequence_start(ps2_sequence_t *sequence, const ps2_command_t *commands, uint8_t count);
+bool                 ps2_sequence_next(ps2_sequence_t *sequence, uint8_t *command);
+void                 ps2_sequence_sent(ps2_sequence_t *sequence, uint16_t now);
+void                 ps2_sequence_receive(ps2_sequence_t *sequence, uint8_t data);
+ps2_sequence_state_t ps2_sequence_task(ps2_sequence_t *sequence, uint16_t now);
+
+/* ============================= MOUSE PACKETS ============================ */
+
+typedef struct {
+    uint8_t bytes[4];
+    uint8_t length; // bytes received of the current packet
+    uint8_t size;   // 3, or 4 for devices with a scroll wheel
+} ps2_mouse_packet_t;
+
+void ps2_mouse_packet_reset(ps2_mouse_packet_t *packet, uint8_t size);
+bool ps2_mouse_packet_feed(ps2_mouse_packet_t *packet, uint8_t data);
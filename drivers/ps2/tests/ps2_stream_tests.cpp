@@ -0,0 +1,235 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <vector>
+
+extern "C" {
+#include "ps2_stream.h"
+}
+
+// Data line levels for one frame: start bit, data LSB first, odd parity, stop bit
+static std::vector<bool> frame_bits(uint8_t data, bool bad_parity = false) {
+    std::vector<bool> bits = {false};
+    bool              odd  = true;
+    for (int i = 0; i < 8; i++) {
+        bool bit = data & (1 << i);
+        bits.push_back(bit);
+        odd ^= bit;
+    }
+    bits.push_back(odd ^ bad_parity);
+    bits.push_back(true);
+    return bits;
+}
+
+class Ps2StreamTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        ps2_frame_reset(&frame);
+        ring = {};
+    }
+
+    // Clocks bits into the frame decoder, as the interrupt does, pushing the bytes received into the ring
+    void clock_in(const std::vector<bool> &bits) {
+        for (bool bit : bits) {
+            uint8_t data;
+            switch (ps2_frame_clock(&frame, bit, &data)) {
+                case PS2_FRAME_DONE:
+                    ps2_ring_push(&ring, data);
+                    break;
+                case PS2_FRAME_ERROR:
+                    errors.push_back(frame.error);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    void clock_in_bytes(const std::vector<uint8_t> &bytes) {
+        for (uint8_t data : bytes) {
+            clock_in(frame_bits(data));
+        }
+    }
+
+    std::vector<uint8_t> drain() {
+        std::vector<uint8_t> bytes;
+        uint8_t              data;
+        while (ps2_ring_pop(&ring, &data)) {
+            bytes.push_back(data);
+        }
+        return bytes;
+    }
+
+    ps2_frame_t          frame;
+    ps2_ring_t           ring;
+    std::vector<uint8_t> errors;
+};
+
+TEST_F(Ps2StreamTest, FrameDecodesEveryByte) {
+    for (int data = 0; data < 256; data++) {
+        clock_in(frame_bits(data));
+        EXPECT_EQ(drain(), std::vector<uint8_t>{(uint8_t)data});
+    }
+    EXPECT_TRUE(errors.empty());
+}
+
+TEST_F(Ps2StreamTest, FrameDropsBadParityAndRecovers) {
+    clock_in(frame_bits(0x5A, true));
+    clock_in(frame_bits(0xA5));
+
+    EXPECT_EQ(errors, std::vector<uint8_t>{10});
+    EXPECT_EQ(drain(), std::vector<uint8_t>{0xA5});
+}
+
+TEST_F(Ps2StreamTest, FrameDropsMissingStartBit) {
+    clock_in({true});
+    clock_in(frame_bits(0x12));
+
+    EXPECT_EQ(errors, std::vector<uint8_t>{1});
+    EXPECT_EQ(drain(), std::vector<uint8_t>{0x12});
+}
+
+TEST_F(Ps2StreamTest, RingOverflowIsReportedOnce) {
+    for (int i = 0; i < PS2_BUFFER_SIZE; i++) {
+        EXPECT_TRUE(ps2_ring_push(&ring, i));
+    }
+    EXPECT_FALSE(ps2_ring_push(&ring, 0xFF));
+    EXPECT_EQ(ps2_ring_count(&ring), PS2_BUFFER_SIZE);
+
+    EXPECT_TRUE(ps2_ring_take_overflow(&ring));
+    EXPECT_FALSE(ps2_ring_take_overflow(&ring));
+
+    std::vector<uint8_t> bytes = drain();
+    ASSERT_EQ(bytes.size(), PS2_BUFFER_SIZE);
+    for (int i = 0; i < PS2_BUFFER_SIZE; i++) {
+        EXPECT_EQ(bytes[i], i);
+    }
+}
+
+TEST_F(Ps2StreamTest, RingWrapsAround) {
+    // Run the indexes through their full range more than once
+    for (int i = 0; i < 600; i++) {
+        EXPECT_TRUE(ps2_ring_push(&ring, i));
+        EXPECT_TRUE(ps2_ring_push(&ring, i + 1));
+        EXPECT_EQ(drain(), (std::vector<uint8_t>{(uint8_t)i, (uint8_t)(i + 1)}));
+    }
+    EXPECT_FALSE(ps2_ring_take_overflow(&ring));
+}
+
+TEST_F(Ps2StreamTest, RingClearDropsPendingBytes) {
+    clock_in_bytes({1, 2, 3});
+    ps2_ring_clear(&ring);
+    clock_in_bytes({4});
+
+    EXPECT_EQ(drain(), std::vector<uint8_t>{4});
+}
+
+TEST_F(Ps2StreamTest, MousePacketsFromBitstream) {
+    ps2_mouse_packet_t packet;
+    ps2_mouse_packet_reset(&packet, 4);
+
+    clock_in_bytes({0x09, 0x10, 0xF0, 0x01, 0x38, 0xFF, 0x01, 0xFF});
+
+    std::vector<std::vector<uint8_t>> packets;
+    for (uint8_t data : drain()) {
+        if (ps2_mouse_packet_feed(&packet, data)) {
+            packets.emplace_back(packet.bytes, packet.bytes + packet.size);
+        }
+    }
+
+    ASSERT_EQ(packets.size(), 2);
+    EXPECT_EQ(packets[0], (std::vector<uint8_t>{0x09, 0x10, 0xF0, 0x01}));
+    EXPECT_EQ(packets[1], (std::vector<uint8_t>{0x38, 0xFF, 0x01, 0xFF}));
+}
+
+TEST_F(Ps2StreamTest, MousePacketsRealignAfterLostByte) {
+    ps2_mouse_packet_t packet;
+    ps2_mouse_packet_reset(&packet, 3);
+
+    // The X movement of the first packet was lost
+    std::vector<uint8_t> stream = {0x08, /* 0x01, */ 0x02, 0x09, 0x03, 0x04, 0x0A, 0x05, 0x06};
+
+    std::vector<std::vector<uint8_t>> packets;
+    for (uint8_t data : stream) {
+        if (ps2_mouse_packet_feed(&packet, data)) {
+            packets.emplace_back(packet.bytes, packet.bytes + packet.size);
+        }
+    }
+
+    ASSERT_FALSE(packets.empty());
+    EXPECT_EQ(packets.back(), (std::vector<uint8_t>{0x0A, 0x05, 0x06}));
+}
+
+TEST_F(Ps2StreamTest, SequenceSendsCommandsInTurn) {
+    uint8_t             id[2] = {};
+    const ps2_command_t commands[] = {
+        {0xFF, 2, 1000, id},
+        {0xF4},
+    };
+    ps2_sequence_t sequence;
+    uint8_t        command;
+
+    ps2_sequence_start(&sequence, commands, 2);
+    ASSERT_TRUE(ps2_sequence_next(&sequence, &command));
+    EXPECT_EQ(command, 0xFF);
+    ps2_sequence_sent(&sequence, 0);
+    EXPECT_FALSE(ps2_sequence_next(&sequence, &command));
+
+    ps2_sequence_receive(&sequence, 0xFA);
+    EXPECT_EQ(ps2_sequence_task(&sequence, 500), PS2_SEQUENCE_WAIT);
+    ps2_sequence_receive(&sequence, 0xAA);
+    ps2_sequence_receive(&sequence, 0x00);
+    EXPECT_EQ(id[0], 0xAA);
+    EXPECT_EQ(id[1], 0x00);
+
+    ASSERT_TRUE(ps2_sequence_next(&sequence, &command));
+    EXPECT_EQ(command, 0xF4);
+    ps2_sequence_sent(&sequence, 600);
+    ps2_sequence_receive(&sequence, 0xFA);
+    EXPECT_EQ(ps2_sequence_task(&sequence, 601), PS2_SEQUENCE_DONE);
+}
+
+TEST_F(Ps2StreamTest, SequenceResendsOnRequest) {
+    const ps2_command_t commands[] = {{0xF4}};
+    ps2_sequence_t      sequence;
+    uint8_t             command;
+
+    ps2_sequence_start(&sequence, commands, 1);
+    for (int i = 0; i < PS2_COMMAND_RESENDS; i++) {
+        ASSERT_TRUE(ps2_sequence_next(&sequence, &command));
+        ps2_sequence_sent(&sequence, 0);
+        ps2_sequence_receive(&sequence, 0xFE);
+    }
+    ASSERT_TRUE(ps2_sequence_next(&sequence, &command));
+    ps2_sequence_sent(&sequence, 0);
+    ps2_sequence_receive(&sequence, 0xFE);
+
+    EXPECT_EQ(ps2_sequence_task(&sequence, 0), PS2_SEQUENCE_FAILED);
+}
+
+TEST_F(Ps2StreamTest, SequenceFailsOnTimeout) {
+    const ps2_command_t commands[] = {{0xF4}};
+    ps2_sequence_t      sequence;
+    uint8_t             command;
+
+    ps2_sequence_start(&sequence, commands, 1);
+    ASSERT_TRUE(ps2_sequence_next(&sequence, &command));
+    ps2_sequence_sent(&sequence, 65530);
+
+    EXPECT_EQ(ps2_sequence_task(&sequence, 65530 + PS2_COMMAND_TIMEOUT), PS2_SEQUENCE_WAIT);
+    EXPECT_EQ(ps2_sequence_task(&sequence, 65530 + PS2_COMMAND_TIMEOUT + 1), PS2_SEQUENCE_FAILED);
+}
+
+TEST_F(Ps2StreamTest, SequenceFailsOnError) {
+    const ps2_command_t commands[] = {{0xF4}};
+    ps2_sequence_t      sequence;
+    uint8_t             command;
+
+    ps2_sequence_start(&sequence, commands, 1);
+    ASSERT_TRUE(ps2_sequence_next(&sequence, &command));
+    ps2_sequence_sent(&sequence, 0);
+    ps2_sequence_receive(&sequence, 0xFC);
+
+    EXPECT_EQ(ps2_sequence_task(&sequence, 1), PS2_SEQUENCE_FAILED);
+}
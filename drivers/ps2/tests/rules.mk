@@ -0,0 +1,6 @@
+ps2_stream_DEFS := -DPS2_BUFFER_SIZE=16
+ps2_stream_INC := $(DRIVER_PATH)/ps2
+
+ps2_stream_SRC := \
+	$(DRIVER_PATH)/ps2/tests/ps2_stream_tests.cpp \
+	$(DRIVER_PATH)/ps2/ps2_stream.c
@@ -0,0 +1 @@
+TEST_LIST += ps2_stream
@@ -4,7 +4,11 @@
 
 #include "azoteq_iqs5xx.h"
 #include "pointing_device_internal.h"
+#include "timer.h"
 #include "wait.h"
+#ifdef AZOTEQ_IQS5XX_DIGITIZER
+#    include "digitizer.h"
+#endif
 
 #ifndef AZOTEQ_IQS5XX_ADDRESS
 #    define AZOTEQ_IQS5XX_ADDRESS (0x74 << 1)
@@ -25,18 +29,23 @@
 #define AZOTEQ_IQS5XX_REG_SINGLE_FINGER_GESTURES 0x06B7
 #define AZOTEQ_IQS5XX_REG_END_COMMS 0xEEEE
 
-// Gesture configuration
+// Gesture configuration, taps and scrolls are left to the touch gesture recognizer when it is enabled
+#ifdef POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+#    define AZOTEQ_IQS5XX_HARDWARE_GESTURES false
+#else
+#    define AZOTEQ_IQS5XX_HARDWARE_GESTURES true
+#endif
 #ifndef AZOTEQ_IQS5XX_TAP_ENABLE
-#    define AZOTEQ_IQS5XX_TAP_ENABLE true
+#    define AZOTEQ_IQS5XX_TAP_ENABLE AZOTEQ_IQS5XX_HARDWARE_GESTURES
 #endif
 #ifndef AZOTEQ_IQS5XX_PRESS_AND_HOLD_ENABLE
 #    define AZOTEQ_IQS5XX_PRESS_AND_HOLD_ENABLE false
 #endif
 #ifndef AZOTEQ_IQS5XX_TWO_FINGER_TAP_ENABLE
-#    define AZOTEQ_IQS5XX_TWO_FINGER_TAP_ENABLE true
+#    define AZOTEQ_IQS5XX_TWO_FINGER_TAP_ENABLE AZOTEQ_IQS5XX_HARDWARE_GESTURES
 #endif
 #ifndef AZOTEQ_IQS5XX_SCROLL_ENABLE
-#    define AZOTEQ_IQS5XX_SCROLL_ENABLE true
+#    define AZOTEQ_IQS5XX_SCROLL_ENABLE AZOTEQ_IQS5XX_HARDWARE_GESTURES
 #endif
 #ifndef AZOTEQ_IQS5XX_SWIPE_X_ENABLE
 #    define AZOTEQ_IQS5XX_SWIPE_X_ENABLE false
@@ -112,6 +121,14 @@ static struct {
     uint16_t resolution_y;
 } azoteq_iqs5xx_device_resolution_t;
 
+#ifdef AZOTEQ_IQS5XX_DIGITIZER
+// Range of the absolute positions, the resolution last set on the trackpad
+static struct {
+    uint16_t resolution_x;
+    uint16_t resolution_y;
+} azoteq_iqs5xx_position_range;
+#endif
+
 i2c_status_t azoteq_iqs5xx_wake(void) {
     uint8_t      data   = 0;
     i2c_status_t status = i2c_read_register16(AZOTEQ_IQS5XX_ADDRESS, AZOTEQ_IQS5XX_REG_PREVIOUS_CYCLE_TIME, (uint8_t *)&data, sizeof(data), 1);
@@ -131,6 +148,15 @@ i2c_status_t azoteq_iqs5xx_get_base_data(azoteq_iqs5xx_base_data_t *base_data) {
     return status;
 }
 
+// Reads the base data along with the absolute positions of the first fingers, which follow it
+i2c_status_t azoteq_iqs5xx_get_touch_data(azoteq_iqs5xx_touch_data_t *touch_data) {
+    i2c_status_t status = i2c_read_register16(AZOTEQ_IQS5XX_ADDRESS, AZOTEQ_IQS5XX_REG_PREVIOUS_CYCLE_TIME, (uint8_t *)touch_data, sizeof(azoteq_iqs5xx_touch_data_t), AZOTEQ_IQS5XX_TIMEOUT_MS);
+    if (status == I2C_STATUS_SUCCESS) {
+        azoteq_iqs5xx_end_session();
+    }
+    return status;
+}
+
 i2c_status_t azoteq_iqs5xx_get_report_rate(azoteq_iqs5xx_report_rate_t *report_rate, azoteq_iqs5xx_charging_modes_t mode, bool end_session) {
     if (mode > AZOTEQ_IQS5XX_LP2) {
         pd_dprintf("IQS5XX - Invalid mode for get report rate.\n");
@@ -267,6 +293,10 @@ void azoteq_iqs5xx_set_cpi(uint16_t cpi) {
         resolution.x_resolution               = AZOTEQ_IQS5XX_SWAP_H_L_BYTES(MIN(azoteq_iqs5xx_device_resolution_t.resolution_x, AZOTEQ_IQS5XX_INCH_TO_RESOLUTION_X(cpi)));
         resolution.y_resolution               = AZOTEQ_IQS5XX_SWAP_H_L_BYTES(MIN(azoteq_iqs5xx_device_resolution_t.resolution_y, AZOTEQ_IQS5XX_INCH_TO_RESOLUTION_Y(cpi)));
         i2c_write_register16(AZOTEQ_IQS5XX_ADDRESS, AZOTEQ_IQS5XX_REG_X_RESOLUTION, (uint8_t *)&resolution, sizeof(azoteq_iqs5xx_resolution_t), AZOTEQ_IQS5XX_TIMEOUT_MS);
+#ifdef AZOTEQ_IQS5XX_DIGITIZER
+        azoteq_iqs5xx_position_range.resolution_x = AZOTEQ_IQS5XX_SWAP_H_L_BYTES(resolution.x_resolution);
+        azoteq_iqs5xx_position_range.resolution_y = AZOTEQ_IQS5XX_SWAP_H_L_BYTES(resolution.y_resolution);
+#endif
     }
 }
 
@@ -318,6 +348,10 @@ void azoteq_iqs5xx_setup_resolution(void) {
 #ifdef AZOTEQ_IQS5XX_RESOLUTION_Y
     azoteq_iqs5xx_device_resolution_t.resolution_y = AZOTEQ_IQS5XX_RESOLUTION_Y;
 #endif
+#ifdef AZOTEQ_IQS5XX_DIGITIZER
+    azoteq_iqs5xx_position_range.resolution_x = azoteq_iqs5xx_device_resolution_t.resolution_x;
+    azoteq_iqs5xx_position_range.resolution_y = azoteq_iqs5xx_device_resolution_t.resolution_y;
+#endif
 }
 
 static i2c_status_t azoteq_iqs5xx_init_status = 1;
@@ -357,12 +391,51 @@ report_mouse_t azoteq_iqs5xx_get_report(report_mouse_t mouse_report) {
 #if !defined(POINTING_DEVICE_MOTION_PIN)
         azoteq_iqs5xx_wake();
 #endif
-        i2c_status_t status          = azoteq_iqs5xx_get_base_data(&base_data);
-        bool         ignore_movement = false;
+#if defined(POINTING_DEVICE_GESTURES_TOUCH_ENABLE) || defined(AZOTEQ_IQS5XX_DIGITIZER)
+        azoteq_iqs5xx_touch_data_t touch_data = {0};
+        i2c_status_t               status     = azoteq_iqs5xx_get_touch_data(&touch_data);
+        base_data                             = touch_data.base_data;
+#else
+        i2c_status_t status = azoteq_iqs5xx_get_base_data(&base_data);
+#endif
+        bool ignore_movement = false;
 
         if (status == I2C_STATUS_SUCCESS) {
             // pd_dprintf("IQS5XX - previous cycle time: %d \n", base_data.previous_cycle_time);
             read_error_count = 0;
+#if defined(POINTING_DEVICE_GESTURES_TOUCH_ENABLE)
+            touch_sample_t sample = {.time = timer_read(), .fingers = base_data.number_of_fingers};
+            for (uint8_t i = 0; i < TOUCH_SAMPLE_CONTACTS; i++) {
+                sample.contacts[i].x = (uint16_t)(touch_data.fingers[i].x.h << 8) | touch_data.fingers[i].x.l;
+                sample.contacts[i].y = (uint16_t)(touch_data.fingers[i].y.h << 8) | touch_data.fingers[i].y.l;
+            }
+            touch_gesture_record(&sample);
+            // The recognizer reports taps and scrolls from the samples, the trackpad's own would report them twice
+            base_data.gesture_events_0.single_tap     = false;
+            base_data.gesture_events_1.two_finger_tap = false;
+            base_data.gesture_events_1.scroll         = false;
+#endif
+#if defined(AZOTEQ_IQS5XX_DIGITIZER)
+            // The trackpad doesn't keep finger identifiers, the digitizer tracks them by position
+            digitizer_contact_t contacts[AZOTEQ_IQS5XX_TOUCH_FINGERS];
+            uint8_t             count = MIN(base_data.number_of_fingers, AZOTEQ_IQS5XX_TOUCH_FINGERS);
+            if (!azoteq_iqs5xx_position_range.resolution_x || !azoteq_iqs5xx_position_range.resolution_y) {
+                count = 0;
+            }
+            for (uint8_t i = 0; i < count; i++) {
+                uint16_t x  = (uint16_t)(touch_data.fingers[i].x.h << 8) | touch_data.fingers[i].x.l;
+                uint16_t y  = (uint16_t)(touch_data.fingers[i].y.h << 8) | touch_data.fingers[i].y.l;
+                contacts[i] = (digitizer_contact_t){
+                    .id         = DIGITIZER_CONTACT_ID_NONE,
+                    .confidence = !base_data.system_info_1.palm_detect,
+                    .x          = MIN((uint32_t)x * 0x7FFF / azoteq_iqs5xx_position_range.resolution_x, 0x7FFF),
+                    .y          = MIN((uint32_t)y * 0x7FFF / azoteq_iqs5xx_position_range.resolution_y, 0x7FFF),
+                };
+            }
+            digitizer_set_contacts(contacts, count);
+            // The contacts replace the relative motion
+            ignore_movement = true;
+#endif
             if (base_data.gesture_events_0.single_tap || base_data.gesture_events_0.press_and_hold) {
                 pd_dprintf("IQS5XX - Single tap/hold.\n");
                 temp_report.buttons = pointing_device_handle_buttons(temp_report.buttons, true, POINTING_DEVICE_BUTTON1);
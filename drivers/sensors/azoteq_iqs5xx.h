@@ -89,6 +89,35 @@ typedef struct {
 
 _Static_assert(sizeof(azoteq_iqs5xx_report_data_t) == 5, "azoteq_iqs5xx_report_data_t should be 5 bytes");
 
+typedef struct PACKED {
+    azoteq_iqs5xx_relative_xy_t x; // absolute position, high byte first
+    azoteq_iqs5xx_relative_xy_t y;
+    azoteq_iqs5xx_relative_xy_t touch_strength;
+    uint8_t                     area;
+} azoteq_iqs5xx_finger_data_t;
+
+_Static_assert(sizeof(azoteq_iqs5xx_finger_data_t) == 7, "azoteq_iqs5xx_finger_data_t should be 7 bytes");
+
+#if defined(AZOTEQ_IQS5XX_DIGITIZER) && !(defined(DIGITIZER_ENABLE) && defined(DIGITIZER_CONTACT_COUNT))
+#    error "AZOTEQ_IQS5XX_DIGITIZER requires DIGITIZER_ENABLE and DIGITIZER_CONTACT_COUNT"
+#endif
+
+// Fingers whose positions are read along with the base data, the trackpad tracks up to 5
+#ifndef AZOTEQ_IQS5XX_TOUCH_FINGERS
+#    ifdef AZOTEQ_IQS5XX_DIGITIZER
+#        define AZOTEQ_IQS5XX_TOUCH_FINGERS 5
+#    else
+#        define AZOTEQ_IQS5XX_TOUCH_FINGERS 2
+#    endif
+#endif
+
+typedef struct PACKED {
+    azoteq_iqs5xx_base_data_t   base_data;
+    azoteq_iqs5xx_finger_data_t fingers[AZOTEQ_IQS5XX_TOUCH_FINGERS];
+} azoteq_iqs5xx_touch_data_t;
+
+_Static_assert(sizeof(azoteq_iqs5xx_touch_data_t) == 10 + 7 * AZOTEQ_IQS5XX_TOUCH_FINGERS, "azoteq_iqs5xx_touch_data_t should hold the base data and the fingers");
+
 typedef struct PACKED {
     bool sw_input : 1;
     bool sw_input_select : 1;
@@ -189,6 +218,7 @@ i2c_status_t   azoteq_iqs5xx_set_gesture_config(bool end_session);
 i2c_status_t   azoteq_iqs5xx_set_xy_config(bool flip_x, bool flip_y, bool switch_xy, bool palm_reject, bool end_session);
 i2c_status_t   azoteq_iqs5xx_reset_suspend(bool reset, bool suspend, bool end_session);
 i2c_status_t   azoteq_iqs5xx_get_base_data(azoteq_iqs5xx_base_data_t *base_data);
+i2c_status_t   azoteq_iqs5xx_get_touch_data(azoteq_iqs5xx_touch_data_t *touch_data);
 void           azoteq_iqs5xx_set_cpi(uint16_t cpi);
 uint16_t       azoteq_iqs5xx_get_cpi(void);
 uint16_t       azoteq_iqs5xx_get_product(void);
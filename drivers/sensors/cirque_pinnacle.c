@@ -386,7 +386,7 @@ report_mouse_t cirque_pinnacle_get_report(report_mouse_t mouse_report) {
     mouse_xy_report_t report_x = 0, report_y = 0;
     static uint16_t   x = 0, y = 0, last_scale = 0;
 
-#    if defined(CIRQUE_PINNACLE_TAP_ENABLE)
+#    if defined(CIRQUE_PINNACLE_TAP_ENABLE) && !defined(POINTING_DEVICE_GESTURES_TOUCH_ENABLE)
     mouse_report.buttons = pointing_device_handle_buttons(mouse_report.buttons, false, POINTING_DEVICE_BUTTON1);
 #    endif
 #    ifdef POINTING_DEVICE_GESTURES_CURSOR_GLIDE_ENABLE
@@ -419,7 +419,17 @@ report_mouse_t cirque_pinnacle_get_report(report_mouse_t mouse_report) {
     // Scale coordinates to arbitrary X, Y resolution
     cirque_pinnacle_scale_data(&touchData, scale, scale);
 
-    if (!cirque_pinnacle_gestures(&mouse_report, touchData)) {
+#    ifdef POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+    // The Pinnacle tracks a single finger, which still gives taps
+    touch_sample_t sample = {.time = timer_read(), .fingers = touchData.touchDown, .contacts = {{touchData.xValue, touchData.yValue}}};
+    touch_gesture_record(&sample);
+    // The recognizer reports taps and scrolls from the samples, the trackpad gestures would report them twice
+    bool suppress_mouse_update = false;
+#    else
+    bool suppress_mouse_update = cirque_pinnacle_gestures(&mouse_report, touchData);
+#    endif
+
+    if (!suppress_mouse_update) {
         if (last_scale && scale == last_scale && x && y && touchData.xValue && touchData.yValue) {
             report_x = CONSTRAIN_HID_XY((int16_t)(touchData.xValue - x));
             report_y = CONSTRAIN_HID_XY((int16_t)(touchData.yValue - y));
@@ -43,7 +43,7 @@
 #    ifndef CIRQUE_PINNACLE_Y_RANGE
 #        define CIRQUE_PINNACLE_Y_RANGE (CIRQUE_PINNACLE_Y_UPPER - CIRQUE_PINNACLE_Y_LOWER)
 #    endif
-#    if defined(POINTING_DEVICE_GESTURES_SCROLL_ENABLE)
+#    if defined(POINTING_DEVICE_GESTURES_SCROLL_ENABLE) && !defined(POINTING_DEVICE_GESTURES_TOUCH_ENABLE)
 #        define CIRQUE_PINNACLE_CIRCULAR_SCROLL_ENABLE
 #    endif
 #else
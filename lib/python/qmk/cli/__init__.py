@@ -59,6 +59,7 @@ subcommands = [
     'qmk.cli.generate.keycodes',
     'qmk.cli.generate.keycodes_tests',
     'qmk.cli.generate.keymap_h',
+    'qmk.cli.generate.leader_data',
     'qmk.cli.generate.make_dependencies',
     'qmk.cli.generate.rgb_breathe_table',
     'qmk.cli.generate.rules_mk',
@@ -16,6 +16,9 @@ This program reads from a prepared dictionary file and generates a C source file
 "autocorrect_data.h" with a serialized trie embedded as an array. Run this
 program and pass it as the first argument like:
 $ qmk generate-autocorrect-data autocorrect_dict.txt
+By default the trie is written in forward order, which autocorrect matches
+incrementally as keys are typed. Pass `--format reversed` for the original
+reversed trie.
 Each line of the dict file defines one typo and its correction with the syntax
 "typo -> correction". Blank lines or lines starting with '#' are ignored.
 Example:
@@ -43,6 +46,12 @@ KC_A = 4
 KC_SPC = 0x2c
 KC_QUOT = 0x34
 
+# Marks the end of a chain in the forward trie whose child is linked rather than following it
+CHAIN_LINK = 0xC0
+
+# Largest node link scale of the forward trie, links address (0xFFFF << MAX_LINK_SHIFT) bytes
+MAX_LINK_SHIFT = 3
+
 TYPO_CHARS = dict([
     ("'", KC_QUOT),
     (':', KC_SPC),  # "Word break" character.
@@ -107,17 +116,18 @@ def parse_file(file_name: str) -> List[Tuple[str, str]]:
     return autocorrections
 
 
-def make_trie(autocorrections: List[Tuple[str, str]]) -> Dict[str, Any]:
-    """Makes a trie from the the typos, writing in reverse.
+def make_trie(autocorrections: List[Tuple[str, str]], reverse: bool = True) -> Dict[str, Any]:
+    """Makes a trie from the the typos, writing in reverse unless `reverse` is False.
   Args:
     autocorrections: List of (typo, correction) tuples.
+    reverse: Whether the typos are written from their last letter.
   Returns:
     Dict of dict, representing the trie.
   """
     trie = {}
     for typo, correction in autocorrections:
         node = trie
-        for letter in typo[::-1]:
+        for letter in (typo[::-1] if reverse else typo):
             node = node.setdefault(letter, {})
         node['LEAF'] = (typo, correction)
 
@@ -178,19 +188,7 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     # Traverse trie in depth first order.
     def traverse(trie_node):
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
-            entry = {'data': data, 'links': [], 'byte_offset': 0}
+            entry = {'data': make_leaf_data(*trie_node['LEAF']), 'links': [], 'byte_offset': 0}
             table.append(entry)
         elif len(trie_node) == 1:  # Handle trie node with a single child.
             c, trie_node = next(iter(trie_node.items()))
@@ -232,6 +230,128 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
+def make_leaf_data(typo: str, correction: str) -> List[int]:
+    """Makes the data of a leaf node, the backspaces to type and the text replacing them.
+  Args:
+    typo: The typo of the leaf.
+    correction: What the typo corrects to.
+  Returns:
+    List of ints in the range 0-255.
+  """
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    return [backspaces + 128] + list(bytes(correction[i:], 'ascii')) + [0]
+
+
+def serialize_forward_trie(trie: Dict[str, Any]) -> Tuple[List[int], int]:
+    """Serializes a forward trie, made with `make_trie(autocorrections, reverse=False)`.
+  Identical subtrees, such as shared word endings with the same correction, are
+  serialized once. The nodes are encoded as in the reversed trie, except that
+  chains are written from the root, and a chain whose child is stored elsewhere
+  ends with CHAIN_LINK and a link instead of a zero byte. Links are 16-bit, and
+  count in units of (1 << link_shift) bytes so that large tries stay addressable.
+  Args:
+    trie: Dict of dicts.
+  Returns:
+    Tuple of the list of ints in the range 0-255, and the link shift.
+  """
+    nodes = []  # Unique nodes, as (leaf data, [(char, node id)]) tuples.
+    node_ids = {}
+
+    def intern(trie_node) -> int:
+        if 'LEAF' in trie_node:
+            node = (tuple(make_leaf_data(*trie_node['LEAF'])), ())
+        else:
+            node = (None, tuple((c, intern(trie_node[c])) for c in sorted(trie_node.keys())))
+        if node not in node_ids:
+            node_ids[node] = len(nodes)
+            nodes.append(node)
+        return node_ids[node]
+
+    root = intern(trie)
+
+    references = [0] * len(nodes)
+    for _, children in nodes:
+        for _, child in children:
+            references[child] += 1
+
+    # Lay out the nodes depth first, as items of bytes and node links.
+    items = []  # ('node', id) | ('bytes', [...]) | ('link', id)
+    emitted = set()
+
+    def emit(node_id):
+        emitted.add(node_id)
+        items.append(('node', node_id))
+        data, children = nodes[node_id]
+        if data is not None:
+            items.append(('bytes', list(data)))
+        elif len(children) == 1:
+            # Follow the chain for as long as nothing else links into it.
+            chars = []
+            while len(children) == 1:
+                c, child = children[0]
+                chars.append(TYPO_CHARS[c])
+                _, grandchildren = nodes[child]
+                if references[child] != 1 or len(grandchildren) != 1:
+                    break
+                children = grandchildren
+            items.append(('bytes', chars))
+            if child in emitted:
+                items.append(('bytes', [CHAIN_LINK]))
+                items.append(('link', child))
+            else:
+                items.append(('bytes', [0]))
+                emit(child)
+        else:
+            for i, (c, child) in enumerate(children):
+                items.append(('bytes', [TYPO_CHARS[c] | (64 if i == 0 else 0)]))
+                items.append(('link', child))
+            items.append(('bytes', [0]))
+            for _, child in children:
+                if child not in emitted:
+                    emit(child)
+
+    emit(root)
+
+    linked = set(node_id for kind, node_id in items if kind == 'link')
+
+    for link_shift in range(MAX_LINK_SHIFT + 1):
+        # Linked nodes start on a multiple of the link scale, padded with zero bytes which the decoder skips.
+        alignment = 1 << link_shift
+        offsets = {}
+        offset = 0
+        for kind, value in items:
+            if kind == 'node':
+                if value in linked:
+                    offset += -offset % alignment
+                offsets[value] = offset
+            else:
+                offset += 2 if kind == 'link' else len(value)
+
+        if all((offsets[node_id] >> link_shift) <= 0xffff for node_id in linked):
+            break
+    else:
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds %dKB. Try reducing the autocorrection dict to fewer entries.', (0x10000 << MAX_LINK_SHIFT) // 1024)
+        maybe_exit(1)
+
+    data = []
+    for kind, value in items:
+        if kind == 'node':
+            data += [0] * (offsets[value] - len(data))
+        elif kind == 'link':
+            link = offsets[value] >> link_shift
+            data += [link & 255, link >> 8]
+        else:
+            data += value
+
+    return data, link_shift
+
+
 def encode_link(link: Dict[str, Any]) -> List[int]:
     """Encodes a node link as two bytes."""
     byte_offset = link['byte_offset']
@@ -250,6 +370,7 @@ def to_hex(b: int) -> str:
 
 
 @cli.argument('filename', type=normpath, help='The autocorrection database file')
+@cli.argument('-f', '--format', arg_only=True, choices=['forward', 'reversed'], default='forward', help='The trie format. "forward" is matched incrementally and shares common endings, "reversed" is the original format.')
 @cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
@@ -257,8 +378,12 @@ def to_hex(b: int) -> str:
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
-    trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    if cli.args.format == 'reversed':
+        trie = make_trie(autocorrections)
+        data = serialize_trie(autocorrections, trie)
+    else:
+        trie = make_trie(autocorrections, reverse=False)
+        data, link_shift = serialize_forward_trie(trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -282,6 +407,9 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    if cli.args.format == 'forward':
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_FORWARD_TRIE')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_LINK_SHIFT {link_shift}')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
@@ -0,0 +1,163 @@
+"""Used by the make system to generate leader_data.h from keymap.json
+"""
+import textwrap
+
+from argcomplete.completers import FilesCompleter
+
+from milc import cli
+
+import qmk.path
+from qmk.commands import dump_lines
+from qmk.commands import parse_configurator_json
+from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
+from qmk.util import maybe_exit
+
+# Must match the size of the sequence buffer in quantum/leader.c
+LEADER_SEQUENCE_MAX_LENGTH = 5
+
+# Set in a node header when a sequence ends at that node
+LEADER_TRIE_TERMINAL = 0x8000
+
+
+def _strip_any(keycode):
+    """Remove ANY() from a keycode.
+    """
+    if keycode.startswith('ANY(') and keycode.endswith(')'):
+        keycode = keycode[4:-1]
+
+    return keycode
+
+
+def parse_sequences(keymap_json):
+    """Validates the leader sequences of a keymap, returning a list of (sequence, keycode) tuples.
+    """
+    sequences = []
+    seen = set()
+
+    for index, item in enumerate(keymap_json.get('leader_sequences', [])):
+        sequence = tuple(_strip_any(kc) for kc in item['sequence'])
+        keycode = _strip_any(item.get('keycode', 'KC_NO'))
+
+        if sequence in seen:
+            cli.log.error('{fg_red}Error:{fg_reset} Leader sequence %d duplicates an earlier one: {fg_cyan}%s', index, ', '.join(sequence))
+            maybe_exit(1)
+        if len(sequence) > LEADER_SEQUENCE_MAX_LENGTH:
+            cli.log.error('{fg_red}Error:{fg_reset} Leader sequence %d is longer than %d keys: {fg_cyan}%s', index, LEADER_SEQUENCE_MAX_LENGTH, ', '.join(sequence))
+            maybe_exit(1)
+
+        seen.add(sequence)
+        sequences.append((sequence, keycode))
+
+    return sequences
+
+
+def make_trie(sequences):
+    """Makes a trie from the sequences, with each leaf holding the index of its sequence.
+    """
+    trie = {}
+    for index, (sequence, _) in enumerate(sequences):
+        node = trie
+        for keycode in sequence:
+            node = node.setdefault(keycode, {})
+        node['LEAF'] = index
+
+    return trie
+
+
+def serialize_trie(trie):
+    """Serializes the trie into the 16-bit words read by quantum/leader.c.
+
+    Each node starts with a header holding its number of children, with `LEADER_TRIE_TERMINAL` set when a sequence
+    ends there, in which case the sequence index follows. Then come pairs of child keycode and child node offset.
+    Nodes are laid out depth first, the root being at offset zero.
+    """
+    table = []
+
+    def traverse(node):
+        children = [(keycode, child) for keycode, child in node.items() if keycode != 'LEAF']
+        entry = {'node': node, 'children': children, 'links': [], 'offset': 0}
+        table.append(entry)
+        entry['links'] = [traverse(child) for _, child in children]
+        return entry
+
+    traverse(trie)
+
+    def size(e):
+        return 1 + ('LEAF' in e['node']) + 2 * len(e['children'])
+
+    offset = 0
+    for e in table:
+        e['offset'] = offset
+        offset += size(e)
+
+    if offset > 0xFFFF:
+        cli.log.error('{fg_red}Error:{fg_reset} The leader sequence table is too large, try reducing the number of sequences.')
+        maybe_exit(1)
+
+    data = []
+    for e in table:
+        header = len(e['children'])
+        if 'LEAF' in e['node']:
+            data.append(f'0x{header | LEADER_TRIE_TERMINAL:04X}')
+            data.append(str(e['node']['LEAF']))
+        else:
+            data.append(f'0x{header:04X}')
+        for (keycode, _), link in zip(e['children'], e['links']):
+            data.append(keycode)
+            data.append(str(link['offset']))
+
+    return data
+
+
+def generate_leader_data_lines(sequences):
+    """Returns the lines of leader_data.h for the provided sequences.
+    """
+    lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#pragma once', '']
+
+    if not sequences:
+        return lines
+
+    data = serialize_trie(make_trie(sequences))
+
+    lines.append(f'// Leader sequences ({len(sequences)} entries):')
+    for index, (sequence, keycode) in enumerate(sequences):
+        lines.append(f'//   {index}: {", ".join(sequence)} -> {keycode}')
+
+    lines.append('')
+    lines.append('// Sequences may use the keycodes declared by the keymap')
+    lines.append('#if __has_include("keymap.h")')
+    lines.append('#    include "keymap.h"')
+    lines.append('#endif')
+    lines.append('')
+    lines.append('#define LEADER_TRIE_ENABLE')
+    lines.append(f'#define LEADER_SEQUENCE_COUNT {len(sequences)}')
+    lines.append(f'#define LEADER_TRIE_SIZE {len(data)}')
+    lines.append('')
+    lines.append('// clang-format off')
+    lines.append('static const uint16_t leader_trie[LEADER_TRIE_SIZE] PROGMEM = {')
+    lines.append(textwrap.fill('    %s' % (', '.join(data)), width=120, subsequent_indent='    ', break_on_hyphens=False))
+    lines.append('};')
+    lines.append('')
+    lines.append('static const uint16_t leader_sequence_keycodes[LEADER_SEQUENCE_COUNT] PROGMEM = {')
+    lines.append(textwrap.fill('    %s' % (', '.join(keycode for _, keycode in sequences)), width=120, subsequent_indent='    ', break_on_hyphens=False))
+    lines.append('};')
+    lines.append('// clang-format on')
+
+    return lines
+
+
+@cli.argument('-o', '--output', arg_only=True, type=qmk.path.normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('filename', type=qmk.path.FileType('r'), arg_only=True, completer=FilesCompleter('.json'), help='Configurator JSON file')
+@cli.subcommand('Creates a leader_data.h from the leader sequences of a QMK Configurator export.')
+def generate_leader_data(cli):
+    """Creates a leader_data.h from the leader sequences of a QMK Configurator export
+    """
+    if cli.args.output and cli.args.output.name == '-':
+        cli.args.output = None
+
+    keymap_json = parse_configurator_json(cli.args.filename)
+
+    sequences = parse_sequences(keymap_json)
+
+    dump_lines(cli.args.output, generate_leader_data_lines(sequences), cli.args.quiet)
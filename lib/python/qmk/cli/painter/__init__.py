@@ -1,2 +1,3 @@
 from . import convert_graphics
+from . import make_asset_store
 from . import make_font
@@ -0,0 +1,39 @@
+"""This script packs QGF/QFF files into an asset store image for external flash.
+"""
+from qmk.path import normpath
+from qmk.painter import build_asset_store
+from milc import cli
+
+
+@cli.argument('-o', '--output', required=True, help='Specify output asset store file.')
+@cli.argument('-n', '--name-length', default=16, type=int, help='Specify the size of the name field in the asset index. Default 16.')
+@cli.argument('inputs', nargs='+', arg_only=True, help='QGF/QFF files to include. Assets are named after the file name without extensions, or can be named explicitly using NAME=FILE.')
+@cli.subcommand('Packs QGF/QFF files into a Quantum Painter asset store image')
+def painter_make_asset_store(cli):
+    """Creates an asset store image, suitable for writing to external flash and loading with `qp_load_image_asset()` / `qp_load_font_asset()`.
+    """
+    assets = {}
+    for spec in cli.args.inputs:
+        name, sep, filename = spec.partition('=')
+        if not sep:
+            filename = spec
+            name = normpath(filename).name.split('.')[0]
+
+        path = normpath(filename)
+        if not path.exists():
+            cli.log.error('Input file %s does not exist!', path)
+            return False
+        if name in assets:
+            cli.log.error('Duplicate asset name "%s"', name)
+            return False
+        assets[name] = path.read_bytes()
+
+    try:
+        out_bytes = build_asset_store(assets, cli.args.name_length)
+    except ValueError as e:
+        cli.log.error(str(e))
+        return False
+
+    output = normpath(cli.args.output)
+    output.write_bytes(out_bytes)
+    cli.log.info('Wrote %d assets (%d bytes) to %s', len(assets), len(out_bytes), output)
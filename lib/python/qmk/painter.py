@@ -122,14 +122,19 @@ def _render_image_metadata(metadata):
             if not v["delta"]:
                 continue
 
-            # Unpack rect's coords
-            l, t, r, b = v["delta_rect"]
-
-            delta_px = (r - l) * (b - t)
             px = size["width"] * size["height"]
 
-            # FIXME: May need need more chars here too
-            deltas.append(f"// Frame {i:3d}: ({l:3d}, {t:3d}) - ({r:3d}, {b:3d}) >> {delta_px:4d}/{px:4d} pixels ({100*delta_px/px:.2f}%)")
+            # Identical frames have no regions to redraw
+            if not v["delta_rects"]:
+                deltas.append(f"// Frame {i:3d}: unchanged >> {0:4d}/{px:4d} pixels ({0:.2f}%)")
+                continue
+
+            for l, t, r, b in v["delta_rects"]:
+                # Unpack rect's coords (inclusive)
+                delta_px = (r - l + 1) * (b - t + 1)
+
+                # FIXME: May need need more chars here too
+                deltas.append(f"// Frame {i:3d}: ({l:3d}, {t:3d}) - ({r:3d}, {b:3d}) >> {delta_px:4d}/{px:4d} pixels ({100*delta_px/px:.2f}%)")
 
         if deltas:
             lines.append("// Areas on delta frames")
@@ -454,3 +459,51 @@ def compress_bytes_qmk_rle(bytearray):
                 temp = []
                 repeat = False
     return output
+
+
+def decompress_bytes_qmk_rle(bytearray):
+    """Reverses `compress_bytes_qmk_rle()`, see the QMK RLE format description in the docs.
+    """
+    output = []
+    n = 0
+    while n < len(bytearray):
+        marker = bytearray[n]
+        n += 1
+        if marker >= 128:
+            # Non-repeating run of (marker - 127) bytes
+            count = marker - 127
+            output.extend(bytearray[n:n + count])
+            n += count
+        else:
+            # Repeating run of a single byte
+            output.extend([bytearray[n]] * marker)
+            n += 1
+    return output
+
+
+def build_asset_store(assets, name_length=16):
+    """Packs named QGF/QFF blobs into a Quantum Painter asset store, see `qp_asset_store.h` for the layout.
+
+    `assets` is a dict of name to bytes. The index is sorted by name so that the firmware can binary search it.
+    """
+    if not 0 < name_length < 256:
+        raise ValueError(f'Asset name length must be between 1 and 255, was {name_length}')
+    if len(assets) > 0xFFFF:
+        raise ValueError(f'Too many assets ({len(assets)}), the maximum is 65535')
+
+    names = sorted(assets.keys(), key=lambda n: n.encode('utf-8'))
+    header = bytes([0x51, 0x50, 0x41, 0x01]) + len(names).to_bytes(2, 'little') + bytes([name_length, 0x00])
+
+    index = bytearray()
+    data = bytearray()
+    offset = len(header) + len(names) * (name_length + 8)
+    for name in names:
+        encoded = name.encode('utf-8')
+        if len(encoded) == 0 or len(encoded) > name_length or b'\0' in encoded:
+            raise ValueError(f'Asset name "{name}" must be between 1 and {name_length} bytes long')
+        index += encoded.ljust(name_length, b'\0')
+        index += (offset + len(data)).to_bytes(4, 'little')
+        index += len(assets[name]).to_bytes(4, 'little')
+        data += assets[name]
+
+    return header + bytes(index) + bytes(data)
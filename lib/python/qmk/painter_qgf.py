@@ -176,33 +176,31 @@ class QGFFramePaletteDescriptorV1:
 
 class QGFFrameDeltaDescriptorV1:
     type_id = 0x04
-    length = 8
+    rect_length = 8
 
     def __init__(self):
         self.header = QGFBlockHeader()
         self.header.type_id = QGFFrameDeltaDescriptorV1.type_id
-        self.header.length = QGFFrameDeltaDescriptorV1.length
-        self.left = 0
-        self.top = 0
-        self.right = 0
-        self.bottom = 0
+        self.rects = []
 
     def write(self, fp):
+        self.header.length = len(self.rects) * QGFFrameDeltaDescriptorV1.rect_length
         self.header.write(fp)
-        fp.write(b''  # start off with empty bytes...
-                 + o16(self.left)  # left
-                 + o16(self.top)  # top
-                 + o16(self.right)  # right
-                 + o16(self.bottom)  # bottom
-                 )
+        for left, top, right, bottom in self.rects:
+            fp.write(b''  # start off with empty bytes...
+                     + o16(left)  # left
+                     + o16(top)  # top
+                     + o16(right)  # right
+                     + o16(bottom)  # bottom
+                     )
 
     @property
     def bbox(self):
-        return self.left, self.top, self.right, self.bottom
+        return self.rects[0] if self.rects else None
 
     @bbox.setter
     def bbox(self, bbox):
-        self.left, self.top, self.right, self.bottom = bbox
+        self.rects = [tuple(bbox)]
 
 
 ########################################################################################################################
@@ -260,6 +258,58 @@ def _for_all_frames(x: FunctionType, /, images):
             frame_num += 1
 
 
+def _find_change_rects(frame, last_frame, *, format_):
+    """Works out the set of rectangles which cover the pixels that changed since the last frame.
+
+    Returns an empty list if the frames are identical, otherwise a list of inclusive `(left, top, right, bottom)` tuples.
+    """
+    diff = ImageChops.difference(frame, last_frame)
+    if not diff.getbbox():
+        return []
+
+    # Group consecutive changed rows into horizontal bands, each spanning the columns changed within it
+    width, height = frame.size
+    bands = []
+    for y in range(height):
+        span = diff.crop((0, y, width, y + 1)).getbbox()
+        if not span:
+            continue
+        left, right = span[0], span[2] - 1
+        if bands and bands[-1][3] == y - 1:
+            l, t, r, _ = bands[-1]
+            bands[-1] = (min(l, left), t, max(r, right), y)
+        else:
+            bands.append((left, y, right, y))
+
+    # Merge neighbouring bands whenever redrawing the gap between them is cheaper than the overhead of another rect
+    def rect_bytes(rect):
+        return ((rect[2] - rect[0] + 1) * (rect[3] - rect[1] + 1) * format_['bpp'] + 7) // 8
+
+    rect_overhead = QGFFrameDeltaDescriptorV1.rect_length + QGFBlockHeader.block_size
+    rects = [bands[0]]
+    for band in bands[1:]:
+        last = rects[-1]
+        merged = (min(last[0], band[0]), last[1], max(last[2], band[2]), band[3])
+        if rect_bytes(merged) <= rect_bytes(last) + rect_bytes(band) + rect_overhead:
+            rects[-1] = merged
+        else:
+            rects.append(band)
+
+    return rects
+
+
+def _encode_rects(converted, rects, *, use_rle, format_):
+    """Converts each of the supplied rects of an already-converted frame to bytes.
+
+    All rects within a frame share the frame's compression scheme, so RLE is only used if it's smaller overall.
+    """
+    raw_data = [qmk.painter.convert_image_bytes(converted.crop((l, t, r + 1, b + 1)), format_)[1] for l, t, r, b in rects]
+    if use_rle:
+        rle_data = [qmk.painter.compress_bytes_qmk_rle(data) for data in raw_data]
+    use_raw = not use_rle or sum(map(len, raw_data)) <= sum(map(len, rle_data))
+    return (raw_data if use_raw else rle_data), use_raw
+
+
 def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwargs):
     # Convert the original frame so we can do comparisons
     converted = qmk.painter.convert_requested_format(frame, format_)
@@ -270,55 +320,31 @@ def _compress_image(frame, last_frame, *, use_rle, use_deltas, format_, **_kwarg
     if use_rle:
         rle_data = qmk.painter.compress_bytes_qmk_rle(graphic_data[1])
     use_raw_this_frame = not use_rle or len(raw_data) <= len(rle_data)
-    image_data = raw_data if use_raw_this_frame else rle_data
+    image_data = [raw_data if use_raw_this_frame else rle_data]
 
     # Work out if a delta frame is smaller than injecting it directly
     use_delta_this_frame = False
-    bbox = None
+    rects = None
     if use_deltas and last_frame is not None:
-        # If we want to use deltas, then find the difference
-        diff = ImageChops.difference(frame, last_frame)
-
-        # Get the bounding box of those differences
-        bbox = diff.getbbox()
-
-        # If we have a valid bounding box...
-        if bbox:
-            # ...create the delta frame by cropping the original.
-            delta_frame = frame.crop(bbox)
-
-            # Convert the delta frame to the requested format
-            delta_converted = qmk.painter.convert_requested_format(delta_frame, format_)
-            delta_graphic_data = qmk.painter.convert_image_bytes(delta_converted, format_)
-
-            # Work out how large the delta frame is going to be with compression etc.
-            delta_raw_data = delta_graphic_data[1]
-            if use_rle:
-                delta_rle_data = qmk.painter.compress_bytes_qmk_rle(delta_graphic_data[1])
-            delta_use_raw_this_frame = not use_rle or len(delta_raw_data) <= len(delta_rle_data)
-            delta_image_data = delta_raw_data if delta_use_raw_this_frame else delta_rle_data
-
-            # If the size of the delta frame (plus delta descriptor) is smaller than the original, use that instead
-            # This ensures that if a non-delta is overall smaller in size, we use that in preference due to flash
-            # sizing constraints.
-            if (len(delta_image_data) + QGFFrameDeltaDescriptorV1.length) < len(image_data):
-                # Copy across all the delta equivalents so that the rest of the processing acts on those
-                graphic_data = delta_graphic_data
-                raw_data = delta_raw_data
-                rle_data = delta_rle_data
-                use_raw_this_frame = delta_use_raw_this_frame
-                image_data = delta_image_data
-                use_delta_this_frame = True
-
-        # Default to whole image
-        bbox = bbox or [0, 0, *frame.size]
-        # Fix sze (as per #20296), we need to cast first as tuples are inmutable
-        bbox = list(bbox)
-        bbox[2] -= 1
-        bbox[3] -= 1
+        # Find the regions which differ from the previous frame -- an identical frame has no regions at all, and
+        # results in a delta frame with nothing to draw.
+        rects = _find_change_rects(frame, last_frame, format_=format_)
+
+        # Crop the regions out of the converted frame, so that they all share the frame's palette
+        delta_image_data, delta_use_raw_this_frame = _encode_rects(converted, rects, use_rle=use_rle, format_=format_)
+
+        # If the size of the delta frame (plus delta rects and extra data blocks) is smaller than the original, use
+        # that instead. This ensures that if a non-delta is overall smaller in size, we use that in preference due to
+        # flash sizing constraints.
+        delta_size = sum(len(data) + QGFFrameDeltaDescriptorV1.rect_length + QGFBlockHeader.block_size for data in delta_image_data)
+        if delta_size < len(image_data[0]):
+            # Copy across all the delta equivalents so that the rest of the processing acts on those
+            use_raw_this_frame = delta_use_raw_this_frame
+            image_data = delta_image_data
+            use_delta_this_frame = True
 
     return {
-        "bbox": bbox,
+        "rects": rects,
         "graphic_data": graphic_data,
         "image_data": image_data,
         "use_delta_this_frame": use_delta_this_frame,
@@ -334,7 +360,7 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
 
     # (potentially) Apply RLE and/or delta, and work out output image's information
     outputs = _compress_image(frame, last_frame, **kwargs)
-    bbox = outputs["bbox"]
+    rects = outputs["rects"]
     graphic_data = outputs["graphic_data"]
     image_data = outputs["image_data"]
     use_delta_this_frame = outputs["use_delta_this_frame"]
@@ -363,9 +389,9 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
 
     # Write out the delta info if required
     if use_delta_this_frame:
-        # Set up the rendering location of where the delta frame should be situated
+        # Set up the rendering locations of where each of the delta regions should be situated
         delta_descriptor = QGFFrameDeltaDescriptorV1()
-        delta_descriptor.bbox = bbox
+        delta_descriptor.rects = rects
 
         # Write the delta frame to the output
         vprint(f'{f"Frame {idx:3d} delta":26s} {fp.tell():5d}d / {fp.tell():04X}h')
@@ -378,19 +404,15 @@ def _write_frame(idx, frame, last_frame, *, fp, frame_offsets, metadata, **kwarg
         "delay": frame_descriptor.delay,
     }
     if frame_metadata["delta"]:
-        frame_metadata.update({"delta_rect": [
-            delta_descriptor.left,
-            delta_descriptor.top,
-            delta_descriptor.right,
-            delta_descriptor.bottom,
-        ]})
+        frame_metadata.update({"delta_rects": [list(rect) for rect in delta_descriptor.rects]})
     metadata.append(frame_metadata)
 
-    # Write out the data for this frame to the output
-    data_descriptor = QGFFrameDataDescriptorV1()
-    data_descriptor.data = image_data
-    vprint(f'{f"Frame {idx:3d} data":26s} {fp.tell():5d}d / {fp.tell():04X}h')
-    data_descriptor.write(fp)
+    # Write out the data for this frame to the output -- delta frames have one data block per region
+    for data in image_data:
+        data_descriptor = QGFFrameDataDescriptorV1()
+        data_descriptor.data = data
+        vprint(f'{f"Frame {idx:3d} data":26s} {fp.tell():5d}d / {fp.tell():04X}h')
+        data_descriptor.write(fp)
 
 
 def _save(im, fp, _filename):
@@ -317,6 +317,17 @@ def test_generate_version_h():
     assert '#define QMK_VERSION' in result.stdout
 
 
+def test_generate_leader_data():
+    result = check_subcommand('generate-leader-data', 'lib/python/qmk/tests/leader_keymap.json')
+    check_returncode(result)
+    assert '#define LEADER_SEQUENCE_COUNT 3' in result.stdout
+    assert '#define LEADER_TRIE_SIZE 16' in result.stdout
+    # The root branches to KC_A and KC_C, KC_A ends sequence 0 and branches to KC_B, which ends sequence 1, and KC_C
+    # branches to KC_D, which ends sequence 2
+    assert '    0x0002, KC_A, 5, KC_C, 11, 0x8001, 0, KC_B, 9, 0x8000, 1, 0x0001, KC_D, 14, 0x8000, 2\n' in result.stdout
+    assert '    KC_1, KC_2, KC_3\n' in result.stdout
+
+
 def test_format_json_keyboard():
     result = check_subcommand('format-json', '--format', 'keyboard', 'lib/python/qmk/tests/minimal_info.json')
     check_returncode(result)
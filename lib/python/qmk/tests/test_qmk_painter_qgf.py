@@ -0,0 +1,149 @@
+from io import BytesIO
+import struct
+
+from PIL import Image, ImageDraw
+
+import qmk.painter
+import qmk.painter_qgf  # noqa: F401 -- registers the QGF format with PIL
+
+
+def _read_block(data, offset, expected_type_id):
+    type_id, neg_type_id, length_lo, length_hi = struct.unpack_from('<BBHB', data, offset)
+    assert type_id == expected_type_id
+    assert neg_type_id == (~expected_type_id) & 0xFF
+    offset += 5
+    length = length_lo | (length_hi << 16)
+    return data[offset:offset + length], offset + length
+
+
+def _unpack_pixels(data, pixel_count, format_):
+    if format_['bpp'] > 8:
+        bytes_per_pixel = format_['bpp'] // 8
+        return [tuple(data[i:i + bytes_per_pixel]) for i in range(0, pixel_count * bytes_per_pixel, bytes_per_pixel)]
+    pixels_per_byte = 8 // format_['bpp']
+    mask = (1 << format_['bpp']) - 1
+    return [(data[i // pixels_per_byte] >> ((i % pixels_per_byte) * format_['bpp'])) & mask for i in range(pixel_count)]
+
+
+def _decode_qgf(data, format_):
+    """Replays the QGF frames onto a virtual panel, returning the panel contents after each frame along with the frame metadata."""
+    _, offset = _read_block(data, 0, 0x00)
+    width, height, frame_count = struct.unpack_from('<HHH', data, 17)
+    offsets, _ = _read_block(data, offset, 0x01)
+
+    panel = [None] * (width * height)
+    frames = []
+    for idx in range(frame_count):
+        offset = struct.unpack_from('<I', offsets, idx * 4)[0]
+        descriptor, offset = _read_block(data, offset, 0x02)
+        _, flags, compression, _, _ = struct.unpack('<BBBBH', descriptor)
+        is_delta = (flags & 0x02) == 0x02
+
+        if format_['has_palette']:
+            _, offset = _read_block(data, offset, 0x03)
+
+        rects = [(0, 0, width - 1, height - 1)]
+        if is_delta:
+            delta, offset = _read_block(data, offset, 0x04)
+            rects = [struct.unpack_from('<HHHH', delta, i) for i in range(0, len(delta), 8)]
+
+        for l, t, r, b in rects:
+            pixdata, offset = _read_block(data, offset, 0x05)
+            if compression == 0x01:
+                pixdata = qmk.painter.decompress_bytes_qmk_rle(pixdata)
+            pixels = _unpack_pixels(pixdata, (r - l + 1) * (b - t + 1), format_)
+            for n, px in enumerate(pixels):
+                x = l + n % (r - l + 1)
+                y = t + n // (r - l + 1)
+                panel[y * width + x] = px
+
+        frames.append({'panel': list(panel), 'delta': is_delta, 'rects': rects})
+    return frames
+
+
+def _expected_pixels(frame, format_):
+    converted = qmk.painter.convert_requested_format(frame, format_)
+    return _unpack_pixels(qmk.painter.convert_image_bytes(converted, format_)[1], frame.width * frame.height, format_)
+
+
+def _make_animation():
+    # Busy background, so that redrawing the whole frame doesn't compress well
+    base = Image.new('RGB', (32, 16))
+    base.putdata([(((x * 7 + y * 13) % 16) * 17, ) * 3 for y in range(16) for x in range(32)])
+
+    # Two separate small changes, far enough apart that they should end up in separate regions
+    two_regions = base.copy()
+    draw = ImageDraw.Draw(two_regions)
+    draw.rectangle((2, 1, 5, 3), fill=(255, 255, 255))
+    draw.rectangle((20, 12, 27, 14), fill=(128, 128, 128))
+
+    # An unchanged frame, followed by an entirely different one
+    unchanged = two_regions.copy()
+    inverted = Image.new('RGB', (32, 16), (255, 255, 255))
+    ImageDraw.Draw(inverted).line((0, 0, 31, 15), fill=(64, 64, 64))
+
+    return [base, two_regions, unchanged, inverted]
+
+
+def _roundtrip(frames, format_, **kwargs):
+    out = BytesIO()
+    frames[0].save(out, 'QGF', append_images=frames[1:], qmk_format=format_, **kwargs)
+    return _decode_qgf(out.getvalue(), format_)
+
+
+def test_qgf_delta_roundtrip_mono16():
+    format_ = qmk.painter.valid_formats['mono16']
+    frames = _make_animation()
+    decoded = _roundtrip(frames, format_, use_deltas=True, use_rle=True)
+
+    for frame, result in zip(frames, decoded):
+        assert result['panel'] == _expected_pixels(frame, format_)
+
+    # Separate changes get separate regions, unchanged frames don't redraw anything
+    assert decoded[1]['delta']
+    assert decoded[1]['rects'] == [(2, 1, 5, 3), (20, 12, 27, 14)]
+    assert decoded[2]['delta']
+    assert decoded[2]['rects'] == []
+
+
+def test_qgf_delta_roundtrip_rgb565_no_rle():
+    format_ = qmk.painter.valid_formats['rgb565']
+    frames = _make_animation()
+    decoded = _roundtrip(frames, format_, use_deltas=True, use_rle=False)
+
+    for frame, result in zip(frames, decoded):
+        assert result['panel'] == _expected_pixels(frame, format_)
+
+
+def test_qgf_no_deltas():
+    format_ = qmk.painter.valid_formats['mono4']
+    frames = _make_animation()
+    decoded = _roundtrip(frames, format_, use_deltas=False, use_rle=True)
+
+    for frame, result in zip(frames, decoded):
+        assert not result['delta']
+        assert result['panel'] == _expected_pixels(frame, format_)
+
+
+def test_rle_roundtrip():
+    data = [0, 0, 0, 0, 1, 2, 3, 4, 4, 4, 5] + list(range(200)) + [7] * 300
+    assert qmk.painter.decompress_bytes_qmk_rle(qmk.painter.compress_bytes_qmk_rle(data)) == data
+
+
+def test_asset_store_layout():
+    store = qmk.painter.build_asset_store({'zeta': b'\x01\x02\x03', 'alpha': b'\x04'}, name_length=8)
+
+    magic, version, count, name_length, reserved = struct.unpack_from('<3sBHBB', store, 0)
+    assert (magic, version, count, name_length, reserved) == (b'QPA', 1, 2, 8, 0)
+
+    entries = [struct.unpack_from('<8sII', store, 8 + i * 16) for i in range(count)]
+    assert [name.rstrip(b'\0') for name, _, _ in entries] == [b'alpha', b'zeta']
+    assert [store[offset:offset + length] for _, offset, length in entries] == [b'\x04', b'\x01\x02\x03']
+
+
+def test_asset_store_rejects_long_names():
+    try:
+        qmk.painter.build_asset_store({'much_too_long': b''}, name_length=8)
+    except ValueError:
+        return
+    assert False, 'expected ValueError'
@@ -70,6 +70,9 @@ static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
 static void waiting_buffer_scan_tap(void);
+static bool waiting_buffer_lookahead(void);
+static bool tapping_key_progressed(const keyrecord_t *before);
+static void waiting_buffer_process(void);
 static void debug_tapping_key(void);
 static void debug_waiting_buffer(void);
 
@@ -85,12 +88,22 @@ void action_tapping_process(keyrecord_t record) {
             ac_dprintf("\n");
         }
     } else {
-        if (!waiting_buffer_enq(record)) {
-            // clear all in case of overflow.
-            ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
-            clear_keyboard();
-            waiting_buffer_clear();
-            tapping_key = (keyrecord_t){0};
+        while (!waiting_buffer_enq(record)) {
+            if (tapping_key.event.pressed && tapping_key.tap.count == 0) {
+                // The waiting keys can't wait any longer, settle the tapping key as held, as on timeout, so that
+                // they are processed rather than dropped along with the releases of keys already held
+                ac_dprintf("OVERFLOW: Tapping: End. Not tap(0)\n");
+                process_record(&tapping_key);
+                tapping_key = (keyrecord_t){0};
+                waiting_buffer_process();
+            } else {
+                // clear all in case of overflow.
+                ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
+                clear_keyboard();
+                waiting_buffer_clear();
+                tapping_key = (keyrecord_t){0};
+                break;
+            }
         }
     }
 
@@ -98,18 +111,31 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    waiting_buffer_process();
+    if (IS_EVENT(record.event)) {
+        ac_dprintf("\n");
+    }
+}
+
+/** \brief Waiting buffer process
+ *
+ * Processes the waiting events in order, for as long as the tapping key lets them through.
+ */
+static void waiting_buffer_process(void) {
+    while (waiting_buffer_tail != waiting_buffer_head) {
+        const keyrecord_t before = tapping_key;
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
             ac_dprintf("\n\n");
+            waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        } else if (tapping_key_progressed(&before) || waiting_buffer_lookahead()) {
+            // The tapping key was settled, so the same record may now be processed
+            continue;
         } else {
             break;
         }
     }
-    if (IS_EVENT(record.event)) {
-        ac_dprintf("\n");
-    }
 }
 
 /* Some conditionally defined helper macros to keep process_tapping more
@@ -476,6 +502,18 @@ bool waiting_buffer_typed(keyevent_t event) {
     return false;
 }
 
+/** \brief Waiting buffer has release
+ *
+ * Whether a release of the key is waiting to be processed. Until it is, the source layer cached for the key still
+ * belongs to the press being released.
+ */
+bool waiting_buffer_has_release(keypos_t key) {
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+        if (IS_EVENT(waiting_buffer[i].event) && KEYEQ(key, waiting_buffer[i].event.key) && !waiting_buffer[i].event.pressed) return true;
+    }
+    return false;
+}
+
 /** \brief Waiting buffer has anykey pressed
  *
  * FIXME: Needs docs
@@ -520,6 +558,61 @@ void waiting_buffer_scan_tap(void) {
     }
 }
 
+/** \brief Waiting buffer lookahead
+ *
+ * Settles the pending tapping key as held if a key typed within the waiting buffer interrupts it, rather than waiting
+ * for another event to arrive. Events are considered in the order they occurred. Return true if the tapping key was
+ * settled.
+ */
+bool waiting_buffer_lookahead(void) {
+    if (IS_NOEVENT(tapping_key.event) || !tapping_key.event.pressed || tapping_key.tap.count > 0) {
+        return false;
+    }
+
+#    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT)) || defined(PERMISSIVE_HOLD_PER_KEY)
+    TAP_DEFINE_KEYCODE;
+#    endif
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+        keyrecord_t *candidate = &waiting_buffer[i];
+        if (!IS_EVENT(candidate->event) || candidate->event.pressed) {
+            continue;
+        }
+        if (!(WITHIN_TAPPING_TERM(candidate->event) || MAYBE_RETRO_SHIFTING(candidate->event, candidate))) {
+            return false;
+        }
+
+        // The tapping key was released first, which is handled when processing the buffer in order
+        if (IS_TAPPING_RECORD(candidate)) {
+            return false;
+        }
+
+        // Same as the interrupting key typed check of process_tapping(), limited to the events preceding this one
+        bool typed = false;
+        for (uint8_t j = waiting_buffer_tail; j != i; j = (j + 1) % WAITING_BUFFER_SIZE) {
+            if (KEYEQ(candidate->event.key, waiting_buffer[j].event.key) && waiting_buffer[j].event.pressed) {
+                typed = true;
+                break;
+            }
+        }
+        if (typed && (TAP_GET_PERMISSIVE_HOLD || TAP_GET_RETRO_TAPPING(candidate))) {
+            ac_dprintf("Tapping: End. No tap. Interfered by typing key in waiting_buffer[%u]\n", i);
+            process_record(&tapping_key);
+            tapping_key = (keyrecord_t){0};
+            debug_tapping_key();
+            return true;
+        }
+    }
+    return false;
+}
+
+/** \brief Tapping key progressed
+ *
+ * Whether the tapping key was settled or replaced since `before` was taken, as opposed to merely being interrupted.
+ */
+bool tapping_key_progressed(const keyrecord_t *before) {
+    return !KEYEQ(before->event.key, tapping_key.event.key) || before->event.time != tapping_key.event.time || before->event.pressed != tapping_key.event.pressed || before->event.type != tapping_key.event.type || before->tap.count != tapping_key.tap.count;
+}
+
 /** \brief Tapping key debug print
  *
  * FIXME: Needs docs
@@ -38,6 +38,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 uint16_t get_record_keycode(keyrecord_t *record, bool update_layer_cache);
 uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache);
 void     action_tapping_process(keyrecord_t record);
+bool     waiting_buffer_has_release(keypos_t key);
 #endif
 
 uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record);
@@ -0,0 +1,162 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "analog_key.h"
+#include "util.h"
+
+#ifdef ANALOG_KEY_TRAVEL_CURVE
+static const analog_key_curve_point_t travel_curve[] = ANALOG_KEY_TRAVEL_CURVE;
+#endif
+
+/**
+ * @brief Starts the calibration of a key over, from a reading taken with the key up
+ *
+ * The range is reset to ANALOG_KEY_MIN_RANGE, and grows again as the key is bottomed out.
+ *
+ * @param[out] key analog_key_t
+ * @param[in] rest reading with the key up
+ */
+void analog_key_calibrate(analog_key_t *key, uint16_t rest) {
+    key->rest       = rest;
+    key->range      = ANALOG_KEY_MIN_RANGE;
+    key->bottom     = 0;
+    key->drift      = 0;
+    key->bottom_out = 0;
+    key->travel     = 0;
+    key->extreme    = 0;
+    key->pressed    = false;
+}
+
+/**
+ * @brief Travel at a position in the calibrated range, following the curve configured by ANALOG_KEY_TRAVEL_CURVE
+ *
+ * Sensors are seldom linear, a Hall effect sensor least of all. The curve interpolates linearly between its points,
+ * which are sorted by position, and from 0 and to ANALOG_KEY_TRAVEL_MAX beyond them. Without a curve the travel is the
+ * position.
+ *
+ * @param[in] position from 0 at rest to ANALOG_KEY_TRAVEL_MAX at bottom out
+ * @return travel
+ */
+uint8_t analog_key_curve(uint8_t position) {
+#ifdef ANALOG_KEY_TRAVEL_CURVE
+    analog_key_curve_point_t low = {0, 0};
+    for (uint8_t i = 0; i <= ARRAY_SIZE(travel_curve); i++) {
+        analog_key_curve_point_t high = i < ARRAY_SIZE(travel_curve) ? travel_curve[i] : (analog_key_curve_point_t){ANALOG_KEY_TRAVEL_MAX, ANALOG_KEY_TRAVEL_MAX};
+        if (position <= high.position) {
+            if (high.position == low.position) {
+                return high.travel;
+            }
+            return low.travel + ((int16_t)high.travel - low.travel) * (position - low.position) / (high.position - low.position);
+        }
+        low = high;
+    }
+    return ANALOG_KEY_TRAVEL_MAX;
+#else
+    return position;
+#endif
+}
+
+/**
+ * @brief Converts a reading to travel, updating the calibration of the key
+ *
+ * The calibration follows the sensor and magnet as they drift. Readings past the rest position move it at once. Readings
+ * within the deadzone move it a step toward them every ANALOG_KEY_DRIFT_READINGS in a row, slowly enough that the start
+ * of a press doesn't move it. The range widens once ANALOG_KEY_BOTTOM_OUT_READINGS readings in a row are past it, to
+ * the shallowest of them, so that a single noise spike doesn't widen it. It never narrows until the key is calibrated
+ * again.
+ *
+ * @param[in,out] key analog_key_t
+ * @param[in] reading raw sensor reading
+ * @return travel, from 0 to ANALOG_KEY_TRAVEL_MAX
+ */
+uint8_t analog_key_travel(analog_key_t *key, uint16_t reading) {
+#ifdef ANALOG_KEY_PRESSED_LOW
+    int32_t depth = (int32_t)key->rest - reading;
+#else
+    int32_t depth = (int32_t)reading - key->rest;
+#endif
+    if (depth < 0) {
+        key->rest = reading;
+        depth     = 0;
+    }
+
+    if (depth > key->range) {
+        if (key->bottom_out == 0 || depth < key->bottom) {
+            key->bottom = depth;
+        }
+        if (++key->bottom_out >= ANALOG_KEY_BOTTOM_OUT_READINGS) {
+            key->range      = key->bottom;
+            key->bottom_out = 0;
+        }
+    } else {
+        key->bottom_out = 0;
+    }
+
+    key->travel = analog_key_curve(MIN(depth, key->range) * ANALOG_KEY_TRAVEL_MAX / key->range);
+
+    if (depth > 0 && key->travel <= ANALOG_KEY_DEADZONE) {
+        if (++key->drift >= ANALOG_KEY_DRIFT_READINGS) {
+#ifdef ANALOG_KEY_PRESSED_LOW
+            key->rest--;
+#else
+            key->rest++;
+#endif
+            key->drift = 0;
+        }
+    } else {
+        key->drift = 0;
+    }
+
+    return key->travel;
+}
+
+/**
+ * @brief Updates the pressed state of a key from a reading
+ *
+ * Without rapid trigger, the key is pressed at the actuation point and released ANALOG_KEY_HYSTERESIS above it.
+ *
+ * With rapid trigger, the key is also released as soon as it travels release_sensitivity back up from the deepest point
+ * it reached, and pressed again as soon as it travels press_sensitivity down from the shallowest point it reached, as
+ * long as it is past the actuation point.
+ *
+ * Within ANALOG_KEY_DEADZONE of the top the key is always released.
+ *
+ * @param[in,out] key analog_key_t
+ * @param[in] config analog_key_config_t of the key
+ * @param[in] reading raw sensor reading
+ * @return whether the key is pressed
+ */
+bool analog_key_update(analog_key_t *key, const analog_key_config_t *config, uint16_t reading) {
+    int16_t travel = analog_key_travel(key, reading);
+
+    if (travel <= ANALOG_KEY_DEADZONE) {
+        key->pressed = false;
+        key->extreme = travel;
+    } else if (key->pressed) {
+        if (travel > key->extreme) {
+            key->extreme = travel;
+        }
+        bool release = travel + ANALOG_KEY_HYSTERESIS < config->actuation_point;
+        if (config->rapid_trigger && travel + config->release_sensitivity <= key->extreme) {
+            release = true;
+        }
+        if (release) {
+            key->pressed = false;
+            key->extreme = travel;
+        }
+    } else {
+        if (travel < key->extreme) {
+            key->extreme = travel;
+        }
+        bool press = travel >= config->actuation_point;
+        if (config->rapid_trigger && travel < key->extreme + config->press_sensitivity) {
+            press = false;
+        }
+        if (press) {
+            key->pressed = true;
+            key->extreme = travel;
+        }
+    }
+
+    return key->pressed;
+}
@@ -0,0 +1,104 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Hardware independent parts of the analog matrix
+ *
+ * Each key turns its sensor readings into travel, from 0 with the key up to ANALOG_KEY_TRAVEL_MAX at bottom out, and
+ * its travel into a pressed state, either at a fixed actuation point or with rapid trigger.
+ */
+
+#define ANALOG_KEY_TRAVEL_MAX 255
+
+/* travel from the top within which a key is always released */
+#ifndef ANALOG_KEY_DEADZONE
+#    define ANALOG_KEY_DEADZONE 8
+#endif
+/* travel back up past the actuation point that releases a key without rapid trigger */
+#ifndef ANALOG_KEY_HYSTERESIS
+#    define ANALOG_KEY_HYSTERESIS 8
+#endif
+/* difference of the readings between rest and bottom out, assumed until a key is bottomed out */
+#ifndef ANALOG_KEY_MIN_RANGE
+#    define ANALOG_KEY_MIN_RANGE 128
+#endif
+/* readings in a row within the deadzone that move the rest position a step toward them */
+#ifndef ANALOG_KEY_DRIFT_READINGS
+#    define ANALOG_KEY_DRIFT_READINGS 64
+#endif
+/* readings in a row past bottom out that widen the range */
+#ifndef ANALOG_KEY_BOTTOM_OUT_READINGS
+#    define ANALOG_KEY_BOTTOM_OUT_READINGS 4
+#endif
+/* define ANALOG_KEY_PRESSED_LOW for sensors whose readings fall as the key is pressed */
+
+#ifndef ANALOG_KEY_ACTUATION_POINT
+#    define ANALOG_KEY_ACTUATION_POINT 128
+#endif
+#ifndef ANALOG_KEY_PRESS_SENSITIVITY
+#    define ANALOG_KEY_PRESS_SENSITIVITY 16
+#endif
+#ifndef ANALOG_KEY_RELEASE_SENSITIVITY
+#    define ANALOG_KEY_RELEASE_SENSITIVITY 16
+#endif
+#ifdef ANALOG_KEY_RAPID_TRIGGER_ENABLE
+#    define ANALOG_KEY_RAPID_TRIGGER true
+#else
+#    define ANALOG_KEY_RAPID_TRIGGER false
+#endif
+
+#if ANALOG_KEY_MIN_RANGE < 1
+#    error "ANALOG_KEY_MIN_RANGE must be at least 1"
+#endif
+#if ANALOG_KEY_DEADZONE >= ANALOG_KEY_TRAVEL_MAX
+#    error "ANALOG_KEY_DEADZONE must be less than ANALOG_KEY_TRAVEL_MAX"
+#endif
+#if ANALOG_KEY_DRIFT_READINGS < 1 || ANALOG_KEY_DRIFT_READINGS > 255
+#    error "ANALOG_KEY_DRIFT_READINGS must be between 1 and 255"
+#endif
+#if ANALOG_KEY_BOTTOM_OUT_READINGS < 1 || ANALOG_KEY_BOTTOM_OUT_READINGS > 255
+#    error "ANALOG_KEY_BOTTOM_OUT_READINGS must be between 1 and 255"
+#endif
+
+typedef struct {
+    uint8_t actuation_point;     // travel at which the key is pressed
+    bool    rapid_trigger;       // press and release on the direction of travel past the actuation point
+    uint8_t press_sensitivity;   // travel down from the shallowest point since the release that presses the key again
+    uint8_t release_sensitivity; // travel up from the deepest point since the press that releases the key
+} analog_key_config_t;
+
+typedef struct {
+    uint16_t rest;       // reading with the key up
+    uint16_t range;      // difference of the readings between rest and bottom out
+    uint16_t bottom;     // shallowest of the readings in a row past the range, from rest
+    uint8_t  drift;      // readings in a row within the deadzone
+    uint8_t  bottom_out; // readings in a row past the range
+    uint8_t  travel;     // last travel
+    uint8_t  extreme;    // deepest travel since the press when pressed, shallowest since the release otherwise
+    bool     pressed;
+} analog_key_t;
+
+/* point of the travel curve: travel at a position in the calibrated range, both from 0 to ANALOG_KEY_TRAVEL_MAX */
+typedef struct {
+    uint8_t position;
+    uint8_t travel;
+} analog_key_curve_point_t;
+
+/* actuation point and rapid trigger settings from config.h */
+#define ANALOG_KEY_CONFIG_DEFAULT                              \
+    {                                                          \
+        .actuation_point     = ANALOG_KEY_ACTUATION_POINT,     \
+        .rapid_trigger       = ANALOG_KEY_RAPID_TRIGGER,       \
+        .press_sensitivity   = ANALOG_KEY_PRESS_SENSITIVITY,   \
+        .release_sensitivity = ANALOG_KEY_RELEASE_SENSITIVITY, \
+    }
+
+void    analog_key_calibrate(analog_key_t *key, uint16_t rest);
+uint8_t analog_key_curve(uint8_t position);
+uint8_t analog_key_travel(analog_key_t *key, uint16_t reading);
+bool    analog_key_update(analog_key_t *key, const analog_key_config_t *config, uint16_t reading);
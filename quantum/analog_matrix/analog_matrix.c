@@ -0,0 +1,178 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "analog_matrix.h"
+#include "analog.h"
+#include "matrix.h"
+#include "wait.h"
+#include "util.h"
+
+#ifdef SPLIT_KEYBOARD
+#    define ROWS_PER_HAND (MATRIX_ROWS / 2)
+#else
+#    define ROWS_PER_HAND (MATRIX_ROWS)
+#endif
+
+#ifndef ANALOG_MATRIX_MUX_SELECT_PINS
+#    error "ANALOG_MATRIX_MUX_SELECT_PINS is not defined"
+#endif
+#ifndef ANALOG_MATRIX_MUX_INPUT_PINS
+#    error "ANALOG_MATRIX_MUX_INPUT_PINS is not defined"
+#endif
+
+// Each multiplexer is a row of the matrix, each of its channels a column
+static const pin_t mux_select_pins[] = ANALOG_MATRIX_MUX_SELECT_PINS;
+static const pin_t mux_input_pins[]  = ANALOG_MATRIX_MUX_INPUT_PINS;
+
+_Static_assert(ARRAY_SIZE(mux_input_pins) == ROWS_PER_HAND, "ANALOG_MATRIX_MUX_INPUT_PINS must have one pin per matrix row");
+_Static_assert(MATRIX_COLS <= (1 << ARRAY_SIZE(mux_select_pins)), "ANALOG_MATRIX_MUX_SELECT_PINS can't select MATRIX_COLS channels");
+
+#ifdef __AVR__
+typedef uint8_t adc_input_t;
+#else
+typedef adc_mux adc_input_t;
+#endif
+
+// ADC inputs of the multiplexers, looked up once rather than on every reading
+static adc_input_t         mux_inputs[ROWS_PER_HAND];
+static analog_key_t        keys[ROWS_PER_HAND][MATRIX_COLS];
+static analog_key_config_t key_configs[ROWS_PER_HAND][MATRIX_COLS];
+
+static void select_channel(uint8_t channel) {
+    for (uint8_t i = 0; i < ARRAY_SIZE(mux_select_pins); i++) {
+        gpio_write_pin(mux_select_pins[i], channel & (1 << i));
+    }
+    if (ANALOG_MATRIX_SETTLE_TIME > 0) {
+        wait_us(ANALOG_MATRIX_SETTLE_TIME);
+    }
+}
+
+static inline uint16_t read_mux(uint8_t row) {
+    int16_t reading = adc_read(mux_inputs[row]);
+    return reading < 0 ? 0 : reading;
+}
+
+/**
+ * @brief Takes the rest position of every key from readings averaged over ANALOG_MATRIX_CALIBRATION_SAMPLES
+ *
+ * All keys have to be up. Bottom out is learned again as the keys are used.
+ */
+void analog_matrix_calibrate(void) {
+    uint32_t sums[ROWS_PER_HAND][MATRIX_COLS] = {0};
+
+    for (uint8_t sample = 0; sample < ANALOG_MATRIX_CALIBRATION_SAMPLES; sample++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            select_channel(col);
+            for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+                if (mux_input_pins[row] != NO_PIN) {
+                    sums[row][col] += read_mux(row);
+                }
+            }
+        }
+    }
+
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            analog_key_calibrate(&keys[row][col], sums[row][col] / ANALOG_MATRIX_CALIBRATION_SAMPLES);
+        }
+    }
+}
+
+/**
+ * @brief Gets the last travel of a key of this half
+ *
+ * @param[in] row matrix row, counted from the first row of this half
+ * @param[in] col matrix column
+ * @return travel, from 0 to ANALOG_KEY_TRAVEL_MAX
+ */
+uint8_t analog_matrix_get_travel(uint8_t row, uint8_t col) {
+    if (row >= ROWS_PER_HAND || col >= MATRIX_COLS) {
+        return 0;
+    }
+    return keys[row][col].travel;
+}
+
+/**
+ * @brief Gets the actuation point and rapid trigger settings of a key of this half
+ *
+ * @param[in] row matrix row, counted from the first row of this half
+ * @param[in] col matrix column
+ * @param[out] config analog_key_config_t
+ */
+void analog_matrix_get_config(uint8_t row, uint8_t col, analog_key_config_t *config) {
+    if (row >= ROWS_PER_HAND || col >= MATRIX_COLS) {
+        return;
+    }
+    *config = key_configs[row][col];
+}
+
+/**
+ * @brief Sets the actuation point and rapid trigger settings of a key of this half
+ *
+ * @param[in] row matrix row, counted from the first row of this half
+ * @param[in] col matrix column
+ * @param[in] config analog_key_config_t
+ */
+void analog_matrix_set_config(uint8_t row, uint8_t col, const analog_key_config_t *config) {
+    if (row >= ROWS_PER_HAND || col >= MATRIX_COLS) {
+        return;
+    }
+    key_configs[row][col] = *config;
+}
+
+/**
+ * @brief Sets the actuation point and rapid trigger settings of every key of this half
+ *
+ * @param[in] config analog_key_config_t
+ */
+void analog_matrix_set_config_all(const analog_key_config_t *config) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            key_configs[row][col] = *config;
+        }
+    }
+}
+
+void matrix_init_custom(void) {
+    for (uint8_t i = 0; i < ARRAY_SIZE(mux_select_pins); i++) {
+        gpio_set_pin_output(mux_select_pins[i]);
+        gpio_write_pin_low(mux_select_pins[i]);
+    }
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        if (mux_input_pins[row] != NO_PIN) {
+            // Sets the pin up as an analog input as well
+            analogReadPin(mux_input_pins[row]);
+            mux_inputs[row] = pinToMux(mux_input_pins[row]);
+        }
+    }
+
+    analog_matrix_set_config_all(&(analog_key_config_t)ANALOG_KEY_CONFIG_DEFAULT);
+    analog_matrix_calibrate();
+}
+
+/**
+ * @brief Reads every key and updates its state
+ *
+ * The multiplexers share their select lines, so the scan goes channel by channel, reading every multiplexer on each,
+ * and waits for the multiplexers to settle once per channel rather than once per key. Every key is read exactly once
+ * per scan, in the same order, so the time between the readings of a key only depends on the scan rate.
+ */
+bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+    matrix_row_t rows[ROWS_PER_HAND] = {0};
+
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        select_channel(col);
+        for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+            if (mux_input_pins[row] != NO_PIN && analog_key_update(&keys[row][col], &key_configs[row][col], read_mux(row))) {
+                rows[row] |= MATRIX_ROW_SHIFTER << col;
+            }
+        }
+    }
+
+    bool changed = memcmp(current_matrix, rows, sizeof(rows)) != 0;
+    if (changed) {
+        memcpy(current_matrix, rows, sizeof(rows));
+    }
+    return changed;
+}
@@ -0,0 +1,23 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "analog_key.h"
+
+/* settle time of the multiplexers after switching channel, in microseconds */
+#ifndef ANALOG_MATRIX_SETTLE_TIME
+#    define ANALOG_MATRIX_SETTLE_TIME 2
+#endif
+/* readings averaged for the rest position of each key at startup */
+#ifndef ANALOG_MATRIX_CALIBRATION_SAMPLES
+#    define ANALOG_MATRIX_CALIBRATION_SAMPLES 16
+#endif
+
+void    analog_matrix_calibrate(void);
+uint8_t analog_matrix_get_travel(uint8_t row, uint8_t col);
+void    analog_matrix_get_config(uint8_t row, uint8_t col, analog_key_config_t *config);
+void    analog_matrix_set_config(uint8_t row, uint8_t col, const analog_key_config_t *config);
+void    analog_matrix_set_config_all(const analog_key_config_t *config);
@@ -0,0 +1,33 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "analog_key.h"
+}
+
+TEST(AnalogKeyCurve, InterpolatesBetweenPoints) {
+    EXPECT_EQ(analog_key_curve(0), 0);
+    EXPECT_EQ(analog_key_curve(32), 64);
+    EXPECT_EQ(analog_key_curve(64), 128);
+    EXPECT_EQ(analog_key_curve(160), 191);
+    EXPECT_EQ(analog_key_curve(ANALOG_KEY_TRAVEL_MAX), ANALOG_KEY_TRAVEL_MAX);
+}
+
+TEST(AnalogKeyCurve, ReadingsFallWhenPressed) {
+    analog_key_t        key;
+    analog_key_config_t config = ANALOG_KEY_CONFIG_DEFAULT;
+
+    analog_key_calibrate(&key, 3000);
+    for (int i = 0; i < ANALOG_KEY_BOTTOM_OUT_READINGS; i++) {
+        analog_key_travel(&key, 3000 - 1020);
+    }
+    EXPECT_EQ(key.range, 1020);
+
+    // A quarter of the range is half the travel on the curve
+    EXPECT_EQ(analog_key_travel(&key, 3000 - 256), 128);
+    EXPECT_TRUE(analog_key_update(&key, &config, 3000 - 256));
+    EXPECT_FALSE(analog_key_update(&key, &config, 3050));
+    EXPECT_EQ(key.rest, 3050);
+}
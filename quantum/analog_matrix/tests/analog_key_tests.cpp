@@ -0,0 +1,184 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <vector>
+
+extern "C" {
+#include "analog_key.h"
+}
+
+#define REST 1000
+#define RANGE 1020
+
+class AnalogKeyTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        analog_key_calibrate(&key, REST);
+        // Bottom out, so that travel maps to RANGE / ANALOG_KEY_TRAVEL_MAX readings per unit
+        bottom_out(REST + RANGE);
+        analog_key_travel(&key, REST);
+    }
+
+    // Holds the key at a reading for long enough to be taken as bottom out
+    void bottom_out(uint16_t reading) {
+        for (int i = 0; i < ANALOG_KEY_BOTTOM_OUT_READINGS; i++) {
+            analog_key_travel(&key, reading);
+        }
+    }
+
+    static uint16_t reading(int travel) {
+        return REST + travel * RANGE / ANALOG_KEY_TRAVEL_MAX;
+    }
+
+    // Feeds travels to the key, and returns its state after each of them
+    std::vector<bool> feed(const std::vector<int> &travels) {
+        std::vector<bool> states;
+        for (int travel : travels) {
+            states.push_back(analog_key_update(&key, &config, reading(travel)));
+        }
+        return states;
+    }
+
+    // Number of presses while feeding travels to the key
+    int count_presses(const std::vector<int> &travels) {
+        int  presses = 0;
+        bool last    = key.pressed;
+        for (bool pressed : feed(travels)) {
+            presses += pressed && !last;
+            last = pressed;
+        }
+        return presses;
+    }
+
+    analog_key_t        key;
+    analog_key_config_t config = ANALOG_KEY_CONFIG_DEFAULT;
+};
+
+TEST_F(AnalogKeyTest, RangeStartsAtMinimumAndLearnsBottomOut) {
+    analog_key_calibrate(&key, REST);
+    EXPECT_EQ(key.range, ANALOG_KEY_MIN_RANGE);
+    EXPECT_EQ(analog_key_travel(&key, REST + ANALOG_KEY_MIN_RANGE / 2), ANALOG_KEY_TRAVEL_MAX / 2);
+    EXPECT_EQ(analog_key_travel(&key, REST + ANALOG_KEY_MIN_RANGE * 2), ANALOG_KEY_TRAVEL_MAX);
+    analog_key_travel(&key, REST);
+    EXPECT_EQ(key.range, ANALOG_KEY_MIN_RANGE);
+
+    bottom_out(REST + RANGE);
+    EXPECT_EQ(key.range, RANGE);
+    EXPECT_EQ(analog_key_travel(&key, REST + RANGE / 2), ANALOG_KEY_TRAVEL_MAX / 2);
+    EXPECT_EQ(analog_key_travel(&key, REST + RANGE + 100), ANALOG_KEY_TRAVEL_MAX);
+}
+
+TEST_F(AnalogKeyTest, NoiseSpikeDoesNotWidenRange) {
+    EXPECT_EQ(analog_key_travel(&key, REST + RANGE * 2), ANALOG_KEY_TRAVEL_MAX);
+    EXPECT_EQ(analog_key_travel(&key, REST + RANGE), ANALOG_KEY_TRAVEL_MAX);
+    EXPECT_EQ(key.range, RANGE);
+
+    // A bottom out past the range widens it to its shallowest reading
+    analog_key_travel(&key, REST + RANGE + 40);
+    for (int i = 1; i < ANALOG_KEY_BOTTOM_OUT_READINGS; i++) {
+        analog_key_travel(&key, REST + RANGE + 80);
+    }
+    EXPECT_EQ(key.range, RANGE + 40);
+}
+
+TEST_F(AnalogKeyTest, RestFollowsDriftAwayFromPressedSide) {
+    EXPECT_EQ(analog_key_travel(&key, REST - 40), 0);
+    EXPECT_EQ(key.rest, REST - 40);
+    EXPECT_EQ(analog_key_travel(&key, REST - 40 + RANGE / 2), ANALOG_KEY_TRAVEL_MAX / 2);
+}
+
+TEST_F(AnalogKeyTest, RestFollowsDriftTowardPressedSide) {
+    config.actuation_point = 20;
+
+    // The sensor drifts by 20 readings toward the pressed side, within the deadzone
+    std::vector<int> travels;
+    for (int i = 0; i < 20 * ANALOG_KEY_DRIFT_READINGS; i++) {
+        travels.push_back(5);
+    }
+    EXPECT_EQ(count_presses(travels), 0);
+    EXPECT_EQ(key.rest, reading(5));
+    EXPECT_EQ(analog_key_travel(&key, reading(5)), 0);
+    EXPECT_EQ(analog_key_travel(&key, reading(5) + RANGE / 2), ANALOG_KEY_TRAVEL_MAX / 2);
+}
+
+TEST_F(AnalogKeyTest, PressThroughDeadzoneDoesNotMoveRest) {
+    EXPECT_EQ(feed({ANALOG_KEY_DEADZONE, 100, 200, 150, 0}), (std::vector<bool>{false, false, true, true, false}));
+    EXPECT_EQ(key.rest, REST);
+}
+
+TEST_F(AnalogKeyTest, PressesAtActuationPointWithHysteresis) {
+    config.actuation_point = 100;
+
+    EXPECT_EQ(feed({50, 99, 100, 150, 100, 93, 92, 91}), (std::vector<bool>{false, false, true, true, true, true, true, false}));
+    EXPECT_EQ(feed({99, 100}), (std::vector<bool>{false, true}));
+}
+
+TEST_F(AnalogKeyTest, NoiseAtActuationPointDoesNotChatter) {
+    config.actuation_point = 100;
+
+    std::vector<int> travels;
+    for (int i = 0; i < 100; i++) {
+        travels.push_back(100 + (i % 5) - 2);
+    }
+    EXPECT_EQ(count_presses(travels), 1);
+}
+
+TEST_F(AnalogKeyTest, WithoutRapidTriggerReversalDoesNotRelease) {
+    config.actuation_point = 64;
+
+    EXPECT_EQ(feed({200, 150, 100, 200}), (std::vector<bool>{true, true, true, true}));
+}
+
+TEST_F(AnalogKeyTest, RapidTriggerReleasesAndPressesOnReversal) {
+    config.actuation_point     = 64;
+    config.rapid_trigger       = true;
+    config.press_sensitivity   = 16;
+    config.release_sensitivity = 16;
+
+    EXPECT_EQ(feed({64, 80, 200, 190, 185, 184}), (std::vector<bool>{true, true, true, true, true, false}));
+    EXPECT_EQ(feed({190, 150, 160, 165, 166}), (std::vector<bool>{false, false, false, false, true}));
+}
+
+TEST_F(AnalogKeyTest, RapidTriggerNeedsActuationPoint) {
+    config.actuation_point     = 64;
+    config.rapid_trigger       = true;
+    config.press_sensitivity   = 16;
+    config.release_sensitivity = 16;
+
+    EXPECT_EQ(feed({100, 30, 50, 63, 64}), (std::vector<bool>{true, false, false, false, true}));
+}
+
+TEST_F(AnalogKeyTest, DeadzoneAlwaysReleases) {
+    config.actuation_point     = 1;
+    config.rapid_trigger       = true;
+    config.press_sensitivity   = 1;
+    config.release_sensitivity = 100;
+
+    EXPECT_EQ(feed({ANALOG_KEY_DEADZONE, ANALOG_KEY_DEADZONE + 1, ANALOG_KEY_DEADZONE}), (std::vector<bool>{false, true, false}));
+}
+
+TEST_F(AnalogKeyTest, RapidTriggerCountsTapsInNoisyStream) {
+    config.actuation_point     = 40;
+    config.rapid_trigger       = true;
+    config.press_sensitivity   = 20;
+    config.release_sensitivity = 20;
+
+    // Taps of 60 units from mid travel, read every unit with a few units of noise
+    std::vector<int> travels;
+    uint32_t         seed = 1;
+    for (int tap = 0; tap < 10; tap++) {
+        for (int travel = 120; travel <= 180; travel++) {
+            travels.push_back(travel);
+        }
+        for (int travel = 180; travel >= 120; travel--) {
+            travels.push_back(travel);
+        }
+    }
+    for (int &travel : travels) {
+        seed = seed * 1103515245 + 12345;
+        travel += (int)((seed >> 16) % 7) - 3;
+    }
+
+    EXPECT_EQ(count_presses(travels), 10);
+}
@@ -0,0 +1,12 @@
+analog_key_INC := $(QUANTUM_PATH)/analog_matrix
+
+analog_key_SRC := \
+	$(QUANTUM_PATH)/analog_matrix/tests/analog_key_tests.cpp \
+	$(QUANTUM_PATH)/analog_matrix/analog_key.c
+
+analog_key_curve_DEFS := -DANALOG_KEY_PRESSED_LOW '-DANALOG_KEY_TRAVEL_CURVE={{64, 128}}'
+analog_key_curve_INC := $(QUANTUM_PATH)/analog_matrix
+
+analog_key_curve_SRC := \
+	$(QUANTUM_PATH)/analog_matrix/tests/analog_key_curve_tests.cpp \
+	$(QUANTUM_PATH)/analog_matrix/analog_key.c
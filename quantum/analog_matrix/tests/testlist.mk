@@ -0,0 +1,3 @@
+TEST_LIST += \
+	analog_key \
+	analog_key_curve
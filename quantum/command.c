@@ -577,17 +577,21 @@ static void mousekey_param_print(void) {
 #ifndef MK_3_SPEED
         "1:	delay(*10ms): %u\n"
         "2:	interval(ms): %u\n"
+#    ifndef MK_KINEMATIC
         "3:	max_speed: %u\n"
         "4:	time_to_max: %u\n"
         "5:	wheel_max_speed: %u\n"
         "6:	wheel_time_to_max: %u\n"
+#    endif
 
         , mk_delay
         , mk_interval
+#    ifndef MK_KINEMATIC
         , mk_max_speed
         , mk_time_to_max
         , mk_wheel_max_speed
         , mk_wheel_time_to_max
+#    endif
 #else
         "no knobs sorry\n"
 #endif
@@ -608,7 +612,7 @@ static void mousekey_console_help(void) {
         "rt:	-10\n"
         "ESC/q:	quit\n"
 
-#ifndef MK_3_SPEED
+#if !defined(MK_3_SPEED) && !defined(MK_KINEMATIC)
         "\n"
         "speed = delta * max_speed * (repeat / time_to_max)\n"
         "where delta: cursor=%d, wheel=%d\n"
@@ -667,10 +671,12 @@ bool mousekey_console(uint8_t code) {
 #ifndef MK_3_SPEED
                 PARAM(1, mk_delay);
                 PARAM(2, mk_interval);
+#    ifndef MK_KINEMATIC
                 PARAM(3, mk_max_speed);
                 PARAM(4, mk_time_to_max);
                 PARAM(5, mk_wheel_max_speed);
                 PARAM(6, mk_wheel_time_to_max);
+#    endif
 #endif /* MK_3_SPEED */
 
 #               undef PARAM
@@ -694,10 +700,12 @@ bool mousekey_console(uint8_t code) {
 #    ifndef MK_3_SPEED
             mk_delay             = MOUSEKEY_DELAY / 10;
             mk_interval          = MOUSEKEY_INTERVAL;
+#        ifndef MK_KINEMATIC
             mk_max_speed         = MOUSEKEY_MAX_SPEED;
             mk_time_to_max       = MOUSEKEY_TIME_TO_MAX;
             mk_wheel_max_speed   = MOUSEKEY_WHEEL_MAX_SPEED;
             mk_wheel_time_to_max = MOUSEKEY_WHEEL_TIME_TO_MAX;
+#        endif
 #    endif /* MK_3_SPEED */
 
             print("defaults\n");
@@ -13,165 +13,237 @@
 // Helpers
 //
 
-static deferred_token current_token = 0;
+// Wrap-safe ordering of trigger times
+static inline bool trigger_before(uint32_t a, uint32_t b) {
+    return ((int32_t)TIMER_DIFF_32(a, b)) < 0;
+}
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static inline void table_init(deferred_executor_table_t *table) {
+    if (!table->initialized) {
+        // Every executor starts out in the free region of the heap array
+        for (uint8_t i = 0; i < table->count; ++i) {
+            table->heap[i]                 = i;
+            table->executors[i].heap_index = i;
+            table->executors[i].token      = INVALID_DEFERRED_TOKEN;
+        }
+        table->pending     = 0;
+        table->initialized = true;
     }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+}
+
+static inline void heap_swap(deferred_executor_table_t *table, uint8_t a, uint8_t b) {
+    uint8_t slot_a = table->heap[a];
+    uint8_t slot_b = table->heap[b];
+
+    table->heap[a]                      = slot_b;
+    table->heap[b]                      = slot_a;
+    table->executors[slot_a].heap_index = b;
+    table->executors[slot_b].heap_index = a;
+}
+
+static inline uint32_t heap_trigger_time(deferred_executor_table_t *table, uint8_t index) {
+    return table->executors[table->heap[index]].trigger_time;
+}
+
+static void heap_sift_up(deferred_executor_table_t *table, uint8_t index) {
+    while (index > 0) {
+        uint8_t parent = (index - 1) / 2;
+        if (!trigger_before(heap_trigger_time(table, index), heap_trigger_time(table, parent))) {
+            break;
         }
+        heap_swap(table, index, parent);
+        index = parent;
     }
-    return true;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static void heap_sift_down(deferred_executor_table_t *table, uint8_t index) {
+    while (true) {
+        uint16_t left     = 2 * (uint16_t)index + 1;
+        uint16_t right    = left + 1;
+        uint8_t  earliest = index;
+        if (left < table->pending && trigger_before(heap_trigger_time(table, left), heap_trigger_time(table, earliest))) {
+            earliest = left;
+        }
+        if (right < table->pending && trigger_before(heap_trigger_time(table, right), heap_trigger_time(table, earliest))) {
+            earliest = right;
         }
+        if (earliest == index) {
+            break;
+        }
+        heap_swap(table, index, earliest);
+        index = earliest;
     }
-    return current_token;
+}
+
+// Restores heap ordering after the trigger time of the executor changed
+static inline void heap_update(deferred_executor_table_t *table, deferred_executor_t *entry) {
+    heap_sift_up(table, entry->heap_index);
+    heap_sift_down(table, entry->heap_index);
+}
+
+// Moves the executor out of the heap and into the free region, directly after it
+static void heap_remove(deferred_executor_table_t *table, deferred_executor_t *entry) {
+    uint8_t index = entry->heap_index;
+    uint8_t last  = --table->pending;
+    if (index != last) {
+        heap_swap(table, index, last);
+        heap_update(table, &table->executors[table->heap[index]]);
+    }
+    entry->callback = NULL;
+    entry->cb_arg   = NULL;
+}
+
+// Tokens encode the executor's index so that lookups are O(1), with the remaining bits cycling on each reuse of the slot
+static inline deferred_executor_t *lookup_token(deferred_executor_table_t *table, deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return NULL;
+    }
+    deferred_executor_t *entry = &table->executors[(token - 1) % table->count];
+    if (entry->token != token || entry->heap_index >= table->pending) {
+        return NULL;
+    }
+    return entry;
+}
+
+static inline deferred_token next_token(deferred_executor_table_t *table, uint8_t slot) {
+    deferred_token token = table->executors[slot].token;
+    if (token == INVALID_DEFERRED_TOKEN || (uint16_t)token + table->count > UINT8_MAX) {
+        return slot + 1;
+    }
+    return token + table->count;
 }
 
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //
 
-deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+deferred_token defer_exec_advanced(deferred_executor_table_t *table, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
     // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || !callback) {
+    if (!table || table->count == 0 || delay_ms == 0 || !callback) {
         return INVALID_DEFERRED_TOKEN;
     }
+    table_init(table);
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // None available
+    if (table->pending == table->count) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Claim the first free executor, which directly follows the heap
+    uint8_t              index = table->pending++;
+    uint8_t              slot  = table->heap[index];
+    deferred_executor_t *entry = &table->executors[slot];
+
+    // Set up the executor table entry
+    entry->token        = next_token(table, slot);
+    entry->trigger_time = timer_read32() + delay_ms;
+    entry->callback     = callback;
+    entry->cb_arg       = cb_arg;
+    heap_sift_up(table, index);
+    return entry->token;
 }
 
-bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
+bool extend_deferred_exec_advanced(deferred_executor_table_t *table, deferred_token token, uint32_t delay_ms) {
     // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || token == INVALID_DEFERRED_TOKEN) {
+    if (!table || table->count == 0 || !table->initialized || delay_ms == 0) {
         return false;
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    deferred_executor_t *entry = lookup_token(table, token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    entry->trigger_time = timer_read32() + delay_ms;
+    heap_update(table, entry);
+    return true;
 }
 
-bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
+bool cancel_deferred_exec_advanced(deferred_executor_table_t *table, deferred_token token) {
     // Ignore request if the table/token are not valid
-    if (!table || table_count == 0 || token == INVALID_DEFERRED_TOKEN) {
+    if (!table || table->count == 0 || !table->initialized) {
         return false;
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    deferred_executor_t *entry = lookup_token(table, token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and free up the table entry
+    heap_remove(table, entry);
+    return true;
 }
 
-void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
+void deferred_exec_advanced_task(deferred_executor_table_t *table) {
+    if (!table->initialized || table->pending == 0) {
+        return;
+    }
+
     uint32_t now = timer_read32();
 
-    // Throttle only once per millisecond
-    if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
-        *last_execution_time = now;
-
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
-            deferred_token       curr_token = entry->token;
-
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
-            }
+    // Bound the invocations per pass, so that executors requeueing themselves into the past can't stall the main loop
+    for (uint8_t remaining = table->pending; remaining > 0 && table->pending > 0; --remaining) {
+        deferred_executor_t *entry      = &table->executors[table->heap[0]];
+        deferred_token       curr_token = entry->token;
+
+        // Nothing else is due if the earliest executor isn't
+        if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+            break;
+        }
+
+        // Invoke the callback and work work out if we should be requeued
+        uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+        // If the token has changed or it's no longer pending, then the callback has canceled and possibly re-queued. Skip further processing.
+        if (entry->token != curr_token || entry->heap_index >= table->pending) {
+            continue;
+        }
+
+        // Update the trigger time if we have to repeat, otherwise clear it out
+        if (delay_ms > 0) {
+            // Intentionally add just the delay to the existing trigger time -- this ensures the next
+            // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+            // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+            // considerable length of time, then this ensures best-effort timing between invocations.
+            entry->trigger_time += delay_ms;
+            heap_update(table, entry);
+        } else {
+            // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+            heap_remove(table, entry);
         }
     }
 }
 
+bool deferred_exec_advanced_next_deadline(deferred_executor_table_t *table, uint32_t *trigger_time) {
+    if (!table || !table->initialized || table->pending == 0) {
+        return false;
+    }
+    *trigger_time = heap_trigger_time(table, 0);
+    return true;
+}
+
 //------------------------------------
 // Basic API: used by user-mode code, guaranteed to not collide with core deferred execution
 //
 
-static uint32_t            last_deferred_exec_check                = 0;
-static deferred_executor_t basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
+DEFERRED_EXECUTOR_TABLE(basic_executors, MAX_DEFERRED_EXECUTORS);
 
 deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
-    return defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    return defer_exec_advanced(&basic_executors, delay_ms, callback, cb_arg);
 }
 bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
-    return extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    return extend_deferred_exec_advanced(&basic_executors, token, delay_ms);
 }
 bool cancel_deferred_exec(deferred_token token) {
-    return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
+    return cancel_deferred_exec_advanced(&basic_executors, token);
 }
 void deferred_exec_task(void) {
-    deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
+    deferred_exec_advanced_task(&basic_executors);
+}
+bool deferred_exec_next_deadline(uint32_t *trigger_time) {
+    return deferred_exec_advanced_next_deadline(&basic_executors, trigger_time);
 }
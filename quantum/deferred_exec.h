@@ -65,57 +65,96 @@ bool cancel_deferred_exec(deferred_token token);
  */
 void deferred_exec_task(void);
 
+/**
+ * Retrieves the time at which the earliest pending deferred execution is due, allowing the main loop to idle until then.
+ *
+ * @param trigger_time[out] the trigger time of the earliest pending execution -- equivalent time-space as timer_read32()
+ * @return true if any execution is pending, otherwise false and trigger_time is left untouched
+ */
+bool deferred_exec_next_deadline(uint32_t *trigger_time);
+
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //------------------------------------
 
 /**
- * @struct Structure for containing self-hosted deferred executor tables.
- * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
- *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
+ * @struct Structure for a single entry of a self-hosted deferred executor table.
+ * @brief Code outside deferred_exec.c should not worry about internals of this struct.
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
+    uint8_t                heap_index;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
 } deferred_executor_t;
 
+/**
+ * @struct Structure for containing self-hosted deferred executor tables.
+ * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
+ *        Pending executions are kept in a binary min-heap ordered by trigger time, so the next due execution is always at the front.
+ *        Code outside deferred_exec.c should not worry about internals of this struct, and should declare tables with DEFERRED_EXECUTOR_TABLE().
+ */
+typedef struct deferred_executor_table_t {
+    deferred_executor_t *executors;
+    uint8_t *            heap; // executor indices -- the first `pending` form the heap, the remainder are free
+    uint8_t              count;
+    uint8_t              pending;
+    bool                 initialized;
+} deferred_executor_table_t;
+
+/**
+ * @def Declares a static self-hosted deferred executor table named `name`, able to hold `size` concurrent executions.
+ */
+#define DEFERRED_EXECUTOR_TABLE(name, size)                                                                    \
+    _Static_assert((size) > 0 && (size) < 256, "Deferred executor tables must hold between 1 and 255 executions"); \
+    static deferred_executor_t       name##_executors[(size)] = {0};                                               \
+    static uint8_t                   name##_heap[(size)]      = {0};                                               \
+    static deferred_executor_table_t name                     = {.executors = name##_executors, .heap = name##_heap, .count = (size)}
+
 /**
  * Configures the supplied deferred executor to be executed after the required number of milliseconds.
  *
  * @param table[in] the custom table used for storage
- * @param table_count[in] the number of available items in the table
  * @param delay_ms[in] the number of milliseconds before executing the callback
  * @param callback[in] the executor to invoke
  * @param cb_arg[in] the argument to pass to the executor, may be NULL if unused by the executor
  * @return a token usable for extension/cancellation, or INVALID_DEFERRED_TOKEN if an error occurred
  */
-deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg);
+deferred_token defer_exec_advanced(deferred_executor_table_t *table, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg);
 
 /**
  * Allows for extending the timeframe before an existing deferred execution is invoked.
  *
+ * @param table[in] the custom table used for storage
  * @param token[in] the returned value from defer_exec for the deferred execution you wish to extend
  * @param delay_ms[in] the number of milliseconds before executing the callback
  * @return true if the token was extended successfully, otherwise false
  */
-bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms);
+bool extend_deferred_exec_advanced(deferred_executor_table_t *table, deferred_token token, uint32_t delay_ms);
 
 /**
  * Allows for cancellation of an existing deferred execution.
  *
+ * @param table[in] the custom table used for storage
  * @param token[in] the returned value from defer_exec for the deferred execution you wish to cancel
  * @return true if the token was cancelled successfully, otherwise false
  */
-bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
+bool cancel_deferred_exec_advanced(deferred_executor_table_t *table, deferred_token token);
 
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
  *
  * @param table[in] the custom table used for storage
- * @param table_count[in] the number of available items in the table
- * @param last_execution_time[in,out] the last execution time -- this will be checked first to determine if execution is needed, and updated if execution occurred
  */
-void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time);
+void deferred_exec_advanced_task(deferred_executor_table_t *table);
+
+/**
+ * Retrieves the time at which the earliest pending execution of a custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param trigger_time[out] the trigger time of the earliest pending execution -- equivalent time-space as timer_read32()
+ * @return true if any execution is pending, otherwise false and trigger_time is left untouched
+ */
+bool deferred_exec_advanced_next_deadline(deferred_executor_table_t *table, uint32_t *trigger_time);
@@ -16,6 +16,178 @@
 
 #include "digitizer.h"
 
+#ifdef DIGITIZER_CONTACT_COUNT
+#    include <stdlib.h>
+#    include "host_driver.h"
+#    include "timer.h"
+
+typedef struct {
+    bool     active;   // Slot holds a contact, which may be lifted
+    bool     lifted;   // Finger is gone, the host still has to see it lift
+    bool     reported; // Host has seen the contact down
+    bool     confidence;
+    uint8_t  sensor_id;
+    uint8_t  contact_id;
+    uint16_t x;
+    uint16_t y;
+} digitizer_slot_t;
+
+digitizer_t digitizer_state = {
+    .contact_count = 0,
+    .scan_time     = 0,
+    .button        = false,
+    .dirty         = false,
+};
+
+static digitizer_slot_t digitizer_slots[DIGITIZER_CONTACT_COUNT];
+static uint8_t          digitizer_next_contact_id = 0;
+
+/** Approximates the distance between two positions, within 12% and without a square root */
+static uint16_t digitizer_distance(const digitizer_slot_t *slot, const digitizer_contact_t *contact) {
+    uint16_t dx = abs((int32_t)slot->x - contact->x);
+    uint16_t dy = abs((int32_t)slot->y - contact->y);
+    return dx > dy ? dx + dy / 2 : dy + dx / 2;
+}
+
+/** Finds the slot following a contact: the one with the same sensor identifier, or the closest untracked one */
+static digitizer_slot_t *digitizer_find_slot(const digitizer_contact_t *contact, const bool *matched) {
+    digitizer_slot_t *found    = NULL;
+    uint16_t          distance = DIGITIZER_TRACKING_DISTANCE;
+
+    for (uint8_t i = 0; i < DIGITIZER_CONTACT_COUNT; i++) {
+        digitizer_slot_t *slot = &digitizer_slots[i];
+        if (!slot->active || slot->lifted || matched[i] || slot->sensor_id != contact->id) {
+            continue;
+        }
+        if (contact->id != DIGITIZER_CONTACT_ID_NONE) {
+            return slot;
+        }
+        uint16_t d = digitizer_distance(slot, contact);
+        if (d <= distance) {
+            found    = slot;
+            distance = d;
+        }
+    }
+    return found;
+}
+
+/** Takes a free slot for a new contact, with an identifier no other contact uses */
+static digitizer_slot_t *digitizer_new_slot(uint8_t sensor_id) {
+    digitizer_slot_t *free_slot = NULL;
+    for (uint8_t i = 0; i < DIGITIZER_CONTACT_COUNT; i++) {
+        if (!digitizer_slots[i].active) {
+            free_slot = &digitizer_slots[i];
+            break;
+        }
+    }
+    if (!free_slot) {
+        return NULL;
+    }
+
+    bool in_use;
+    do {
+        in_use = false;
+        for (uint8_t i = 0; i < DIGITIZER_CONTACT_COUNT; i++) {
+            if (digitizer_slots[i].active && digitizer_slots[i].contact_id == digitizer_next_contact_id) {
+                in_use = true;
+                digitizer_next_contact_id++;
+                break;
+            }
+        }
+    } while (in_use);
+
+    free_slot->active     = true;
+    free_slot->lifted     = false;
+    free_slot->reported   = false;
+    free_slot->sensor_id  = sensor_id;
+    free_slot->contact_id = digitizer_next_contact_id++;
+    return free_slot;
+}
+
+/** Lays out the active slots as the contacts of the report */
+static void digitizer_update_state(void) {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < DIGITIZER_CONTACT_COUNT; i++) {
+        digitizer_slot_t *slot = &digitizer_slots[i];
+        if (!slot->active) {
+            continue;
+        }
+        // A contact lifted before the host saw it is reported down once, so that taps aren't lost
+        digitizer_state.contacts[count] = (report_digitizer_contact_t){
+            .tip        = !slot->lifted || !slot->reported,
+            .confidence = slot->confidence,
+            .contact_id = slot->contact_id,
+            .x          = slot->x,
+            .y          = slot->y,
+        };
+        count++;
+    }
+    digitizer_state.contact_count = count;
+}
+
+void digitizer_set_contacts(const digitizer_contact_t *contacts, uint8_t count) {
+    bool matched[DIGITIZER_CONTACT_COUNT] = {false};
+
+    for (uint8_t i = 0; i < count; i++) {
+        digitizer_slot_t *slot = digitizer_find_slot(&contacts[i], matched);
+        if (!slot) {
+            slot = digitizer_new_slot(contacts[i].id);
+        }
+        if (!slot) {
+            // Every slot is taken, or holds a lift the host hasn't seen yet
+            continue;
+        }
+        matched[slot - digitizer_slots] = true;
+        slot->confidence                = contacts[i].confidence;
+        slot->x                         = contacts[i].x;
+        slot->y                         = contacts[i].y;
+    }
+
+    for (uint8_t i = 0; i < DIGITIZER_CONTACT_COUNT; i++) {
+        if (digitizer_slots[i].active && !matched[i]) {
+            digitizer_slots[i].lifted = true;
+        }
+    }
+
+    digitizer_state.scan_time = timer_read32() * 10;
+    digitizer_update_state();
+    digitizer_state.dirty = true;
+}
+
+void digitizer_set_button(bool pressed) {
+    if (digitizer_state.button != pressed) {
+        digitizer_state.button = pressed;
+        digitizer_state.dirty  = true;
+    }
+}
+
+void digitizer_flush(void) {
+    if (!digitizer_state.dirty || !digitizer_ready()) {
+        return;
+    }
+    host_digitizer_send(&digitizer_state);
+    digitizer_state.dirty = false;
+
+    bool lift_pending = false;
+    for (uint8_t i = 0; i < DIGITIZER_CONTACT_COUNT; i++) {
+        digitizer_slot_t *slot = &digitizer_slots[i];
+        if (slot->active && slot->lifted && slot->reported) {
+            slot->active = false;
+        } else if (slot->active && slot->lifted) {
+            lift_pending = true;
+        }
+        slot->reported = true;
+    }
+    digitizer_update_state();
+    digitizer_state.dirty = lift_pending;
+}
+
+void digitizer_task(void) {
+    digitizer_flush();
+}
+
+#else
+
 digitizer_t digitizer_state = {
     .in_range = false,
     .tip      = false,
@@ -74,3 +246,5 @@ void digitizer_set_position(float x, float y) {
     digitizer_state.dirty = true;
     digitizer_flush();
 }
+
+#endif
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
+#include "report.h"
 
 /**
  * \file
@@ -25,6 +27,60 @@
  * \{
  */
 
+#ifdef DIGITIZER_CONTACT_COUNT
+
+#    ifndef DIGITIZER_TRACKING_DISTANCE
+#        define DIGITIZER_TRACKING_DISTANCE 0x1000
+#    endif
+
+/** Identifier of a contact the sensor doesn't track, which is then tracked by its position */
+#    define DIGITIZER_CONTACT_ID_NONE 0xFF
+
+typedef struct {
+    uint8_t  id;         ///< Identifier the sensor keeps for the finger while it is down, or DIGITIZER_CONTACT_ID_NONE
+    bool     confidence; ///< Whether the sensor takes the contact for a finger, rather than a palm
+    uint16_t x;          ///< X position, from 0 to 0x7FFF
+    uint16_t y;          ///< Y position, from 0 to 0x7FFF
+} digitizer_contact_t;
+
+typedef struct {
+    report_digitizer_contact_t contacts[DIGITIZER_CONTACT_COUNT];
+    uint8_t                    contact_count;
+    uint16_t                   scan_time;
+    bool                       button;
+    bool                       dirty;
+} digitizer_t;
+
+extern digitizer_t digitizer_state;
+
+/**
+ * \brief Send the digitizer report to the host if it is marked as dirty and the host has taken the previous one.
+ */
+void digitizer_flush(void);
+
+/**
+ * \brief Set the contacts on the sensor, replacing those of the previous scan.
+ *
+ * Contacts keep their identifier for the host while they are down, and contacts missing from the list are reported as
+ * lifted. The report is sent by the next digitizer_task(), updates made before the host takes it are merged.
+ *
+ * \param contacts The contacts on the sensor.
+ * \param count The number of contacts, contacts beyond DIGITIZER_CONTACT_COUNT are ignored.
+ */
+void digitizer_set_contacts(const digitizer_contact_t *contacts, uint8_t count);
+
+/**
+ * \brief Set the state of the button of the touch pad.
+ */
+void digitizer_set_button(bool pressed);
+
+/**
+ * \brief Send the pending digitizer report once the host is ready for it.
+ */
+void digitizer_task(void);
+
+#else
+
 typedef struct {
     bool  in_range : 1;
     bool  tip : 1;
@@ -79,6 +135,8 @@ void digitizer_barrel_switch_off(void);
  */
 void digitizer_set_position(float x, float y);
 
+#endif
+
 void host_digitizer_send(digitizer_t *digitizer);
 
 /** \} */
@@ -254,6 +254,12 @@ void dynamic_keymap_macro_reset(void) {
     }
 }
 
+#ifdef DEFERRED_EXEC_ENABLE
+static char dynamic_keymap_macro_read(const char *ptr) {
+    return eeprom_read_byte((const uint8_t *)ptr);
+}
+#endif
+
 void dynamic_keymap_macro_send(uint8_t id) {
     if (id >= DYNAMIC_KEYMAP_MACRO_COUNT) {
         return;
@@ -284,6 +290,15 @@ void dynamic_keymap_macro_send(uint8_t id) {
         ++p;
     }
 
+#ifdef DEFERRED_EXEC_ENABLE
+    // Type the macro in the background, reading it straight out of EEPROM.
+    // We already checked there was a null at the end of the buffer, so this cannot go past the end.
+    // When the queue is full, type it right away instead.
+    if (send_string_async_with_reader((const char *)p, dynamic_keymap_macro_read, DYNAMIC_KEYMAP_MACRO_DELAY, NULL, NULL) != INVALID_SEND_STRING_TOKEN) {
+        return;
+    }
+#endif
+
     // Send the macro string by making a temporary string.
     char data[8] = {0};
     // We already checked there was a null at the end of
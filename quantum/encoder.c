@@ -4,6 +4,7 @@
 #include <string.h>
 #include "action.h"
 #include "encoder.h"
+#include "timer.h"
 #include "wait.h"
 
 #ifndef ENCODER_MAP_KEY_DELAY
@@ -17,11 +18,60 @@ __attribute__((weak)) bool should_process_encoder(void) {
 static encoder_events_t encoder_events;
 static bool             signal_queue_drain = false;
 
+// Time of the last step of each encoder, and the smoothed interval between its steps
+static uint32_t encoder_step_time[NUM_ENCODERS];
+static uint16_t encoder_step_interval[NUM_ENCODERS];
+
 void encoder_init(void) {
     memset(&encoder_events, 0, sizeof(encoder_events));
+    memset(encoder_step_interval, 0, sizeof(encoder_step_interval));
     encoder_driver_init();
 }
 
+/**
+ * @brief Updates the step interval of an encoder, and returns the number of steps its latest detent is worth
+ *
+ * The interval is averaged over the last few detents so that a single quick flick doesn't jump straight to full
+ * acceleration, the most recent detent weighing half. A pause longer than ENCODER_VELOCITY_TIMEOUT starts the average over.
+ */
+static uint8_t encoder_track_step(uint8_t index) {
+    if (index >= NUM_ENCODERS) {
+        return 1;
+    }
+
+    uint32_t now     = timer_read32();
+    uint32_t elapsed = TIMER_DIFF_32(now, encoder_step_time[index]);
+    encoder_step_time[index] = now;
+
+    if (encoder_step_interval[index] == 0 || elapsed >= ENCODER_VELOCITY_TIMEOUT) {
+        encoder_step_interval[index] = ENCODER_VELOCITY_TIMEOUT;
+    } else {
+        encoder_step_interval[index] = (encoder_step_interval[index] + elapsed) / 2;
+    }
+
+#ifdef ENCODER_ACCELERATION_ENABLE
+    uint16_t steps = ENCODER_ACCELERATION_INTERVAL / MAX(encoder_step_interval[index], 1);
+    return steps < 1 ? 1 : MIN(steps, ENCODER_ACCELERATION_MAX);
+#else
+    return 1;
+#endif // ENCODER_ACCELERATION_ENABLE
+}
+
+/**
+ * @brief Estimates how fast an encoder is turning
+ *
+ * Only known on the half the encoder is connected to.
+ *
+ * @param[in] index encoder
+ * @return detents per second, 0 once the encoder has been still for ENCODER_VELOCITY_TIMEOUT
+ */
+uint16_t encoder_get_velocity(uint8_t index) {
+    if (index >= NUM_ENCODERS || encoder_step_interval[index] == 0 || timer_elapsed32(encoder_step_time[index]) >= ENCODER_VELOCITY_TIMEOUT) {
+        return 0;
+    }
+    return 1000 / MAX(encoder_step_interval[index], 1);
+}
+
 static void encoder_queue_drain(void) {
     encoder_events.tail     = encoder_events.head;
     encoder_events.dequeued = encoder_events.enqueued;
@@ -31,23 +81,30 @@ static bool encoder_handle_queue(void) {
     bool    changed = false;
     uint8_t index;
     bool    clockwise;
-    while (encoder_dequeue_event(&index, &clockwise)) {
+    uint8_t steps;
+    while (encoder_dequeue_event(&index, &clockwise, &steps)) {
 #ifdef ENCODER_MAP_ENABLE
 
-        // The delays below cater for Windows and its wonderful requirements.
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
+        for (uint8_t i = 0; i < steps; i++) {
+            // The delays below cater for Windows and its wonderful requirements.
+            action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
 #    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
+            wait_ms(ENCODER_MAP_KEY_DELAY);
 #    endif // ENCODER_MAP_KEY_DELAY > 0
 
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
+            action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
 #    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
+            wait_ms(ENCODER_MAP_KEY_DELAY);
 #    endif // ENCODER_MAP_KEY_DELAY > 0
+        }
 
 #else // ENCODER_MAP_ENABLE
 
-        encoder_update_kb(index, clockwise);
+        if (encoder_update_steps_kb(index, clockwise, steps)) {
+            for (uint8_t i = 0; i < steps; i++) {
+                encoder_update_kb(index, clockwise);
+            }
+        }
 
 #endif // ENCODER_MAP_ENABLE
 
@@ -98,14 +155,24 @@ bool encoder_queue_empty(void) {
     return encoder_queue_empty_advanced(&encoder_events);
 }
 
-bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise) {
+bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise, uint8_t steps) {
+    // Merge into the last event if it's for the same encoder and direction, and there's room for the steps
+    if (!encoder_queue_empty_advanced(events)) {
+        encoder_event_t *last = &events->queue[(events->head + MAX_QUEUED_ENCODER_EVENTS - 1) % MAX_QUEUED_ENCODER_EVENTS];
+        if (last->index == index && last->clockwise == (clockwise ? 1 : 0) && last->steps <= UINT8_MAX - steps) {
+            last->steps += steps;
+            events->enqueued++;
+            return true;
+        }
+    }
+
     // Drop out if we're full
     if (encoder_queue_full_advanced(events)) {
         return false;
     }
 
     // Append the event
-    encoder_event_t new_event   = {.index = index, .clockwise = clockwise ? 1 : 0};
+    encoder_event_t new_event   = {.index = index, .clockwise = clockwise ? 1 : 0, .steps = steps};
     events->queue[events->head] = new_event;
 
     // Increment the head index
@@ -115,7 +182,7 @@ bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool
     return true;
 }
 
-bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise) {
+bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise, uint8_t *steps) {
     if (encoder_queue_empty_advanced(events)) {
         return false;
     }
@@ -124,6 +191,7 @@ bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bo
     encoder_event_t event = events->queue[events->tail];
     *index                = event.index;
     *clockwise            = event.clockwise;
+    *steps                = event.steps;
 
     // Increment the tail index
     events->tail = (events->tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
@@ -133,11 +201,15 @@ bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bo
 }
 
 bool encoder_queue_event(uint8_t index, bool clockwise) {
-    return encoder_queue_event_advanced(&encoder_events, index, clockwise);
+    return encoder_queue_steps(index, clockwise, encoder_track_step(index));
+}
+
+bool encoder_queue_steps(uint8_t index, bool clockwise, uint8_t steps) {
+    return encoder_queue_event_advanced(&encoder_events, index, clockwise, steps);
 }
 
-bool encoder_dequeue_event(uint8_t *index, bool *clockwise) {
-    return encoder_dequeue_event_advanced(&encoder_events, index, clockwise);
+bool encoder_dequeue_event(uint8_t *index, bool *clockwise, uint8_t *steps) {
+    return encoder_dequeue_event_advanced(&encoder_events, index, clockwise, steps);
 }
 
 void encoder_retrieve_events(encoder_events_t *events) {
@@ -148,6 +220,14 @@ void encoder_signal_queue_drain(void) {
     signal_queue_drain = true;
 }
 
+__attribute__((weak)) bool encoder_update_steps_user(uint8_t index, bool clockwise, uint8_t steps) {
+    return true;
+}
+
+__attribute__((weak)) bool encoder_update_steps_kb(uint8_t index, bool clockwise, uint8_t steps) {
+    return encoder_update_steps_user(index, clockwise, steps);
+}
+
 __attribute__((weak)) bool encoder_update_user(uint8_t index, bool clockwise) {
     return true;
 }
@@ -44,10 +44,15 @@ __attribute__((weak)) bool should_process_encoder(void);
 void encoder_init(void);
 bool encoder_task(void);
 bool encoder_queue_event(uint8_t index, bool clockwise);
-bool encoder_dequeue_event(uint8_t *index, bool *clockwise);
+bool encoder_queue_steps(uint8_t index, bool clockwise, uint8_t steps);
+bool encoder_dequeue_event(uint8_t *index, bool *clockwise, uint8_t *steps);
 
 bool encoder_update_kb(uint8_t index, bool clockwise);
 bool encoder_update_user(uint8_t index, bool clockwise);
+bool encoder_update_steps_kb(uint8_t index, bool clockwise, uint8_t steps);
+bool encoder_update_steps_user(uint8_t index, bool clockwise, uint8_t steps);
+
+uint16_t encoder_get_velocity(uint8_t index);
 
 #    ifdef SPLIT_KEYBOARD
 
@@ -86,9 +91,26 @@ bool encoder_update_user(uint8_t index, bool clockwise);
 #        define MAX_QUEUED_ENCODER_EVENTS MAX(4, ((NUM_ENCODERS_MAX_PER_SIDE) + 1))
 #    endif // MAX_QUEUED_ENCODER_EVENTS
 
+#    ifndef ENCODER_VELOCITY_TIMEOUT
+#        define ENCODER_VELOCITY_TIMEOUT 500
+#    endif // ENCODER_VELOCITY_TIMEOUT
+
+#    ifdef ENCODER_ACCELERATION_ENABLE
+#        ifndef ENCODER_ACCELERATION_INTERVAL
+#            define ENCODER_ACCELERATION_INTERVAL 50
+#        endif // ENCODER_ACCELERATION_INTERVAL
+#        ifndef ENCODER_ACCELERATION_MAX
+#            define ENCODER_ACCELERATION_MAX 4
+#        endif // ENCODER_ACCELERATION_MAX
+#        if ENCODER_ACCELERATION_MAX < 1 || ENCODER_ACCELERATION_MAX > 255
+#            error "ENCODER_ACCELERATION_MAX must be between 1 and 255"
+#        endif
+#    endif // ENCODER_ACCELERATION_ENABLE
+
 typedef struct encoder_event_t {
     uint8_t index : 7;
     uint8_t clockwise : 1;
+    uint8_t steps;
 } encoder_event_t;
 
 typedef struct encoder_events_t {
@@ -102,9 +124,9 @@ typedef struct encoder_events_t {
 // Get the current queued events
 void encoder_retrieve_events(encoder_events_t *events);
 
-// Encoder event queue management
-bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise);
-bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise);
+// Encoder event queue management, steps in the same direction as the last queued event are merged into it
+bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise, uint8_t steps);
+bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise, uint8_t *steps);
 
 // Reset the queue to be empty
 void encoder_signal_queue_drain(void);
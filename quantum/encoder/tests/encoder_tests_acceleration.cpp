@@ -0,0 +1,157 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <vector>
+
+extern "C" {
+#include "encoder.h"
+#include "encoder/tests/mock.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct update {
+    int8_t  index;
+    bool    clockwise;
+    uint8_t steps;
+};
+
+std::vector<update> step_updates;
+uint8_t             updates_array_idx = 0;
+bool                steps_passthrough = true;
+
+bool encoder_update_steps_kb(uint8_t index, bool clockwise, uint8_t steps) {
+    step_updates.push_back({(int8_t)index, clockwise, steps});
+    return steps_passthrough;
+}
+
+bool encoder_update_kb(uint8_t index, bool clockwise) {
+    updates_array_idx++;
+    return true;
+}
+
+bool setAndRead(pin_t pin, bool val) {
+    setPin(pin, val);
+    return encoder_task();
+}
+
+class EncoderAccelerationTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(1000);
+        step_updates.clear();
+        updates_array_idx = 0;
+        steps_passthrough = true;
+        encoder_init();
+    }
+
+    void detent_clockwise(uint32_t gap) {
+        advance_time(gap);
+        setAndRead(0, false);
+        setAndRead(1, false);
+        setAndRead(0, true);
+        setAndRead(1, true);
+    }
+};
+
+TEST_F(EncoderAccelerationTest, SlowTurnIsOneStepPerDetent) {
+    for (int i = 0; i < 5; i++) {
+        detent_clockwise(100);
+    }
+
+    ASSERT_EQ(step_updates.size(), 5);
+    for (auto &update : step_updates) {
+        EXPECT_EQ(update.index, 0);
+        EXPECT_EQ(update.clockwise, true);
+        EXPECT_EQ(update.steps, 1);
+    }
+    EXPECT_EQ(updates_array_idx, 5);
+}
+
+TEST_F(EncoderAccelerationTest, FastTurnAccelerates) {
+    for (int i = 0; i < 10; i++) {
+        detent_clockwise(5);
+    }
+
+    ASSERT_EQ(step_updates.size(), 10);
+    EXPECT_EQ(step_updates.front().steps, 1);
+    EXPECT_EQ(step_updates.back().steps, ENCODER_ACCELERATION_MAX);
+
+    int total = 0;
+    for (size_t i = 0; i < step_updates.size(); i++) {
+        if (i > 0) {
+            EXPECT_GE(step_updates[i].steps, step_updates[i - 1].steps);
+        }
+        total += step_updates[i].steps;
+    }
+    EXPECT_EQ(updates_array_idx, total);
+}
+
+TEST_F(EncoderAccelerationTest, PauseResetsAcceleration) {
+    for (int i = 0; i < 10; i++) {
+        detent_clockwise(5);
+    }
+    detent_clockwise(ENCODER_VELOCITY_TIMEOUT);
+
+    EXPECT_EQ(step_updates.back().steps, 1);
+}
+
+TEST_F(EncoderAccelerationTest, VelocityTracksTurnRate) {
+    EXPECT_EQ(encoder_get_velocity(0), 0);
+
+    for (int i = 0; i < 10; i++) {
+        detent_clockwise(20);
+    }
+    // The average settles within a detent per second of 50 detents per second
+    EXPECT_NEAR(encoder_get_velocity(0), 50, 1);
+
+    advance_time(ENCODER_VELOCITY_TIMEOUT);
+    EXPECT_EQ(encoder_get_velocity(0), 0);
+}
+
+TEST_F(EncoderAccelerationTest, QueuedStepsCoalesce) {
+    encoder_queue_steps(0, true, 1);
+    encoder_queue_steps(0, true, 2);
+    encoder_queue_steps(0, false, 1);
+    encoder_queue_steps(0, false, 1);
+    encoder_queue_steps(0, true, 1);
+
+    encoder_task();
+
+    ASSERT_EQ(step_updates.size(), 3);
+    EXPECT_EQ(step_updates[0].clockwise, true);
+    EXPECT_EQ(step_updates[0].steps, 3);
+    EXPECT_EQ(step_updates[1].clockwise, false);
+    EXPECT_EQ(step_updates[1].steps, 2);
+    EXPECT_EQ(step_updates[2].clockwise, true);
+    EXPECT_EQ(step_updates[2].steps, 1);
+    EXPECT_EQ(updates_array_idx, 6);
+}
+
+TEST_F(EncoderAccelerationTest, CoalescingKeepsQueueFromOverflowing) {
+    encoder_events_t events = {};
+    for (int i = 0; i < 100; i++) {
+        EXPECT_TRUE(encoder_queue_event_advanced(&events, 0, true, 1));
+    }
+
+    uint8_t index;
+    bool    clockwise;
+    uint8_t steps;
+    ASSERT_TRUE(encoder_dequeue_event_advanced(&events, &index, &clockwise, &steps));
+    EXPECT_EQ(steps, 100);
+    EXPECT_FALSE(encoder_dequeue_event_advanced(&events, &index, &clockwise, &steps));
+}
+
+TEST_F(EncoderAccelerationTest, StepsCallbackCanHandleBursts) {
+    steps_passthrough = false;
+    encoder_queue_steps(0, true, 3);
+
+    encoder_task();
+
+    ASSERT_EQ(step_updates.size(), 1);
+    EXPECT_EQ(step_updates[0].steps, 3);
+    EXPECT_EQ(updates_array_idx, 0);
+}
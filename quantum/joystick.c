@@ -14,7 +14,9 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
 #include "joystick.h"
+#include "timer.h"
 #include "wait.h"
 
 #if defined(JOYSTICK_ANALOG)
@@ -65,6 +67,73 @@ static inline bool is_virtual_axis(uint8_t axis) {
     return joystick_axes[axis].input_pin == NO_PIN;
 }
 
+#if JOYSTICK_AXIS_COUNT > 0 && JOYSTICK_FILTER_SHIFT > 0
+// filtered sample of each axis, scaled up by 2^JOYSTICK_FILTER_SHIFT
+static int32_t joystick_filter[JOYSTICK_AXIS_COUNT];
+static bool    joystick_filter_primed[JOYSTICK_AXIS_COUNT];
+#endif
+
+/**
+ * \brief Averages JOYSTICK_OVERSAMPLE samples of an axis.
+ */
+static int32_t joystick_axis_acquire(uint8_t axis) {
+#if JOYSTICK_OVERSAMPLE > 1
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < JOYSTICK_OVERSAMPLE; i++) {
+        sum += joystick_axis_sample(axis);
+    }
+    return (sum + JOYSTICK_OVERSAMPLE / 2) / JOYSTICK_OVERSAMPLE;
+#else
+    return joystick_axis_sample(axis);
+#endif
+}
+
+#if JOYSTICK_AXIS_COUNT > 0 && JOYSTICK_FILTER_SHIFT > 0
+/**
+ * \brief Runs a sample of an axis through the smoothing filter, advancing its state.
+ */
+static int32_t joystick_axis_filter(uint8_t axis, int32_t sample) {
+    if (!joystick_filter_primed[axis]) {
+        joystick_filter[axis]        = sample << JOYSTICK_FILTER_SHIFT;
+        joystick_filter_primed[axis] = true;
+    } else {
+        joystick_filter[axis] += sample - (joystick_filter[axis] >> JOYSTICK_FILTER_SHIFT);
+    }
+    return (joystick_filter[axis] + (1 << (JOYSTICK_FILTER_SHIFT - 1))) >> JOYSTICK_FILTER_SHIFT;
+}
+#endif
+
+/**
+ * \brief Centers values within JOYSTICK_DEADZONE of the rest position, scaling the rest back to the full range.
+ */
+static int32_t joystick_apply_deadzone(int32_t value) {
+#if JOYSTICK_DEADZONE > 0
+    if (abs(value) <= JOYSTICK_DEADZONE) {
+        return 0;
+    }
+    int32_t magnitude = (abs(value) - JOYSTICK_DEADZONE) * JOYSTICK_MAX_VALUE / (JOYSTICK_MAX_VALUE - JOYSTICK_DEADZONE);
+    return value < 0 ? -magnitude : magnitude;
+#else
+    return value;
+#endif
+}
+
+#if JOYSTICK_AXIS_COUNT > 0
+/**
+ * \brief Holds the last reported value of an axis until it moves by more than JOYSTICK_HYSTERESIS.
+ *
+ * The rest position and the ends of the range are always reported, so that the axis can settle on them.
+ */
+static int16_t joystick_apply_hysteresis(int16_t value, int16_t last) {
+#if JOYSTICK_HYSTERESIS > 0
+    if (value != 0 && abs(value) != JOYSTICK_MAX_VALUE && abs(value - last) <= JOYSTICK_HYSTERESIS) {
+        return last;
+    }
+#endif
+    return value;
+}
+#endif
+
 void joystick_flush(void) {
     if (!joystick_state.dirty) return;
 
@@ -90,11 +159,10 @@ void unregister_joystick_button(uint8_t button) {
     joystick_flush();
 }
 
-int16_t joystick_read_axis(uint8_t axis) {
-    if (axis >= JOYSTICK_AXIS_COUNT) return 0;
-
-    int16_t axis_val = joystick_axis_sample(axis);
-
+/**
+ * \brief Scales a sample of an axis to the report range, around its rest position.
+ */
+static int16_t joystick_axis_scale(uint8_t axis, int32_t axis_val) {
     // test the converted value against the lower range
     int32_t ref        = joystick_axes[axis].mid_digit;
     int32_t range      = joystick_axes[axis].min_digit;
@@ -110,7 +178,13 @@ int16_t joystick_read_axis(uint8_t axis) {
     ranged_val = ranged_val < -JOYSTICK_MAX_VALUE ? -JOYSTICK_MAX_VALUE : ranged_val;
     ranged_val = ranged_val > JOYSTICK_MAX_VALUE ? JOYSTICK_MAX_VALUE : ranged_val;
 
-    return ranged_val;
+    return joystick_apply_deadzone(ranged_val);
+}
+
+int16_t joystick_read_axis(uint8_t axis) {
+    if (axis >= JOYSTICK_AXIS_COUNT) return 0;
+
+    return joystick_axis_scale(axis, joystick_axis_acquire(axis));
 }
 
 void joystick_init_axes(void) {
@@ -127,12 +201,26 @@ void joystick_init_axes(void) {
 
 void joystick_read_axes(void) {
 #if JOYSTICK_AXIS_COUNT > 0
+#    if JOYSTICK_SAMPLE_INTERVAL > 0
+    static uint16_t last_read = 0;
+    if (timer_elapsed(last_read) < JOYSTICK_SAMPLE_INTERVAL) {
+        return;
+    }
+    last_read = timer_read();
+#    endif
+
     for (int i = 0; i < JOYSTICK_AXIS_COUNT; ++i) {
         if (is_virtual_axis(i)) {
             continue;
         }
 
-        joystick_set_axis(i, joystick_read_axis(i));
+        int32_t sample = joystick_axis_acquire(i);
+#    if JOYSTICK_FILTER_SHIFT > 0
+        // Only the axes read for the report step the filter, joystick_read_axis() leaves it alone
+        sample = joystick_axis_filter(i, sample);
+#    endif
+        // Noise that doesn't move the axis past the hysteresis doesn't mark the report dirty
+        joystick_set_axis(i, joystick_apply_hysteresis(joystick_axis_scale(i, sample), joystick_state.axes[i]));
     }
 
     joystick_flush();
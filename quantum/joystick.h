@@ -52,6 +52,37 @@
 
 #define JOYSTICK_MAX_VALUE ((1L << (JOYSTICK_AXIS_RESOLUTION - 1)) - 1)
 
+// number of ADC samples averaged for each reading of an analog axis
+#ifndef JOYSTICK_OVERSAMPLE
+#    define JOYSTICK_OVERSAMPLE 1
+#elif JOYSTICK_OVERSAMPLE < 1 || JOYSTICK_OVERSAMPLE > 64
+#    error JOYSTICK_OVERSAMPLE must be between 1 and 64
+#endif
+
+// smoothing of analog axes, each reading moves the filtered value by 1 / 2^JOYSTICK_FILTER_SHIFT of the difference
+#ifndef JOYSTICK_FILTER_SHIFT
+#    define JOYSTICK_FILTER_SHIFT 0
+#elif JOYSTICK_FILTER_SHIFT < 0 || JOYSTICK_FILTER_SHIFT > 8
+#    error JOYSTICK_FILTER_SHIFT must be between 0 and 8
+#endif
+
+// distance from the rest position, in axis units, within which an analog axis reads as centered
+#ifndef JOYSTICK_DEADZONE
+#    define JOYSTICK_DEADZONE 0
+#elif JOYSTICK_DEADZONE < 0 || JOYSTICK_DEADZONE >= JOYSTICK_MAX_VALUE
+#    error JOYSTICK_DEADZONE must be less than the maximum axis value
+#endif
+
+// change, in axis units, an analog axis must exceed before its new value is reported
+#ifndef JOYSTICK_HYSTERESIS
+#    define JOYSTICK_HYSTERESIS 0
+#endif
+
+// minimum time in milliseconds between readings of the analog axes, 0 to read them on every task
+#ifndef JOYSTICK_SAMPLE_INTERVAL
+#    define JOYSTICK_SAMPLE_INTERVAL 0
+#endif
+
 #define JOYSTICK_HAT_CENTER -1
 #define JOYSTICK_HAT_NORTH 0
 #define JOYSTICK_HAT_NORTHEAST 1
@@ -123,6 +154,9 @@ void unregister_joystick_button(uint8_t button);
 /**
  * \brief Sample and process the analog value of the given axis.
  *
+ * The value is oversampled and has the deadzone applied, but isn't smoothed by JOYSTICK_FILTER_SHIFT, whose filter
+ * only advances as the joystick task reads the axes.
+ *
  * \param axis The axis to read.
  *
  * \return A signed 16-bit integer, where 0 is the resting or mid point.
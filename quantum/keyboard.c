@@ -92,6 +92,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef JOYSTICK_ENABLE
 #    include "joystick.h"
 #endif
+#ifdef DIGITIZER_ENABLE
+#    include "digitizer.h"
+#endif
 #ifdef HD44780_ENABLE
 #    include "hd44780.h"
 #endif
@@ -143,6 +146,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
+#if defined(SEND_STRING_ENABLE) && defined(DEFERRED_EXEC_ENABLE)
+#    include "send_string.h"
+#endif
+#ifdef DYNAMIC_MACRO_ENABLE
+#    include "process_dynamic_macro.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -488,6 +497,9 @@ void keyboard_init(void) {
 #ifdef HAPTIC_ENABLE
     haptic_init();
 #endif
+#ifdef DYNAMIC_MACRO_ENABLE
+    dynamic_macro_init();
+#endif
 
 #if defined(DEBUG_MATRIX_SCAN_RATE) && defined(CONSOLE_ENABLE)
     debug_enable = true;
@@ -662,6 +674,14 @@ void quantum_task(void) {
 #ifdef LAYER_LOCK_ENABLE
     layer_lock_task();
 #endif
+
+#if defined(SEND_STRING_ENABLE) && defined(DEFERRED_EXEC_ENABLE)
+    send_string_async_task();
+#endif
+
+#ifdef DYNAMIC_MACRO_ENABLE
+    dynamic_macro_task();
+#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
@@ -730,6 +750,10 @@ void keyboard_task(void) {
     mousekey_task();
 #endif
 
+#ifdef MOUSE_REPORT_SCHEDULER
+    host_mouse_task();
+#endif
+
 #ifdef PS2_MOUSE_ENABLE
     ps2_mouse_task();
 #endif
@@ -742,6 +766,10 @@ void keyboard_task(void) {
     joystick_task();
 #endif
 
+#if defined(DIGITIZER_ENABLE) && defined(DIGITIZER_CONTACT_COUNT)
+    digitizer_task();
+#endif
+
 #ifdef BLUETOOTH_ENABLE
     bluetooth_task();
 #endif
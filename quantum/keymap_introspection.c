@@ -170,4 +170,9 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
     return key_override_get_raw(key_override_idx);
 }
 
+uint8_t* key_override_index_storage_raw(void) {
+    static uint8_t storage[ARRAY_SIZE(key_overrides)];
+    return storage;
+}
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
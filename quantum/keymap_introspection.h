@@ -108,4 +108,7 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 // Get the key override definitions, potentially stored dynamically
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
+// Get the storage used to index key overrides by trigger, holding one entry for each key override defined in the user's keymap
+uint8_t* key_override_index_storage_raw(void);
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
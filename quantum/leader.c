@@ -7,6 +7,11 @@
 
 #include <string.h>
 
+#if __has_include("leader_data.h")
+#    include "quantum.h"
+#    include "leader_data.h"
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
@@ -21,6 +26,56 @@ __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
 
+#ifdef LEADER_TRIE_ENABLE
+#    define LEADER_TRIE_TERMINAL 0x8000
+#    define LEADER_TRIE_NO_MATCH 0xFFFF
+
+// Trie node matching the sequence buffer so far
+static uint16_t leader_trie_node = 0;
+
+__attribute__((weak)) bool leader_sequence_user(uint16_t index) {
+    return true;
+}
+
+static inline uint16_t leader_trie_header(uint16_t node) {
+    return pgm_read_word(&leader_trie[node]);
+}
+
+static uint16_t leader_trie_step(uint16_t node, uint16_t keycode) {
+    if (node == LEADER_TRIE_NO_MATCH) {
+        return LEADER_TRIE_NO_MATCH;
+    }
+
+    uint16_t header = leader_trie_header(node);
+    uint16_t child  = node + ((header & LEADER_TRIE_TERMINAL) ? 2 : 1);
+    for (uint16_t i = 0; i < (header & ~LEADER_TRIE_TERMINAL); i++, child += 2) {
+        if (pgm_read_word(&leader_trie[child]) == keycode) {
+            return pgm_read_word(&leader_trie[child + 1]);
+        }
+    }
+    return LEADER_TRIE_NO_MATCH;
+}
+
+// Whether no longer sequence starts with the one matched so far, so nothing is gained by waiting for more keys
+static bool leader_trie_unambiguous(void) {
+    return leader_trie_node != LEADER_TRIE_NO_MATCH && leader_trie_header(leader_trie_node) == LEADER_TRIE_TERMINAL;
+}
+
+static void leader_trie_dispatch(void) {
+    if (leader_trie_node == LEADER_TRIE_NO_MATCH || !(leader_trie_header(leader_trie_node) & LEADER_TRIE_TERMINAL)) {
+        return;
+    }
+
+    uint16_t index = pgm_read_word(&leader_trie[leader_trie_node + 1]);
+    if (leader_sequence_user(index)) {
+        uint16_t keycode = pgm_read_word(&leader_sequence_keycodes[index]);
+        if (keycode != KC_NO) {
+            tap_code16(keycode);
+        }
+    }
+}
+#endif
+
 void leader_start(void) {
     if (leading) {
         return;
@@ -30,10 +85,16 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+#ifdef LEADER_TRIE_ENABLE
+    leader_trie_node = 0;
+#endif
 }
 
 void leader_end(void) {
     leading = false;
+#ifdef LEADER_TRIE_ENABLE
+    leader_trie_dispatch();
+#endif
     leader_end_user();
 }
 
@@ -61,6 +122,13 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
+#ifdef LEADER_TRIE_ENABLE
+    leader_trie_node = leader_trie_step(leader_trie_node, keycode);
+    if (leader_trie_unambiguous()) {
+        leader_end();
+    }
+#endif
+
     return true;
 }
 
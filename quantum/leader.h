@@ -21,6 +21,17 @@ void leader_start_user(void);
  */
 void leader_end_user(void);
 
+/**
+ * \brief User callback, invoked when a sequence from the generated leader sequence table is matched.
+ *
+ * Called just before `leader_end_user()`.
+ *
+ * \param index The position of the matched sequence in the `leader_sequences` list of `keymap.json`.
+ *
+ * \return `true` to tap the keycode configured for the sequence, `false` to skip it.
+ */
+bool leader_sequence_user(uint16_t index);
+
 /**
  * Begin the leader sequence, resetting the buffer and timer.
  */
@@ -43,6 +54,9 @@ bool leader_sequence_active(void);
  *
  * If `LEADER_NO_TIMEOUT` is defined, the timer is reset if the buffer is empty.
  *
+ * If a generated leader sequence table is present, and the buffer now matches a sequence which no other sequence
+ * extends, the leader sequence is ended immediately.
+ *
  * \param keycode The keycode to add.
  *
  * \return `true` if the keycode was added, `false` if the buffer is full.
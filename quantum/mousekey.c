@@ -53,7 +53,261 @@ static int8_t  mousekey_y_inertia = 0; // ...
 static uint16_t mouse_timer = 0;
 #endif
 
-#ifndef MK_3_SPEED
+#if defined(MK_KINEMATIC)
+
+/*
+ * Kinematic mode
+ *
+ * Cursor and wheel each have a speed, and a position not yet reported, in Q16 fixed point. Both are integrated over
+ * the time actually elapsed between movements, so that speeds hold in units per second whatever the scan rate and
+ * MOUSEKEY_INTERVAL are.
+ */
+
+#    define MK_Q16_ONE 65536
+#    define MK_Q16_INV_SQRT2 46341
+
+static uint16_t last_timer_c = 0;
+static uint16_t last_timer_w = 0;
+
+/* milliseconds between the initial key press and first repeated motion event (0-2550) */
+uint8_t mk_delay = MOUSEKEY_DELAY / 10;
+/* milliseconds between repeated motion events (0-255) */
+uint8_t mk_interval = MOUSEKEY_INTERVAL;
+
+typedef struct {
+    uint16_t initial_speed;
+    uint16_t max_speed;
+    uint16_t acceleration;
+    uint16_t friction;
+    uint8_t  delta;
+    uint8_t  max;
+} mousekey_kinematics_t;
+
+typedef struct {
+    int8_t   x_dir; // direction held, -1 / 0 / 1
+    int8_t   y_dir;
+    int8_t   x_glide; // direction kept while gliding after release
+    int8_t   y_glide;
+    bool     repeating;
+    uint16_t timer;
+    uint32_t speed; // Q16 units per second
+    int32_t  x;     // Q16 units not yet reported
+    int32_t  y;
+} mousekey_motion_t;
+
+static const mousekey_kinematics_t cursor_kinematics = {
+    .initial_speed = MOUSEKEY_KINEMATIC_INITIAL_SPEED,
+    .max_speed     = MOUSEKEY_KINEMATIC_MAX_SPEED,
+    .acceleration  = MOUSEKEY_KINEMATIC_ACCELERATION,
+    .friction      = MOUSEKEY_KINEMATIC_FRICTION,
+    .delta         = MOUSEKEY_MOVE_DELTA,
+    .max           = MOUSEKEY_MOVE_MAX,
+};
+static const mousekey_kinematics_t wheel_kinematics = {
+    .initial_speed = MOUSEKEY_KINEMATIC_WHEEL_INITIAL_SPEED,
+    .max_speed     = MOUSEKEY_KINEMATIC_WHEEL_MAX_SPEED,
+    .acceleration  = MOUSEKEY_KINEMATIC_WHEEL_ACCELERATION,
+    .friction      = MOUSEKEY_KINEMATIC_WHEEL_FRICTION,
+    .delta         = MOUSEKEY_WHEEL_DELTA,
+    .max           = MOUSEKEY_WHEEL_MAX,
+};
+
+static mousekey_motion_t cursor_motion = {};
+static mousekey_motion_t wheel_motion  = {};
+
+static bool motion_is_held(const mousekey_motion_t *motion) {
+    return motion->x_dir || motion->y_dir;
+}
+
+static bool motion_is_active(const mousekey_motion_t *motion) {
+    return motion_is_held(motion) || motion->speed;
+}
+
+/* Constant speed selected by the acceleration keys, or 0 to accelerate */
+static uint32_t motion_constant_speed(const mousekey_kinematics_t *kinematics) {
+    if (mousekey_accel & (1 << 0)) {
+        return kinematics->max_speed / 4;
+    } else if (mousekey_accel & (1 << 1)) {
+        return kinematics->max_speed / 2;
+    } else if (mousekey_accel & (1 << 2)) {
+        return kinematics->max_speed;
+    }
+    return 0;
+}
+
+/* Takes the whole units out of a Q16 position, leaving the fraction for the next movement */
+static int8_t motion_take(int32_t *position, uint8_t max) {
+    int32_t units = *position / MK_Q16_ONE;
+    *position -= units * MK_Q16_ONE;
+    return units > max ? max : (units < -max ? -max : units);
+}
+
+static void motion_press(mousekey_motion_t *motion, const mousekey_kinematics_t *kinematics, int8_t *x, int8_t *y, int8_t dir, bool is_x) {
+    bool was_active = motion_is_active(motion);
+
+    if (is_x) {
+        motion->x_dir = dir;
+    } else {
+        motion->y_dir = dir;
+    }
+    if (was_active) return;
+
+    // The first press moves by a single step right away, precise taps come before any acceleration
+    *x                = motion->x_dir * kinematics->delta;
+    *y                = motion->y_dir * kinematics->delta;
+    motion->repeating = false;
+    motion->timer     = timer_read();
+}
+
+static void motion_release(mousekey_motion_t *motion, int8_t dir, bool is_x) {
+    int8_t *held = is_x ? &motion->x_dir : &motion->y_dir;
+    if (*held == dir) {
+        *held = 0;
+    }
+}
+
+/**
+ * @brief Integrates speed and position over the time elapsed since the last movement
+ *
+ * @param[in,out] motion state of the cursor or wheel
+ * @param[in] kinematics speeds of the cursor or wheel
+ * @param[out] x movement to report on the first axis
+ * @param[out] y movement to report on the second axis
+ */
+static void motion_update(mousekey_motion_t *motion, const mousekey_kinematics_t *kinematics, int8_t *x, int8_t *y) {
+    if (!motion_is_active(motion)) return;
+
+    uint16_t elapsed = timer_elapsed(motion->timer);
+    if (elapsed < (motion->repeating ? mk_interval : mk_delay * 10)) return;
+    motion->timer = timer_read();
+
+    if (!motion->repeating) {
+        motion->repeating = true;
+        motion->speed     = (uint32_t)kinematics->initial_speed * MK_Q16_ONE;
+        return;
+    }
+
+    uint32_t constant = motion_constant_speed(kinematics);
+    uint32_t previous = motion->speed;
+    if (motion_is_held(motion)) {
+        uint32_t max = (uint32_t)kinematics->max_speed * MK_Q16_ONE;
+        if (constant) {
+            motion->speed = constant * MK_Q16_ONE;
+        } else {
+            motion->speed += (uint64_t)kinematics->acceleration * MK_Q16_ONE * elapsed / 1000;
+            if (motion->speed > max) {
+                motion->speed = max;
+            }
+        }
+        motion->x_glide = motion->x_dir;
+        motion->y_glide = motion->y_dir;
+    } else {
+        uint32_t slowdown = (uint64_t)kinematics->friction * MK_Q16_ONE * elapsed / 1000;
+        motion->speed     = kinematics->friction && motion->speed > slowdown ? motion->speed - slowdown : 0;
+    }
+
+    // Averaging the speed before and after integrates constant acceleration exactly
+    int32_t distance = ((uint64_t)previous + motion->speed) * elapsed / 2000;
+    if (motion->x_glide && motion->y_glide) {
+        distance = (int64_t)distance * MK_Q16_INV_SQRT2 / MK_Q16_ONE;
+    }
+    motion->x += motion->x_glide * distance;
+    motion->y += motion->y_glide * distance;
+    *x = motion_take(&motion->x, kinematics->max);
+    *y = motion_take(&motion->y, kinematics->max);
+
+    if (!motion_is_active(motion)) {
+        *motion = (mousekey_motion_t){};
+    }
+}
+
+void mousekey_task(void) {
+    int8_t x = 0, y = 0, h = 0, v = 0;
+
+    motion_update(&cursor_motion, &cursor_kinematics, &x, &y);
+    motion_update(&wheel_motion, &wheel_kinematics, &h, &v);
+
+    mouse_report.x = x;
+    mouse_report.y = y;
+    mouse_report.h = h;
+    mouse_report.v = v;
+    if (should_mousekey_report_send(&mouse_report)) {
+        mousekey_send();
+    }
+    mouse_report.x = 0;
+    mouse_report.y = 0;
+    mouse_report.h = 0;
+    mouse_report.v = 0;
+}
+
+void mousekey_on(uint8_t code) {
+    int8_t x = 0, y = 0, h = 0, v = 0;
+
+    if (code == QK_MOUSE_CURSOR_UP)
+        motion_press(&cursor_motion, &cursor_kinematics, &x, &y, -1, false);
+    else if (code == QK_MOUSE_CURSOR_DOWN)
+        motion_press(&cursor_motion, &cursor_kinematics, &x, &y, 1, false);
+    else if (code == QK_MOUSE_CURSOR_LEFT)
+        motion_press(&cursor_motion, &cursor_kinematics, &x, &y, -1, true);
+    else if (code == QK_MOUSE_CURSOR_RIGHT)
+        motion_press(&cursor_motion, &cursor_kinematics, &x, &y, 1, true);
+    else if (code == QK_MOUSE_WHEEL_UP)
+        motion_press(&wheel_motion, &wheel_kinematics, &h, &v, 1, false);
+    else if (code == QK_MOUSE_WHEEL_DOWN)
+        motion_press(&wheel_motion, &wheel_kinematics, &h, &v, -1, false);
+    else if (code == QK_MOUSE_WHEEL_LEFT)
+        motion_press(&wheel_motion, &wheel_kinematics, &h, &v, -1, true);
+    else if (code == QK_MOUSE_WHEEL_RIGHT)
+        motion_press(&wheel_motion, &wheel_kinematics, &h, &v, 1, true);
+    else if (IS_MOUSEKEY_BUTTON(code))
+        mouse_report.buttons |= 1 << (code - QK_MOUSE_BUTTON_1);
+    else if (code == QK_MOUSE_ACCELERATION_0)
+        mousekey_accel |= (1 << 0);
+    else if (code == QK_MOUSE_ACCELERATION_1)
+        mousekey_accel |= (1 << 1);
+    else if (code == QK_MOUSE_ACCELERATION_2)
+        mousekey_accel |= (1 << 2);
+
+    // Sent by the caller, and cleared again once sent
+    mouse_report.x = x;
+    mouse_report.y = y;
+    mouse_report.h = h;
+    mouse_report.v = v;
+}
+
+void mousekey_off(uint8_t code) {
+    mouse_report.x = 0;
+    mouse_report.y = 0;
+    mouse_report.h = 0;
+    mouse_report.v = 0;
+
+    if (code == QK_MOUSE_CURSOR_UP)
+        motion_release(&cursor_motion, -1, false);
+    else if (code == QK_MOUSE_CURSOR_DOWN)
+        motion_release(&cursor_motion, 1, false);
+    else if (code == QK_MOUSE_CURSOR_LEFT)
+        motion_release(&cursor_motion, -1, true);
+    else if (code == QK_MOUSE_CURSOR_RIGHT)
+        motion_release(&cursor_motion, 1, true);
+    else if (code == QK_MOUSE_WHEEL_UP)
+        motion_release(&wheel_motion, 1, false);
+    else if (code == QK_MOUSE_WHEEL_DOWN)
+        motion_release(&wheel_motion, -1, false);
+    else if (code == QK_MOUSE_WHEEL_LEFT)
+        motion_release(&wheel_motion, -1, true);
+    else if (code == QK_MOUSE_WHEEL_RIGHT)
+        motion_release(&wheel_motion, 1, true);
+    else if (IS_MOUSEKEY_BUTTON(code))
+        mouse_report.buttons &= ~(1 << (code - QK_MOUSE_BUTTON_1));
+    else if (code == QK_MOUSE_ACCELERATION_0)
+        mousekey_accel &= ~(1 << 0);
+    else if (code == QK_MOUSE_ACCELERATION_1)
+        mousekey_accel &= ~(1 << 1);
+    else if (code == QK_MOUSE_ACCELERATION_2)
+        mousekey_accel &= ~(1 << 2);
+}
+
+#elif !defined(MK_3_SPEED)
 
 static uint16_t last_timer_c = 0;
 static uint16_t last_timer_w = 0;
@@ -643,6 +897,10 @@ void mousekey_clear(void) {
     mousekey_repeat       = 0;
     mousekey_wheel_repeat = 0;
     mousekey_accel        = 0;
+#ifdef MK_KINEMATIC
+    cursor_motion = (mousekey_motion_t){};
+    wheel_motion  = (mousekey_motion_t){};
+#endif
 #ifdef MOUSEKEY_INERTIA
     mousekey_frame     = 0;
     mousekey_x_inertia = 0;
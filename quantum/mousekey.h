@@ -38,7 +38,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    ifndef MOUSEKEY_MOVE_DELTA
 #        if defined(MK_KINETIC_SPEED)
 #            define MOUSEKEY_MOVE_DELTA 16
-#        elif defined(MOUSEKEY_INERTIA)
+#        elif defined(MOUSEKEY_INERTIA) || defined(MK_KINEMATIC)
 #            define MOUSEKEY_MOVE_DELTA 1
 #        else
 #            define MOUSEKEY_MOVE_DELTA 8
@@ -49,6 +49,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #            define MOUSEKEY_DELAY 5
 #        elif defined(MOUSEKEY_INERTIA)
 #            define MOUSEKEY_DELAY 150 // allow single-pixel movements before repeat activates
+#        elif defined(MK_KINEMATIC)
+#            define MOUSEKEY_DELAY 100
 #        else
 #            define MOUSEKEY_DELAY 10
 #        endif
@@ -58,6 +60,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #            define MOUSEKEY_INTERVAL 10
 #        elif defined(MOUSEKEY_INERTIA)
 #            define MOUSEKEY_INTERVAL 16 // 60 fps
+#        elif defined(MK_KINEMATIC)
+#            define MOUSEKEY_INTERVAL 8
 #        else
 #            define MOUSEKEY_INTERVAL 20
 #        endif
@@ -120,6 +124,32 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #        define MOUSEKEY_WHEEL_DECELERATED_MOVEMENTS 8
 #    endif
 
+/* kinematic mode: speeds in pixels (or scroll steps) per second, accelerations and friction per second squared */
+#    ifndef MOUSEKEY_KINEMATIC_INITIAL_SPEED
+#        define MOUSEKEY_KINEMATIC_INITIAL_SPEED 100
+#    endif
+#    ifndef MOUSEKEY_KINEMATIC_MAX_SPEED
+#        define MOUSEKEY_KINEMATIC_MAX_SPEED 2000
+#    endif
+#    ifndef MOUSEKEY_KINEMATIC_ACCELERATION
+#        define MOUSEKEY_KINEMATIC_ACCELERATION 2000
+#    endif
+#    ifndef MOUSEKEY_KINEMATIC_FRICTION
+#        define MOUSEKEY_KINEMATIC_FRICTION 0 // stop as soon as the keys are released
+#    endif
+#    ifndef MOUSEKEY_KINEMATIC_WHEEL_INITIAL_SPEED
+#        define MOUSEKEY_KINEMATIC_WHEEL_INITIAL_SPEED 12
+#    endif
+#    ifndef MOUSEKEY_KINEMATIC_WHEEL_MAX_SPEED
+#        define MOUSEKEY_KINEMATIC_WHEEL_MAX_SPEED 40
+#    endif
+#    ifndef MOUSEKEY_KINEMATIC_WHEEL_ACCELERATION
+#        define MOUSEKEY_KINEMATIC_WHEEL_ACCELERATION 20
+#    endif
+#    ifndef MOUSEKEY_KINEMATIC_WHEEL_FRICTION
+#        define MOUSEKEY_KINEMATIC_WHEEL_FRICTION 0
+#    endif
+
 #else /* #ifndef MK_3_SPEED */
 
 #    ifndef MK_C_OFFSET_UNMOD
@@ -13,8 +13,9 @@ typedef struct lvgl_state_t {
     deferred_token defer_token;
 } lvgl_state_t;
 
-static deferred_executor_t lvgl_executors[2] = {0}; // For lv_tick_inc and lv_task_handler
-static lvgl_state_t        lvgl_states[2]    = {0}; // For lv_tick_inc and lv_task_handler
+static lvgl_state_t lvgl_states[2] = {0}; // For lv_tick_inc and lv_task_handler
+
+DEFERRED_EXECUTOR_TABLE(lvgl_executors, 2); // For lv_tick_inc and lv_task_handler
 
 painter_device_t selected_display = NULL;
 void *           color_buffer     = NULL;
@@ -71,7 +72,7 @@ bool qp_lvgl_attach(painter_device_t device) {
     lvgl_state_t *lv_tick_inc_state = &lvgl_states[0];
     lv_tick_inc_state->fnc_id       = 0;
     lv_tick_inc_state->delay_ms     = 1;
-    lv_tick_inc_state->defer_token  = defer_exec_advanced(lvgl_executors, 2, 1, tick_task_callback, lv_tick_inc_state);
+    lv_tick_inc_state->defer_token  = defer_exec_advanced(&lvgl_executors, 1, tick_task_callback, lv_tick_inc_state);
 
     if (lv_tick_inc_state->defer_token == INVALID_DEFERRED_TOKEN) {
         qp_dprintf("qp_lvgl_attach: fail (could not set up qp_lvgl executor)\n");
@@ -82,7 +83,7 @@ bool qp_lvgl_attach(painter_device_t device) {
     lvgl_state_t *lv_task_handler_state = &lvgl_states[1];
     lv_task_handler_state->fnc_id       = 1;
     lv_task_handler_state->delay_ms     = QP_LVGL_TASK_PERIOD;
-    lv_task_handler_state->defer_token  = defer_exec_advanced(lvgl_executors, 2, QP_LVGL_TASK_PERIOD, tick_task_callback, lv_task_handler_state);
+    lv_task_handler_state->defer_token  = defer_exec_advanced(&lvgl_executors, QP_LVGL_TASK_PERIOD, tick_task_callback, lv_task_handler_state);
 
     if (lv_task_handler_state->defer_token == INVALID_DEFERRED_TOKEN) {
         qp_dprintf("qp_lvgl_attach: fail (could not set up qp_lvgl executor)\n");
@@ -130,7 +131,7 @@ bool qp_lvgl_attach(painter_device_t device) {
 
 void qp_lvgl_detach(void) {
     for (int i = 0; i < 2; ++i) {
-        cancel_deferred_exec_advanced(lvgl_executors, 2, lvgl_states[i].defer_token);
+        cancel_deferred_exec_advanced(&lvgl_executors, lvgl_states[i].defer_token);
     }
     if (color_buffer) {
         free(color_buffer);
@@ -143,6 +144,5 @@ void qp_lvgl_detach(void) {
 // Quantum Painter LVGL Integration Internal: qp_lvgl_internal_tick
 
 void qp_lvgl_internal_tick(void) {
-    static uint32_t last_lvgl_exec = 0;
-    deferred_exec_advanced_task(lvgl_executors, 2, &last_lvgl_exec);
+    deferred_exec_advanced_task(&lvgl_executors);
 }
@@ -215,7 +215,7 @@ bool qgf_validate_palette_descriptor(qp_stream_t *stream, uint16_t frame_number,
     return true;
 }
 
-bool qgf_validate_delta_descriptor(qp_stream_t *stream, uint16_t frame_number) {
+bool qgf_validate_delta_descriptor(qp_stream_t *stream, uint16_t frame_number, uint16_t *rect_count) {
     // Read the delta descriptor
     qgf_delta_v1_t delta_descriptor;
     if (qp_stream_read(&delta_descriptor, sizeof(qgf_delta_v1_t), 1, stream) != 1) {
@@ -224,10 +224,22 @@ bool qgf_validate_delta_descriptor(qp_stream_t *stream, uint16_t frame_number) {
     }
 
     // Make sure this block is valid
-    if (!qgf_validate_block_header(&delta_descriptor.header, QGF_FRAME_DELTA_DESCRIPTOR_TYPEID, (sizeof(qgf_delta_v1_t) - sizeof(qgf_block_header_v1_t)))) {
+    if (!qgf_validate_block_header(&delta_descriptor.header, QGF_FRAME_DELTA_DESCRIPTOR_TYPEID, -1)) {
         return false;
     }
 
+    // Each delta region is a fixed size
+    if ((delta_descriptor.header.length % sizeof(qgf_delta_rect_v1_t)) != 0) {
+        qp_dprintf("Failed to validate delta_descriptor, length %d is not a multiple of %d\n", (int)delta_descriptor.header.length, (int)sizeof(qgf_delta_rect_v1_t));
+        return false;
+    }
+
+    if (rect_count) {
+        *rect_count = delta_descriptor.header.length / sizeof(qgf_delta_rect_v1_t);
+    }
+
+    // Move forward in the stream to the next block
+    qp_stream_seek(stream, delta_descriptor.header.length, SEEK_CUR);
     return true;
 }
 
@@ -243,6 +255,8 @@ bool qgf_validate_frame_data_descriptor(qp_stream_t *stream, uint16_t frame_numb
         return false;
     }
 
+    // Move forward in the stream to the next block, delta frames may have several data blocks
+    qp_stream_seek(stream, data_descriptor.header.length, SEEK_CUR);
     return true;
 }
 
@@ -268,14 +282,17 @@ bool qgf_validate_stream(qp_stream_t *stream) {
             return false;
         }
 
-        // If we've got a delta block, check it
-        if (has_delta && !qgf_validate_delta_descriptor(stream, i)) {
+        // If we've got a delta block, check it -- non-delta frames always have a single data block, delta frames have one per delta region
+        uint16_t data_block_count = 1;
+        if (has_delta && !qgf_validate_delta_descriptor(stream, i, &data_block_count)) {
             return false;
         }
 
-        // Check the data block
-        if (!qgf_validate_frame_data_descriptor(stream, i)) {
-            return false;
+        // Check the data blocks
+        for (uint16_t j = 0; j < data_block_count; ++j) {
+            if (!qgf_validate_frame_data_descriptor(stream, i)) {
+                return false;
+            }
         }
     }
 
@@ -72,6 +72,31 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE
+/**
+ * @def This controls the size of each read-ahead block used when streaming images and fonts out of external flash.
+ *      Each cache miss reads a whole block in a single burst, so larger blocks mean fewer, longer flash transactions at
+ *      the cost of RAM. Must be a power of two.
+ */
+#    define QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE 128
+#endif // QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE
+
+#ifndef QUANTUM_PAINTER_FLASH_CACHE_BLOCKS
+/**
+ * @def This controls the number of read-ahead blocks kept when streaming images and fonts out of external flash. At
+ *      least two are needed to avoid thrashing when decoding jumps between an asset's tables and its pixel data.
+ */
+#    define QUANTUM_PAINTER_FLASH_CACHE_BLOCKS 2
+#endif // QUANTUM_PAINTER_FLASH_CACHE_BLOCKS
+
+#ifndef QUANTUM_PAINTER_ASSET_STORE_ADDRESS
+/**
+ * @def This controls the address in external flash of the asset store used by \ref qp_load_image_asset and
+ *      \ref qp_load_font_asset.
+ */
+#    define QUANTUM_PAINTER_ASSET_STORE_ADDRESS 0
+#endif // QUANTUM_PAINTER_ASSET_STORE_ADDRESS
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -263,6 +288,28 @@ bool qp_setpixel(painter_device_t device, uint16_t x, uint16_t y, uint8_t hue, u
  */
 bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue, uint8_t sat, uint8_t val);
 
+/**
+ * Draws an anti-aliased line, blending the foreground color with the supplied background color.
+ *
+ * @note Displays are write-only, so edge pixels are blended against the supplied background rather than what is
+ *       already on the display.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x0[in] the device's x-position to start
+ * @param y0[in] the device's y-position to start
+ * @param x1[in] the device's x-position to finish
+ * @param y1[in] the device's y-position to finish
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ * @return true if drawing the line succeeded
+ * @return false if drawing the line failed
+ */
+bool qp_line_aa(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
 /**
  * Draws a rectangle using the specified color, optionally filled.
  *
@@ -296,6 +343,27 @@ bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t righ
  */
 bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue, uint8_t sat, uint8_t val, bool filled);
 
+/**
+ * Draws an anti-aliased circle outline, blending the foreground color with the supplied background color.
+ *
+ * @note Displays are write-only, so edge pixels are blended against the supplied background rather than what is
+ *       already on the display.
+ *
+ * @param device[in] the handle of the device to control
+ * @param x[in] the x-position of the centre of the circle to draw onto the device
+ * @param y[in] the y-position of the centre of the circle to draw onto the device
+ * @param radius[in] the radius of the circle to draw, less than 4096
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ * @return true if drawing the circle succeeded
+ * @return false if drawing the circle failed
+ */
+bool qp_circle_aa(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
 /**
  * Draws a ellipse using the specified color, optionally filled.
  *
@@ -353,6 +421,32 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
  */
 painter_image_handle_t qp_load_image_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads an image stored in external flash.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image.
+ *
+ * @param address[in] the flash address of the image data to load
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash(uint32_t address);
+
+/**
+ * Loads an image from the asset store in external flash, by name.
+ *
+ * @note Images can be unloaded by calling \ref qp_close_image.
+ *
+ * @param name[in] the name of the image within the asset store
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if the asset could not be found, or loading the image failed
+ */
+painter_image_handle_t qp_load_image_asset(const char *name);
+#endif // FLASH_ENABLE
+
 /**
  * Closes an image handle when no longer in use.
  *
@@ -440,6 +534,30 @@ void qp_stop_animation(deferred_token anim_token);
  */
 painter_font_handle_t qp_load_font_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads a font stored in external flash.
+ *
+ * @note Fonts can be unloaded by calling \ref qp_close_font.
+ *
+ * @param address[in] the flash address of the font data to load
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if loading the font failed
+ */
+painter_font_handle_t qp_load_font_flash(uint32_t address);
+
+/**
+ * Loads a font from the asset store in external flash, by name.
+ *
+ * @note Fonts can be unloaded by calling \ref qp_close_font.
+ *
+ * @param name[in] the name of the font within the asset store
+ * @return an image handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if the asset could not be found, or loading the font failed
+ */
+painter_font_handle_t qp_load_font_asset(const char *name);
+#endif // FLASH_ENABLE
+
 /**
  * Closes a font handle when no longer in use.
  *
@@ -0,0 +1,74 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "qp_asset_store.h"
+
+#ifdef FLASH_ENABLE
+
+#    include "flash.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asset store API
+
+// Compares the supplied name against a NUL-padded name field read from the index, as per strncmp().
+static int qp_asset_store_compare(qp_stream_t *stream, const char *name, uint8_t name_length) {
+    for (uint8_t i = 0; i < name_length; ++i) {
+        int16_t c = qp_stream_get(stream);
+        if (c == STREAM_EOF) {
+            return -1;
+        }
+        if ((uint8_t)name[i] != c) {
+            return (int)(uint8_t)name[i] - (int)c;
+        }
+        if (name[i] == '\0') {
+            return 0;
+        }
+    }
+
+    // Names filling the whole field aren't NUL-terminated, so only match if the requested name ends here too
+    return name[name_length] == '\0' ? 0 : 1;
+}
+
+bool qp_asset_store_find(uint32_t store_address, const char *name, uint32_t *address, uint32_t *length) {
+    qp_asset_store_header_v1_t header;
+    if (flash_read_range(store_address, &header, sizeof(header)) != FLASH_STATUS_SUCCESS) {
+        qp_dprintf("qp_asset_store_find: fail (could not read header)\n");
+        return false;
+    }
+
+    if (header.magic != QP_ASSET_STORE_MAGIC || header.version != 0x01 || header.name_length == 0) {
+        qp_dprintf("qp_asset_store_find: fail (invalid header at 0x%08X)\n", (unsigned int)store_address);
+        return false;
+    }
+
+    // Binary search the index, which is read through a flash stream so that neighbouring probes share cached blocks
+    uint32_t          entry_size = header.name_length + sizeof(qp_asset_store_location_v1_t);
+    qp_flash_stream_t index      = qp_make_flash_stream(store_address + sizeof(header), header.asset_count * entry_size);
+    int32_t           lo         = 0;
+    int32_t           hi         = (int32_t)header.asset_count - 1;
+    while (lo <= hi) {
+        int32_t mid = lo + (hi - lo) / 2;
+        qp_stream_setpos(&index, mid * entry_size);
+        int cmp = qp_asset_store_compare((qp_stream_t *)&index, name, header.name_length);
+        if (cmp < 0) {
+            hi = mid - 1;
+        } else if (cmp > 0) {
+            lo = mid + 1;
+        } else {
+            qp_asset_store_location_v1_t location;
+            qp_stream_setpos(&index, mid * entry_size + header.name_length);
+            if (qp_stream_read(&location, sizeof(location), 1, &index) != 1) {
+                qp_dprintf("qp_asset_store_find: fail (could not read location)\n");
+                return false;
+            }
+            *address = store_address + location.offset;
+            *length  = location.length;
+            return true;
+        }
+    }
+
+    qp_dprintf("qp_asset_store_find: fail (could not find '%s')\n", name);
+    return false;
+}
+
+#endif // FLASH_ENABLE
@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Quantum Painter asset store, an index of QGF/QFF blobs stored in external flash.
+// See https://docs.qmk.fm/#/quantum_painter?id=quantum-painter-asset-store for more information.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "qp_stream.h"
+#include "qp_internal.h"
+
+#ifdef FLASH_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asset store structures
+
+typedef struct QP_PACKED qp_asset_store_header_v1_t {
+    uint32_t magic : 24;  // constant, equal to 0x415051 ("QPA")
+    uint8_t  version;     // constant, equal to 0x01
+    uint16_t asset_count; // number of entries in the index
+    uint8_t  name_length; // size of the NUL-padded name field in each index entry
+    uint8_t  reserved;    // constant, equal to 0x00
+} qp_asset_store_header_v1_t;
+
+_Static_assert(sizeof(qp_asset_store_header_v1_t) == 8, "qp_asset_store_header_v1_t must be 8 bytes in v1 of the asset store");
+
+#define QP_ASSET_STORE_MAGIC 0x415051
+
+// Each index entry is `name_length` bytes of name, followed by the asset's location. Entries are sorted by name.
+typedef struct QP_PACKED qp_asset_store_location_v1_t {
+    uint32_t offset; // offset of the asset, relative to the start of the asset store
+    uint32_t length; // length of the asset in bytes
+} qp_asset_store_location_v1_t;
+
+_Static_assert(sizeof(qp_asset_store_location_v1_t) == 8, "qp_asset_store_location_v1_t must be 8 bytes in v1 of the asset store");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asset store API
+
+// Looks up the named asset in the store located at `store_address`, returning its absolute flash address and length.
+bool qp_asset_store_find(uint32_t store_address, const char *name, uint32_t *address, uint32_t *length);
+
+#endif // FLASH_ENABLE
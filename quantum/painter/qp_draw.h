@@ -27,6 +27,18 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 // qp_rect internal implementation, but uses the global pixdata buffer with pre-converted native pixels.
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
+// Draws the mirrored spans used by the symmetrical shapes, using the global pixdata buffer with pre-converted native pixels.
+bool qp_internal_mirrored_spans_impl(painter_device_t device, int16_t centerx, int16_t centery, int16_t start, int16_t end, int16_t offset, bool vertical);
+
+// Number of coverage levels used when anti-aliasing, stored in the global pixel lookup table
+#define QP_AA_LEVELS 16
+
+// Sets up the global pixel lookup table with the anti-aliasing coverage levels, from background (0) to foreground (QP_AA_LEVELS - 1).
+bool qp_internal_aa_palette_impl(painter_device_t device, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
+// Draws two adjacent pixels at the supplied coverage levels, going right or down from the supplied location. Pixels with zero coverage are skipped.
+bool qp_internal_aa_pair_impl(painter_device_t device, uint16_t x, uint16_t y, bool vertical, uint8_t first, uint8_t second);
+
 // Convert from input pixel data + palette to equivalent pixels
 typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
 typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
@@ -8,114 +8,56 @@
 #include "qp_draw.h"
 
 // Utilize 8-way symmetry to draw circles
-static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+static bool qp_circle_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx_start, uint16_t offsetx_end, uint16_t offsety, bool filled) {
     /*
     Circles have the property of 8-way symmetry, so eight pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled circles, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
+    Rather than drawing each point individually, consecutive points which share
+    the same offsety (i.e. [offsetx_start..offsetx_end]) are drawn together as
+    a run. Runs become horizontal spans at +/-offsety, and vertical spans at
+    +/-offsety for the mirrored octants, so each is a single transfer.
 
-    Two special cases exist and have been optimized:
-    1) offsetx == offsety (the final point), makes half the coordinates
-    equivalent, so we can omit them (and the corresponding fill lines)
-    2) offsetx == 0 (the starting point) means that some horizontal lines
-    would be a single pixel in length, so we write individual pixels instead.
-    This also makes half the symmetrical points identical to their twins,
-    so we only need four points or two points and one line
+    For filled circles, the rows at +/-offsetx within the run all have the same
+    half-width of offsety, so they can be filled as a single rectangle. The rows
+    at +/-offsety have a half-width of offsetx_end -- these are skipped when
+    they're already covered by the rectangle, at the end of the final octant.
     */
 
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t xpy = ((int16_t)centerx) + ((int16_t)offsety);
-    int16_t xmy = ((int16_t)centerx) - ((int16_t)offsety);
-    int16_t ypx = ((int16_t)centery) + ((int16_t)offsetx);
-    int16_t ymx = ((int16_t)centery) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
-
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, centerx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, centerx, ymy)) {
-            return false;
-        }
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, centery, xmy, centery)) {
+    int16_t cx = (int16_t)centerx;
+    int16_t cy = (int16_t)centery;
+    int16_t xs = (int16_t)offsetx_start;
+    int16_t xe = (int16_t)offsetx_end;
+    int16_t oy = (int16_t)offsety;
+
+    if (oy == 0 && xe == 0) {
+        // Zero radius, just the one pixel
+        return qp_internal_setpixel_impl(device, centerx, centery);
+    }
+
+    if (filled) {
+        if (xs == 0) {
+            if (!qp_internal_fillrect_helper_impl(device, cx - oy, cy - xe, cx + oy, cy + xe)) {
                 return false;
             }
         } else {
-            if (!qp_internal_setpixel_impl(device, xpy, centery)) {
+            if (!qp_internal_fillrect_helper_impl(device, cx - oy, cy + xs, cx + oy, cy + xe)) {
                 return false;
             }
-            if (!qp_internal_setpixel_impl(device, xmy, centery)) {
+            if (!qp_internal_fillrect_helper_impl(device, cx - oy, cy - xe, cx + oy, cy - xs)) {
                 return false;
             }
         }
-    } else if (offsetx == offsety) {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypy, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymy, xmy, ymy)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymy)) {
-                return false;
-            }
+        if (oy > xe && !qp_internal_mirrored_spans_impl(device, cx, cy, 0, xe, oy, false)) {
+            return false;
         }
-
     } else {
-        if (filled) {
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ypx, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_fillrect_helper_impl(device, xpy, ymx, xmy, ymx)) {
-                return false;
-            }
-        } else {
-            if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ypx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xpy, ymx)) {
-                return false;
-            }
-            if (!qp_internal_setpixel_impl(device, xmy, ymx)) {
-                return false;
-            }
+        if (!qp_internal_mirrored_spans_impl(device, cx, cy, xs, xe, oy, false)) {
+            return false;
+        }
+        if (!qp_internal_mirrored_spans_impl(device, cx, cy, xs, xe, oy, true)) {
+            return false;
         }
     }
 
@@ -138,35 +80,119 @@ bool qp_circle(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius,
     int16_t ycalc = (int16_t)radius;
     int16_t err   = ((5 - (radius >> 2)) >> 2);
 
-    qp_internal_fill_pixdata(device, (radius * 2) + 1, hue, sat, val);
+    // Filled circles are drawn as rectangles spanning multiple rows, so may need the whole pixdata buffer
+    uint32_t diameter = (radius * 2) + 1;
+    qp_internal_fill_pixdata(device, filled ? diameter * diameter : diameter, hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_circle: fail (could not start comms)\n");
         return false;
     }
 
-    bool ret = true;
-    if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+    bool    ret       = true;
+    int16_t run_start = xcalc;
+    while (xcalc < ycalc) {
+        int16_t prev_x = xcalc;
+        int16_t prev_y = ycalc;
+        xcalc++;
+        if (err < 0) {
+            err += (xcalc << 1) + 1;
+        } else {
+            ycalc--;
+            err += ((xcalc - ycalc) << 1) + 1;
+        }
+
+        // Draw the run of points sharing the same y-offset once it's complete
+        if (ycalc != prev_y) {
+            if (!qp_circle_helper_impl(device, x, y, run_start, prev_x, prev_y, filled)) {
+                ret = false;
+                break;
+            }
+            run_start = xcalc;
+        }
+    }
+
+    // Draw the final run
+    if (ret && !qp_circle_helper_impl(device, x, y, run_start, xcalc, ycalc, filled)) {
         ret = false;
     }
 
-    if (ret) {
-        while (xcalc < ycalc) {
-            xcalc++;
-            if (err < 0) {
-                err += (xcalc << 1) + 1;
-            } else {
-                ycalc--;
-                err += ((xcalc - ycalc) << 1) + 1;
-            }
-            if (!qp_circle_helper_impl(device, x, y, xcalc, ycalc, filled)) {
+    qp_dprintf("qp_circle: %s\n", ret ? "ok" : "fail");
+    qp_comms_stop(device);
+    return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_circle_aa
+
+static uint32_t qp_isqrt(uint32_t value) {
+    uint32_t result = 0;
+    uint32_t bit    = 1UL << 30;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+bool qp_circle_aa(painter_device_t device, uint16_t x, uint16_t y, uint16_t radius, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_dprintf("qp_circle_aa: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_circle_aa: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (radius >= 4096) {
+        qp_dprintf("qp_circle_aa: fail (radius too large)\n");
+        return false;
+    }
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_circle_aa: fail (could not start comms)\n");
+        return false;
+    }
+
+    if (!qp_internal_aa_palette_impl(device, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg)) {
+        qp_dprintf("qp_circle_aa: fail (could not convert palette)\n");
+        qp_comms_stop(device);
+        return false;
+    }
+
+    int16_t cx  = (int16_t)x;
+    int16_t cy  = (int16_t)y;
+    bool    ret = true;
+    for (int16_t ox = 0; ret; ++ox) {
+        // Exact edge position for this column, with 4 fractional bits -- one per coverage level
+        uint32_t edge = qp_isqrt((((uint32_t)radius * radius) - ((uint32_t)ox * ox)) << 8);
+        int16_t  oy   = (int16_t)(edge >> 4);
+        if (ox > oy) {
+            break;
+        }
+
+        // The inner pixel is at offset oy, the outer pixel at oy+1
+        uint8_t outer = edge & (QP_AA_LEVELS - 1);
+        uint8_t inner = (QP_AA_LEVELS - 1) - outer;
+
+        // Utilize 8-way symmetry, each point being a pair of pixels perpendicular to the circle's edge
+        for (int16_t side = 0; side < (ox == 0 ? 1 : 2); ++side) {
+            int16_t sx = side == 0 ? ox : -ox;
+            if (!qp_internal_aa_pair_impl(device, cx + sx, cy + oy, true, inner, outer) || !qp_internal_aa_pair_impl(device, cx + sx, cy - oy - 1, true, outer, inner) || !qp_internal_aa_pair_impl(device, cx + oy, cy + sx, false, inner, outer) || !qp_internal_aa_pair_impl(device, cx - oy - 1, cy + sx, false, outer, inner)) {
                 ret = false;
                 break;
             }
         }
     }
 
-    qp_dprintf("qp_circle: %s\n", ret ? "ok" : "fail");
+    qp_dprintf("qp_circle_aa: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
 }
@@ -140,6 +140,35 @@ bool qp_internal_load_qgf_palette(qp_stream_t *stream, uint8_t bpp) {
     return true;
 }
 
+// Sets up the global lookup table with the anti-aliasing coverage levels, interpolated from background to foreground and converted to native pixels
+bool qp_internal_aa_palette_impl(painter_device_t device, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    painter_driver_t *driver    = (painter_driver_t *)device;
+    qp_pixel_t        fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t        bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    if (qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, QP_AA_LEVELS)) {
+        return driver->driver_vtable->palette_convert(device, QP_AA_LEVELS, qp_internal_global_pixel_lookup_table);
+    }
+    return true;
+}
+
+// Draws two adjacent pixels, starting at (x,y) and going either right or down, using coverage levels from the anti-aliasing lookup table. Pixels with no coverage are skipped.
+bool qp_internal_aa_pair_impl(painter_device_t device, uint16_t x, uint16_t y, bool vertical, uint8_t first, uint8_t second) {
+    painter_driver_t *driver    = (painter_driver_t *)device;
+    uint8_t           levels[2] = {first, second};
+    uint8_t           skip      = first ? 0 : 1;
+    uint8_t           count     = (first ? 1 : 0) + (second ? 1 : 0);
+    if (count == 0) {
+        return true;
+    }
+
+    uint16_t l = vertical ? x : x + skip;
+    uint16_t t = vertical ? y + skip : y;
+    uint16_t r = vertical ? l : l + count - 1;
+    uint16_t b = vertical ? t + count - 1 : t;
+    driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, 0, count, &levels[skip]);
+    return driver->driver_vtable->viewport(device, l, t, r, b) && driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, count);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_setpixel
 
@@ -185,8 +214,6 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
         return false;
     }
 
-    qp_internal_fill_pixdata(device, 1, hue, sat, val);
-
     // draw angled line using Bresenham's algo
     int16_t x      = ((int16_t)x0);
     int16_t y      = ((int16_t)y0);
@@ -198,32 +225,113 @@ bool qp_line(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uin
     int16_t e  = dx + dy;
     int16_t e2 = 2 * e;
 
+    // Consecutive pixels along the major axis are batched into a single span, rather than being sent one at a time
+    bool    steep  = -dy > dx;
+    int16_t span_x = x;
+    int16_t span_y = y;
+    qp_internal_fill_pixdata(device, QP_MAX(dx, -dy) + 1, hue, sat, val);
+
     bool ret = true;
-    while (x != x1 || y != y1) {
-        if (!qp_internal_setpixel_impl(device, x, y)) {
-            ret = false;
-            break;
+    while (true) {
+        int16_t prev_x = x;
+        int16_t prev_y = y;
+        bool    last   = (x == x1 && y == y1);
+        if (!last) {
+            e2 = 2 * e;
+            if (e2 >= dy) {
+                e += dy;
+                x += slopex;
+            }
+            if (e2 <= dx) {
+                e += dx;
+                y += slopey;
+            }
         }
-        e2 = 2 * e;
-        if (e2 >= dy) {
-            e += dy;
-            x += slopex;
+
+        // Flush the current span once the next pixel leaves its row (or column, for steep lines)
+        if (last || (steep ? (x != span_x) : (y != span_y))) {
+            if (!qp_internal_fillrect_helper_impl(device, span_x, span_y, prev_x, prev_y)) {
+                ret = false;
+                break;
+            }
+            span_x = x;
+            span_y = y;
         }
-        if (e2 <= dx) {
-            e += dx;
-            y += slopey;
+
+        if (last) {
+            break;
         }
     }
-    // draw the last pixel
-    if (!qp_internal_setpixel_impl(device, x, y)) {
-        ret = false;
-    }
 
     qp_comms_stop(device);
     qp_dprintf("qp_line(%d, %d, %d, %d): %s\n", (int)x0, (int)y0, (int)x1, (int)y1, ret ? "ok" : "fail");
     return ret;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_line_aa
+
+bool qp_line_aa(painter_device_t device, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    if (x0 == x1 || y0 == y1) {
+        qp_dprintf("qp_line_aa(%d, %d, %d, %d): entry (deferring to qp_rect)\n", (int)x0, (int)y0, (int)x1, (int)y1);
+        bool ret = qp_rect(device, x0, y0, x1, y1, hue_fg, sat_fg, val_fg, true);
+        qp_dprintf("qp_line_aa(%d, %d, %d, %d): %s (deferred to qp_rect)\n", (int)x0, (int)y0, (int)x1, (int)y1, ret ? "ok" : "fail");
+        return ret;
+    }
+
+    qp_dprintf("qp_line_aa(%d, %d, %d, %d): entry\n", (int)x0, (int)y0, (int)x1, (int)y1);
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_line_aa: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("Failed to start comms in qp_line_aa\n");
+        return false;
+    }
+
+    if (!qp_internal_aa_palette_impl(device, hue_fg, sat_fg, val_fg, hue_bg, sat_bg, val_bg)) {
+        qp_dprintf("qp_line_aa: fail (could not convert palette)\n");
+        qp_comms_stop(device);
+        return false;
+    }
+
+    // draw angled line using Wu's algo, walking along the major axis and splitting coverage between the two nearest pixels on the minor axis
+    bool    steep  = abs(((int16_t)y1) - ((int16_t)y0)) > abs(((int16_t)x1) - ((int16_t)x0));
+    int16_t major0 = steep ? y0 : x0;
+    int16_t major1 = steep ? y1 : x1;
+    int16_t minor0 = steep ? x0 : y0;
+    int16_t minor1 = steep ? x1 : y1;
+    if (major0 > major1) {
+        int16_t tmp = major0;
+        major0      = major1;
+        major1      = tmp;
+        tmp         = minor0;
+        minor0      = minor1;
+        minor1      = tmp;
+    }
+
+    // Minor axis position is tracked in 16.16 fixed point
+    int32_t gradient = (((int32_t)(minor1 - minor0)) << 16) / (major1 - major0);
+    int32_t minor    = ((int32_t)minor0) << 16;
+
+    bool ret = true;
+    for (int16_t major = major0; major <= major1; ++major, minor += gradient) {
+        uint16_t pos    = (uint16_t)(minor >> 16);
+        uint8_t  second = (minor >> 12) & (QP_AA_LEVELS - 1);
+        uint8_t  first  = (QP_AA_LEVELS - 1) - second;
+        if (!qp_internal_aa_pair_impl(device, steep ? pos : major, steep ? major : pos, !steep, first, second)) {
+            ret = false;
+            break;
+        }
+    }
+
+    qp_comms_stop(device);
+    qp_dprintf("qp_line_aa(%d, %d, %d, %d): %s\n", (int)x0, (int)y0, (int)x1, (int)y1, ret ? "ok" : "fail");
+    return ret;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_rect
 
@@ -250,6 +358,34 @@ bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t left, ui
     return true;
 }
 
+// Draws the spans [start, end] and [-end, -start] along one axis relative to the center, on both sides of the center at the supplied offset along the other axis.
+// Used by the symmetrical shapes; overlapping spans are merged so that each pixel is only sent once.
+bool qp_internal_mirrored_spans_impl(painter_device_t device, int16_t centerx, int16_t centery, int16_t start, int16_t end, int16_t offset, bool vertical) {
+    for (int16_t side = 0; side < (offset == 0 ? 1 : 2); ++side) {
+        int16_t minor = side == 0 ? offset : -offset;
+        int16_t spans[2][2];
+        uint8_t num_spans = 1;
+        if (start == 0) {
+            spans[0][0] = -end;
+            spans[0][1] = end;
+        } else {
+            spans[0][0] = start;
+            spans[0][1] = end;
+            spans[1][0] = -end;
+            spans[1][1] = -start;
+            num_spans   = 2;
+        }
+
+        for (uint8_t i = 0; i < num_spans; ++i) {
+            bool ok = vertical ? qp_internal_fillrect_helper_impl(device, centerx + minor, centery + spans[i][0], centerx + minor, centery + spans[i][1]) : qp_internal_fillrect_helper_impl(device, centerx + spans[i][0], centery + minor, centerx + spans[i][1], centery + minor);
+            if (!ok) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 bool qp_rect(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom, uint8_t hue, uint8_t sat, uint8_t val, bool filled) {
     qp_dprintf("qp_rect(%d, %d, %d, %d): entry\n", (int)left, (int)top, (int)right, (int)bottom);
     painter_driver_t *driver = (painter_driver_t *)device;
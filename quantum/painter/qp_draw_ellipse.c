@@ -7,53 +7,40 @@
 #include "qp_draw.h"
 
 // Utilize 4-way symmetry to draw an ellipse
-static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t offsetx, uint16_t offsety, bool filled) {
+static bool qp_ellipse_helper_impl(painter_device_t device, uint16_t centerx, uint16_t centery, uint16_t run_start, uint16_t run_end, uint16_t offset, bool vertical, bool filled) {
     /*
     Ellipses have the property of 4-way symmetry, so four pixels can be drawn
     for each computed [offsetx,offsety] given the center coordinates
     represented by [centerx,centery].
 
-    For filled ellipses, we can draw horizontal lines between each pair of
-    pixels with the same final value of y.
+    Rather than drawing each point individually, consecutive points are drawn
+    together as a run. In the first region, points sharing the same offsety
+    form horizontal runs of offsetx in [run_start..run_end]. In the second
+    region, points sharing the same offsetx form vertical runs of offsety in
+    [run_start..run_end].
 
-    When offsetx == 0 only two pixels can be drawn for filled or unfilled ellipses
+    For filled ellipses, horizontal runs only need their widest row drawn,
+    and vertical runs cover a rectangle of rows with the same width.
     */
 
-    int16_t xpx = ((int16_t)centerx) + ((int16_t)offsetx);
-    int16_t xmx = ((int16_t)centerx) - ((int16_t)offsetx);
-    int16_t ypy = ((int16_t)centery) + ((int16_t)offsety);
-    int16_t ymy = ((int16_t)centery) - ((int16_t)offsety);
+    int16_t cx = (int16_t)centerx;
+    int16_t cy = (int16_t)centery;
+    int16_t rs = (int16_t)run_start;
+    int16_t re = (int16_t)run_end;
+    int16_t of = (int16_t)offset;
 
-    if (offsetx == 0) {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-    } else if (filled) {
-        if (!qp_internal_fillrect_helper_impl(device, xpx, ypy, xmx, ypy)) {
-            return false;
-        }
-        if (offsety > 0 && !qp_internal_fillrect_helper_impl(device, xpx, ymy, xmx, ymy)) {
-            return false;
-        }
-    } else {
-        if (!qp_internal_setpixel_impl(device, xpx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xpx, ymy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ypy)) {
-            return false;
-        }
-        if (!qp_internal_setpixel_impl(device, xmx, ymy)) {
-            return false;
-        }
+    if (!filled) {
+        return qp_internal_mirrored_spans_impl(device, cx, cy, rs, re, of, vertical);
     }
 
-    return true;
+    if (!vertical) {
+        return qp_internal_mirrored_spans_impl(device, cx, cy, 0, re, of, false);
+    }
+
+    if (rs == 0) {
+        return qp_internal_fillrect_helper_impl(device, cx - of, cy - re, cx + of, cy + re);
+    }
+    return qp_internal_fillrect_helper_impl(device, cx - of, cy + rs, cx + of, cy + re) && qp_internal_fillrect_helper_impl(device, cx - of, cy - re, cx + of, cy - rs);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,39 +62,56 @@ bool qp_ellipse(painter_device_t device, uint16_t x, uint16_t y, uint16_t sizex,
     int16_t dx = 0;
     int16_t dy = ((int16_t)sizey);
 
-    qp_internal_fill_pixdata(device, QP_MAX(sizex, sizey), hue, sat, val);
+    // Spans pass through the center, and filled ellipses are drawn as rectangles spanning multiple rows
+    uint32_t width  = (sizex * 2) + 1;
+    uint32_t height = (sizey * 2) + 1;
+    qp_internal_fill_pixdata(device, filled ? width * height : QP_MAX(width, height), hue, sat, val);
 
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_ellipse: fail (could not start comms)\n");
         return false;
     }
 
-    bool ret = true;
+    // First region, points sharing the same y-offset form horizontal runs
+    bool    ret       = true;
+    int16_t run_start = dx;
     for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
+        int16_t prev_y = dy;
         if (delta >= 0) {
             delta += fa * (1 - dy);
             dy--;
         }
         delta += bb * (4 * dx + 6);
+
+        if (dy != prev_y || bb * (dx + 1) > aa * dy) {
+            if (!qp_ellipse_helper_impl(device, x, y, run_start, dx, prev_y, false, filled)) {
+                ret = false;
+                break;
+            }
+            run_start = dx + 1;
+        }
     }
 
     dx = sizex;
     dy = 0;
 
-    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
-        if (!qp_ellipse_helper_impl(device, x, y, dx, dy, filled)) {
-            ret = false;
-            break;
-        }
+    // Second region, points sharing the same x-offset form vertical runs
+    run_start = dy;
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); ret && aa * dy <= bb * dx; dy++) {
+        int16_t prev_x = dx;
         if (delta >= 0) {
             delta += fb * (1 - dx);
             dx--;
         }
         delta += aa * (4 * dy + 6);
+
+        if (dx != prev_x || aa * (dy + 1) > bb * dx) {
+            if (!qp_ellipse_helper_impl(device, x, y, run_start, dy, prev_x, true, filled)) {
+                ret = false;
+                break;
+            }
+            run_start = dy + 1;
+        }
     }
 
     qp_dprintf("qp_ellipse: %s\n", ret ? "ok" : "fail");
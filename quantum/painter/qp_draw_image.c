@@ -5,6 +5,7 @@
 #include "qp_draw.h"
 #include "qp_comms.h"
 #include "qgf.h"
+#include "qp_asset_store.h"
 #include "deferred_exec.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -19,6 +20,9 @@ typedef struct qgf_image_handle_t {
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef FLASH_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // FLASH_ENABLE
     };
 } qgf_image_handle_t;
 
@@ -85,6 +89,42 @@ painter_image_handle_t qp_load_image_mem(const void *buffer) {
     return qp_load_image_internal(image_mem_stream_factory, (void *)buffer);
 }
 
+#ifdef FLASH_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_image_flash
+
+static inline bool image_flash_stream_factory(qgf_image_handle_t *image, void *arg) {
+    uint32_t address = *(uint32_t *)arg;
+
+    // Assume we can read the graphics descriptor
+    image->flash_stream = qp_make_flash_stream(address, sizeof(qgf_graphics_descriptor_v1_t));
+
+    // Update the length of the stream to match, and rewind to the start
+    image->flash_stream.length   = qgf_get_total_size(&image->stream);
+    image->flash_stream.position = 0;
+
+    return true;
+}
+
+painter_image_handle_t qp_load_image_flash(uint32_t address) {
+    return qp_load_image_internal(image_flash_stream_factory, &address);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_image_asset
+
+painter_image_handle_t qp_load_image_asset(const char *name) {
+    uint32_t address, length;
+    if (!qp_asset_store_find(QUANTUM_PAINTER_ASSET_STORE_ADDRESS, name, &address, &length)) {
+        qp_dprintf("qp_load_image_asset: fail (could not find asset)\n");
+        return NULL;
+    }
+    return qp_load_image_flash(address);
+}
+
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_image
 
@@ -117,10 +157,8 @@ typedef struct qgf_frame_info_t {
     bool                  has_palette;
     bool                  is_panel_native;
     bool                  is_delta;
-    uint16_t              left;
-    uint16_t              top;
-    uint16_t              right;
-    uint16_t              bottom;
+    uint16_t              delta_rect_count;
+    int32_t               delta_rect_offset;
     uint16_t              delay;
 } qgf_frame_info_t;
 
@@ -191,12 +229,19 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
             return false;
         }
 
-        info->left   = delta_descriptor.left;
-        info->top    = delta_descriptor.top;
-        info->right  = delta_descriptor.right;
-        info->bottom = delta_descriptor.bottom;
+        // Keep track of where the delta regions are, they're read one at a time alongside their corresponding data blocks
+        info->delta_rect_count  = delta_descriptor.header.length / sizeof(qgf_delta_rect_v1_t);
+        info->delta_rect_offset = qp_stream_tell(&qgf_image->stream);
+        qp_stream_seek(&qgf_image->stream, delta_descriptor.header.length, SEEK_CUR);
     }
 
+    // Stream is now at the point of being able to read the first data block
+    return true;
+}
+
+static bool qp_drawimage_stream_region(painter_device_t device, qgf_image_handle_t *qgf_image, qgf_frame_info_t *frame_info, uint16_t l, uint16_t t, uint16_t r, uint16_t b, int32_t *next_data_offset) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
     // Read the data block
     qgf_data_v1_t data_descriptor;
     if (qp_stream_read(&data_descriptor, sizeof(qgf_data_v1_t), 1, &qgf_image->stream) != 1) {
@@ -204,8 +249,34 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         return false;
     }
 
-    // Stream is now at the point of being able to read pixdata
-    return true;
+    // Work out where the following data block starts, as the decoder isn't guaranteed to consume the entire block
+    if (next_data_offset) {
+        *next_data_offset = qp_stream_tell(&qgf_image->stream) + data_descriptor.header.length;
+    }
+
+    // Nothing to draw for this region
+    if (data_descriptor.header.length == 0) {
+        return true;
+    }
+
+    uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
+
+    // Configure where we're going to be rendering to
+    if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
+        qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
+        return false;
+    }
+
+    // Set up the input state
+    qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
+    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
+    if (input_callback == NULL) {
+        qp_dprintf("qp_drawimage_recolor: fail (invalid image compression scheme)\n");
+        return false;
+    }
+
+    // Decode and stream pixels
+    return qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
 }
 
 static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
@@ -228,43 +299,37 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+    // Delta frames without any regions are identical to the previous frame, so there's nothing to send to the display
+    if (frame_info->is_delta && frame_info->delta_rect_count == 0) {
+        qp_dprintf("qp_drawimage_recolor: ok (unchanged frame, skipping)\n");
+        return true;
+    }
+
     if (!qp_comms_start(device)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not start comms)\n");
         return false;
     }
 
-    uint16_t l, t, r, b;
+    bool ret = true;
     if (frame_info->is_delta) {
-        l = x + frame_info->left;
-        t = y + frame_info->top;
-        r = x + frame_info->right;
-        b = y + frame_info->bottom;
+        // Each delta region has its own data block, which are stored sequentially after the delta block
+        int32_t data_offset = qp_stream_tell(&qgf_image->stream);
+        for (uint16_t i = 0; ret && i < frame_info->delta_rect_count; ++i) {
+            qgf_delta_rect_v1_t rect;
+            qp_stream_setpos(&qgf_image->stream, frame_info->delta_rect_offset + i * sizeof(qgf_delta_rect_v1_t));
+            if (qp_stream_read(&rect, sizeof(qgf_delta_rect_v1_t), 1, &qgf_image->stream) != 1) {
+                qp_dprintf("Failed to read delta rect, expected length was not %d\n", (int)sizeof(qgf_delta_rect_v1_t));
+                ret = false;
+                break;
+            }
+
+            // Move to this region's data block and stream it out
+            qp_stream_setpos(&qgf_image->stream, data_offset);
+            ret = qp_drawimage_stream_region(device, qgf_image, frame_info, x + rect.left, y + rect.top, x + rect.right, y + rect.bottom, &data_offset);
+        }
     } else {
-        l = x;
-        t = y;
-        r = x + image->width - 1;
-        b = y + image->height - 1;
+        ret = qp_drawimage_stream_region(device, qgf_image, frame_info, x, y, x + image->width - 1, y + image->height - 1, NULL);
     }
-    uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
-
-    // Configure where we're going to be rendering to
-    if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
-        qp_comms_stop(device);
-        return false;
-    }
-
-    // Set up the input state
-    qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
-    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
-    if (input_callback == NULL) {
-        qp_dprintf("qp_drawimage_recolor: fail (invalid image compression scheme)\n");
-        qp_comms_stop(device);
-        return false;
-    }
-
-    // Decode and stream pixels
-    bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -299,8 +364,9 @@ typedef struct animation_state_t {
     deferred_token         defer_token;
 } animation_state_t;
 
-static deferred_executor_t animation_executors[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
-static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS]    = {0};
+static animation_state_t animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
+
+DEFERRED_EXECUTOR_TABLE(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS);
 
 static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
     qgf_frame_info_t frame_info = {0};
@@ -363,7 +429,7 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
     }
 
     // Set up the timer
-    anim_state->defer_token = defer_exec_advanced(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, delay_ms, animation_callback, anim_state);
+    anim_state->defer_token = defer_exec_advanced(&animation_executors, delay_ms, animation_callback, anim_state);
     if (anim_state->defer_token == INVALID_DEFERRED_TOKEN) {
         anim_state->device = NULL; // disregard the allocated animation slot
         qp_dprintf("qp_animate_recolor: fail (could not set up animation executor)\n");
@@ -380,7 +446,7 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
 void qp_stop_animation(deferred_token anim_token) {
     for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
         if (animation_states[i].defer_token == anim_token) {
-            cancel_deferred_exec_advanced(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, anim_token);
+            cancel_deferred_exec_advanced(&animation_executors, anim_token);
             animation_states[i].device = NULL;
             return;
         }
@@ -391,6 +457,5 @@ void qp_stop_animation(deferred_token anim_token) {
 // Quantum Painter Core API: qp_internal_animation_tick
 
 void qp_internal_animation_tick(void) {
-    static uint32_t last_anim_exec = 0;
-    deferred_exec_advanced_task(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, &last_anim_exec);
+    deferred_exec_advanced_task(&animation_executors);
 }
@@ -164,3 +164,132 @@ qp_file_stream_t qp_make_file_stream(FILE *f) {
     return stream;
 }
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Flash streams
+
+#ifdef FLASH_ENABLE
+
+#    include "flash.h"
+
+_Static_assert((QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE & (QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - 1)) == 0, "QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE must be a power of two");
+
+typedef struct qp_flash_cache_block_t {
+    uint32_t address;
+    uint32_t last_used;
+    bool     valid;
+    uint8_t  data[QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE];
+} qp_flash_cache_block_t;
+
+static qp_flash_cache_block_t flash_cache[QUANTUM_PAINTER_FLASH_CACHE_BLOCKS] = {0};
+static uint32_t               flash_cache_clock                               = 0;
+
+void qp_flash_stream_invalidate_cache(void) {
+    for (int i = 0; i < QUANTUM_PAINTER_FLASH_CACHE_BLOCKS; ++i) {
+        flash_cache[i].valid = false;
+    }
+}
+
+// Returns the byte at the supplied address, reading ahead the containing block if it's not already cached. Blocks are
+// aligned to their size, so a block read never crosses the end of a flash chip.
+static int16_t flash_cache_get(uint32_t address) {
+    qp_flash_cache_block_t *victim = &flash_cache[0];
+    for (int i = 0; i < QUANTUM_PAINTER_FLASH_CACHE_BLOCKS; ++i) {
+        qp_flash_cache_block_t *block = &flash_cache[i];
+        if (block->valid && address - block->address < QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE) {
+            block->last_used = ++flash_cache_clock;
+            return block->data[address - block->address];
+        }
+        if (block->last_used < victim->last_used) {
+            victim = block;
+        }
+    }
+
+    // Cache miss, evict the least-recently-used block and replace it with the aligned block containing the address
+    uint32_t block_address = address & ~((uint32_t)QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - 1);
+    victim->valid          = false;
+    if (flash_read_range(block_address, victim->data, QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE) != FLASH_STATUS_SUCCESS) {
+        qp_dprintf("flash_cache_get: fail (could not read 0x%08X)\n", (unsigned int)block_address);
+        return STREAM_EOF;
+    }
+
+    victim->address   = block_address;
+    victim->valid     = true;
+    victim->last_used = ++flash_cache_clock;
+    return victim->data[address - block_address];
+}
+
+static inline int16_t flash_get(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    if (s->position >= s->length) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+    int16_t c = flash_cache_get(s->address + s->position);
+    if (c == STREAM_EOF) {
+        s->is_eof = true;
+        return STREAM_EOF;
+    }
+    s->position++;
+    return c;
+}
+
+static inline bool flash_put(qp_stream_t *stream, uint8_t c) {
+    // Flash streams are read-only, assets are written to flash out-of-band.
+    return false;
+}
+
+static inline int flash_seek(qp_stream_t *stream, int32_t offset, int origin) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+
+    // Handle as per fseek
+    int32_t position = s->position;
+    switch (origin) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position += offset;
+            break;
+        case SEEK_END:
+            position = s->length + offset;
+            break;
+        default:
+            return -1;
+    }
+
+    // Same bounds semantics as memory streams
+    if (position < 0 || position > s->length) {
+        return -1;
+    }
+
+    s->position = position;
+    s->is_eof   = false;
+    return 0;
+}
+
+static inline int32_t flash_tell(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->position;
+}
+
+static inline bool flash_is_eof(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->is_eof;
+}
+
+static inline void flash_close(qp_stream_t *stream) {
+    // No-op.
+}
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length) {
+    qp_flash_stream_t stream = {
+        .base     = {.get = flash_get, .put = flash_put, .seek = flash_seek, .tell = flash_tell, .is_eof = flash_is_eof, .close = flash_close},
+        .address  = address,
+        .length   = length,
+        .position = 0,
+    };
+    return stream;
+}
+
+#endif // FLASH_ENABLE
@@ -32,6 +32,7 @@ SRC += \
     $(QUANTUM_DIR)/painter/qp.c \
     $(QUANTUM_DIR)/painter/qp_internal.c \
     $(QUANTUM_DIR)/painter/qp_stream.c \
+    $(QUANTUM_DIR)/painter/qp_asset_store.c \
     $(QUANTUM_DIR)/painter/qgf.c \
     $(QUANTUM_DIR)/painter/qff.c \
     $(QUANTUM_DIR)/painter/qp_draw_core.c \
@@ -222,7 +223,8 @@ ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_SURFACE)), yes)
     SRC += \
         $(DRIVER_PATH)/painter/generic/qp_surface_common.c \
         $(DRIVER_PATH)/painter/generic/qp_surface_mono1bpp.c \
-        $(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c
+        $(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
+        $(DRIVER_PATH)/painter/generic/qp_surface_tiled_rgb565.c
 endif
 
 # If dummy comms is needed, set up the required files
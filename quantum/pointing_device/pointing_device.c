@@ -19,6 +19,7 @@
 #include "pointing_device.h"
 #include <string.h>
 #include "timer.h"
+#include "sync_timer.h"
 #include "gpio.h"
 
 #ifdef MOUSEKEY_ENABLE
@@ -35,12 +36,19 @@
 #    endif
 #endif
 
+#if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_MOTION_PIN) && !defined(POINTING_DEVICE_MOTION_PIN_RIGHT)
+#    define POINTING_DEVICE_MOTION_PIN_RIGHT POINTING_DEVICE_MOTION_PIN
+#endif
+
 #if defined(SPLIT_POINTING_ENABLE)
 #    include "transactions.h"
 #    include "keyboard.h"
 
 report_mouse_t shared_mouse_report = {};
 uint16_t       shared_cpi          = 0;
+#    ifdef POINTING_DEVICE_MOTION_PIN
+static bool shared_motion = false;
+#    endif
 
 /**
  * @brief Sets the shared mouse report used be pointing device task
@@ -66,6 +74,22 @@ uint16_t pointing_device_get_shared_cpi(void) {
     return shared_cpi;
 }
 
+#    ifdef POINTING_DEVICE_MOTION_PIN
+/**
+ * @brief Flags the shared mouse report as holding new motion
+ *
+ * The motion is reported once, by the next pointing device task regardless of POINTING_DEVICE_TASK_THROTTLE_MS.
+ *
+ * NOTE : Only available when using SPLIT_POINTING_ENABLE and POINTING_DEVICE_MOTION_PIN
+ *
+ * @param[in] timestamp sync timer at which the other side detected the motion
+ */
+void pointing_device_set_shared_motion(uint32_t timestamp) {
+    shared_motion = true;
+    pointing_device_motion_time_update(timestamp);
+}
+#    endif
+
 #    if defined(POINTING_DEVICE_LEFT)
 #        define POINTING_DEVICE_THIS_SIDE is_keyboard_left()
 #    elif defined(POINTING_DEVICE_RIGHT)
@@ -78,6 +102,12 @@ uint16_t pointing_device_get_shared_cpi(void) {
 
 static report_mouse_t local_mouse_report         = {};
 static bool           pointing_device_force_send = false;
+#ifdef POINTING_DEVICE_MOTION_PIN
+static uint32_t motion_time = 0;
+#endif
+#ifdef POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+static touch_gesture_t touch_gesture = {0};
+#endif
 
 #define POINTING_DEVICE_DRIVER_CONCAT(name) name##_pointing_device_driver
 #define POINTING_DEVICE_DRIVER(name) POINTING_DEVICE_DRIVER_CONCAT(name)
@@ -102,6 +132,93 @@ const pointing_device_driver_t custom_pointing_device_driver = {
 
 const pointing_device_driver_t *pointing_device_driver = &POINTING_DEVICE_DRIVER(POINTING_DEVICE_DRIVER_NAME);
 
+#ifdef POINTING_DEVICE_MOTION_PIN
+#    if defined(SPLIT_POINTING_ENABLE)
+#        define POINTING_DEVICE_MOTION_PIN_THIS_SIDE (is_keyboard_left() ? POINTING_DEVICE_MOTION_PIN : POINTING_DEVICE_MOTION_PIN_RIGHT)
+#    else
+#        define POINTING_DEVICE_MOTION_PIN_THIS_SIDE POINTING_DEVICE_MOTION_PIN
+#    endif
+
+/**
+ * @brief Checks the motion pin of the local pointing device
+ *
+ * Sensors hold the motion pin active while they have motion which has not been read yet.
+ *
+ * NOTE : Only available when using POINTING_DEVICE_MOTION_PIN
+ *
+ * @return true if the sensor has motion to read
+ */
+bool pointing_device_motion_detected(void) {
+#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    return !gpio_read_pin(POINTING_DEVICE_MOTION_PIN_THIS_SIDE);
+#    else
+    return gpio_read_pin(POINTING_DEVICE_MOTION_PIN_THIS_SIDE);
+#    endif
+}
+
+/**
+ * @brief Records the time of new motion
+ *
+ * NOTE : Only available when using POINTING_DEVICE_MOTION_PIN
+ *
+ * @param[in] timestamp sync timer at which the motion was detected
+ */
+void pointing_device_motion_time_update(uint32_t timestamp) {
+    motion_time = timestamp;
+}
+
+/**
+ * @brief Gets the time at which motion was last detected by a motion pin
+ *
+ * NOTE : Only available when using POINTING_DEVICE_MOTION_PIN
+ *
+ * @return sync timer of the last motion
+ */
+uint32_t pointing_device_get_motion_time(void) {
+    return motion_time;
+}
+#endif
+
+/**
+ * @brief Checks whether the local pointing device should be read
+ *
+ * Without a motion pin the pointing device is read on every task.
+ *
+ * @return true if the local pointing device has motion to read
+ */
+static inline bool pointing_device_local_motion(void) {
+#ifdef POINTING_DEVICE_MOTION_PIN
+    if (!pointing_device_motion_detected()) {
+        return false;
+    }
+    pointing_device_motion_time_update(sync_timer_read32());
+#endif
+    return true;
+}
+
+/**
+ * @brief Checks whether motion is waiting to be reported, which bypasses the task throttle
+ *
+ * @return true if either side signalled motion through its motion pin
+ */
+static inline bool pointing_device_motion_pending(void) {
+#ifdef POINTING_DEVICE_MOTION_PIN
+#    if defined(SPLIT_POINTING_ENABLE)
+    if (shared_motion) {
+        return true;
+    }
+#        if defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
+    if (!(POINTING_DEVICE_THIS_SIDE)) {
+        return false;
+    }
+#        endif
+#    endif
+    return pointing_device_motion_detected();
+#else
+    return false;
+#endif
+}
+
 /**
  * @brief Keyboard level code pointing device initialisation
  *
@@ -170,9 +287,9 @@ __attribute__((weak)) void pointing_device_init(void) {
         pointing_device_driver->init();
 #ifdef POINTING_DEVICE_MOTION_PIN
 #    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
-        gpio_set_pin_input_high(POINTING_DEVICE_MOTION_PIN);
+        gpio_set_pin_input_high(POINTING_DEVICE_MOTION_PIN_THIS_SIDE);
 #    else
-        gpio_set_pin_input(POINTING_DEVICE_MOTION_PIN);
+        gpio_set_pin_input(POINTING_DEVICE_MOTION_PIN_THIS_SIDE);
 #    endif
 #endif
     }
@@ -239,11 +356,71 @@ report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report) {
     return mouse_report;
 }
 
+#ifdef POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+/**
+ * @brief Applies the default actions of the touch gestures recognized since the last task
+ *
+ * Taps click the button matching the number of fingers for a single report, and two finger scrolls move the wheel.
+ * Pinches and swipes only show up in pointing_device_get_touch_gesture, for pointing_device_task_kb/user to act on.
+ *
+ * NOTE : Only available when using POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t with the gesture actions added
+ */
+static report_mouse_t pointing_device_touch_gesture_task(report_mouse_t mouse_report) {
+    static int16_t                   scroll_h   = 0;
+    static int16_t                   scroll_v   = 0;
+    static bool                      tap_held   = false;
+    static pointing_device_buttons_t tap_button = POINTING_DEVICE_BUTTON1;
+
+    if (tap_held) {
+        mouse_report.buttons = pointing_device_handle_buttons(mouse_report.buttons, false, tap_button);
+        tap_held             = false;
+    }
+
+    touch_gesture = touch_gesture_task();
+    switch (touch_gesture.type) {
+        case TOUCH_GESTURE_TAP:
+            if (touch_gesture.fingers <= 3) {
+                tap_button           = POINTING_DEVICE_BUTTON1 + touch_gesture.fingers - 1;
+                tap_held             = true;
+                mouse_report.buttons = pointing_device_handle_buttons(mouse_report.buttons, true, tap_button);
+            }
+            break;
+        case TOUCH_GESTURE_SCROLL:
+            // Keep the motion short of a wheel step for the next scroll
+            scroll_h += touch_gesture.x;
+            scroll_v -= touch_gesture.y;
+            mouse_report.h = scroll_h / POINTING_DEVICE_GESTURES_SCROLL_DIVISOR;
+            mouse_report.v = scroll_v / POINTING_DEVICE_GESTURES_SCROLL_DIVISOR;
+            scroll_h -= mouse_report.h * POINTING_DEVICE_GESTURES_SCROLL_DIVISOR;
+            scroll_v -= mouse_report.v * POINTING_DEVICE_GESTURES_SCROLL_DIVISOR;
+            break;
+        default:
+            scroll_h = scroll_v = 0;
+            break;
+    }
+    return mouse_report;
+}
+
+/**
+ * @brief Gets the touch gesture recognized by the last pointing device task
+ *
+ * NOTE : Only available when using POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+ *
+ * @return touch_gesture_t, of type TOUCH_GESTURE_NONE if there was none
+ */
+touch_gesture_t pointing_device_get_touch_gesture(void) {
+    return touch_gesture;
+}
+#endif
+
 /**
  * @brief Retrieves and processes pointing device data.
  *
  * This function is part of the keyboard loop and retrieves the mouse report from the pointing device driver.
- * It applies any optional configuration e.g. rotation or axis inversion and then initiates a send.
+ * It applies any optional configuration e.g. rotation, axis inversion or scaling and then initiates a send.
  *
  */
 __attribute__((weak)) bool pointing_device_task(void) {
@@ -256,43 +433,35 @@ __attribute__((weak)) bool pointing_device_task(void) {
 
 #if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
-    if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
+    if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS && !pointing_device_motion_pending()) {
         return false;
     }
     last_exec = timer_read32();
 #endif
 
     // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
-#    if defined(SPLIT_POINTING_ENABLE)
-#        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
-#    endif
-#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
-    if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    else
-    if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    endif
-    {
-#endif
-
 #if defined(SPLIT_POINTING_ENABLE)
 #    if defined(POINTING_DEVICE_COMBINED)
-        static uint8_t old_buttons = 0;
-        local_mouse_report.buttons = old_buttons;
-        local_mouse_report         = pointing_device_driver->get_report(local_mouse_report);
-        old_buttons                = local_mouse_report.buttons;
+    static uint8_t old_buttons = 0;
+    local_mouse_report.buttons = old_buttons;
+    if (pointing_device_local_motion()) {
+        local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
+    }
+    old_buttons = local_mouse_report.buttons;
 #    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
-        local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_report(local_mouse_report) : shared_mouse_report;
+    if (!(POINTING_DEVICE_THIS_SIDE)) {
+        local_mouse_report = shared_mouse_report;
+    } else if (pointing_device_local_motion()) {
+        local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
+    }
 #    else
 #        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
 #    endif
 #else
-    local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
-#endif // defined(SPLIT_POINTING_ENABLE)
-
-#ifdef POINTING_DEVICE_MOTION_PIN
+    if (pointing_device_local_motion()) {
+        local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
     }
-#endif
+#endif // defined(SPLIT_POINTING_ENABLE)
 
     // allow kb to intercept and modify report
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
@@ -303,10 +472,31 @@ __attribute__((weak)) bool pointing_device_task(void) {
         local_mouse_report  = pointing_device_adjust_by_defines_right(local_mouse_report);
         shared_mouse_report = pointing_device_adjust_by_defines(shared_mouse_report);
     }
+#    ifdef POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+    local_mouse_report = pointing_device_touch_gesture_task(local_mouse_report);
+#    endif
+#    ifdef POINTING_DEVICE_HIRES_ENABLE
+    local_mouse_report  = pointing_device_hires_task(local_mouse_report);
+    shared_mouse_report = pointing_device_hires_task_shared(shared_mouse_report);
+#    endif
     local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
 #else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
+#    ifdef POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+    local_mouse_report = pointing_device_touch_gesture_task(local_mouse_report);
+#    endif
+#    ifdef POINTING_DEVICE_HIRES_ENABLE
+    local_mouse_report = pointing_device_hires_task(local_mouse_report);
+#    endif
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
+#endif
+#if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_MOTION_PIN)
+    // Motion read on the other side is only reported once, its next report is flagged through the transport
+    shared_mouse_report.x = 0;
+    shared_mouse_report.y = 0;
+    shared_mouse_report.h = 0;
+    shared_mouse_report.v = 0;
+    shared_motion         = false;
 #endif
     // automatic mouse layer function
 #ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
@@ -32,6 +32,14 @@ typedef struct {
 #    include "pointing_device_auto_mouse.h"
 #endif
 
+#ifdef POINTING_DEVICE_HIRES_ENABLE
+#    include "pointing_device_hires.h"
+#endif
+
+#ifdef POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+#    include "pointing_device_gestures.h"
+#endif
+
 #if defined(POINTING_DEVICE_DRIVER_adns5050)
 #    include "drivers/sensors/adns5050.h"
 #    define POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
@@ -130,9 +138,22 @@ uint8_t        pointing_device_handle_buttons(uint8_t buttons, bool pressed, poi
 report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report);
 void           pointing_device_keycode_handler(uint16_t keycode, bool pressed);
 
+#ifdef POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+touch_gesture_t pointing_device_get_touch_gesture(void);
+#endif
+
+#ifdef POINTING_DEVICE_MOTION_PIN
+bool     pointing_device_motion_detected(void);
+void     pointing_device_motion_time_update(uint32_t timestamp);
+uint32_t pointing_device_get_motion_time(void);
+#endif
+
 #if defined(SPLIT_POINTING_ENABLE)
 void     pointing_device_set_shared_report(report_mouse_t report);
 uint16_t pointing_device_get_shared_cpi(void);
+#    ifdef POINTING_DEVICE_MOTION_PIN
+void pointing_device_set_shared_motion(uint32_t timestamp);
+#    endif
 #    if !defined(POINTING_DEVICE_TASK_THROTTLE_MS)
 #        define POINTING_DEVICE_TASK_THROTTLE_MS 1
 #    endif
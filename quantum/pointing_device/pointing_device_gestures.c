@@ -13,6 +13,7 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <stdlib.h>
 #include <string.h>
 #include "pointing_device_gestures.h"
 #include "timer.h"
@@ -131,3 +132,197 @@ void cursor_glide_update(cursor_glide_context_t* glide, mouse_xy_report_t dx, mo
     status->z   = z;
 }
 #endif
+
+#ifdef POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+#    define TOUCH_SAMPLES_MASK (POINTING_DEVICE_GESTURES_TOUCH_SAMPLES - 1)
+
+typedef enum {
+    TOUCH_IDLE,
+    TOUCH_UNDECIDED, /* Fingers down, no gesture recognized yet */
+    TOUCH_SCROLLING,
+    TOUCH_PINCHING,
+    TOUCH_DONE, /* Gesture over or ruled out, waiting for the fingers to lift */
+} touch_state_t;
+
+typedef struct {
+    touch_state_t state;
+    uint8_t       fingers;     /* Fingers on the sensor in the last sample */
+    uint8_t       max_fingers; /* Most fingers on the sensor during this touch */
+    bool          moved;       /* Moved too far for a tap */
+    uint16_t      down_time;
+    uint16_t      anchor_time; /* Time of the anchor, which moves whenever a finger lands or lifts */
+    int16_t       anchor_x;
+    int16_t       anchor_y;
+    int16_t       anchor_spread;
+    int16_t       last_x;
+    int16_t       last_y;
+    int16_t       last_spread;
+} touch_status_t;
+
+static touch_sample_t  touch_samples[POINTING_DEVICE_GESTURES_TOUCH_SAMPLES];
+static uint8_t         touch_head    = 0;
+static uint8_t         touch_tail    = 0;
+static touch_status_t  touch         = {0};
+static touch_gesture_t touch_pending = {0};
+
+void touch_gesture_record(const touch_sample_t* sample) {
+    touch_samples[touch_head] = *sample;
+    touch_head                = (touch_head + 1) & TOUCH_SAMPLES_MASK;
+    if (touch_head == touch_tail) {
+        /* Full, drop the oldest sample */
+        touch_tail = (touch_tail + 1) & TOUCH_SAMPLES_MASK;
+    }
+}
+
+void touch_gesture_reset(void) {
+    touch_head = touch_tail = 0;
+    memset(&touch, 0, sizeof(touch));
+    memset(&touch_pending, 0, sizeof(touch_pending));
+}
+
+/* Approximates the length of a vector, within 12% and without a square root */
+static int16_t touch_distance(int16_t dx, int16_t dy) {
+    int32_t ax = abs(dx);
+    int32_t ay = abs(dy);
+    int32_t d  = ax > ay ? ax + ay / 2 : ay + ax / 2;
+    return d > INT16_MAX ? INT16_MAX : d;
+}
+
+static void touch_anchor(const touch_sample_t* sample, int16_t x, int16_t y, int16_t spread) {
+    touch.fingers       = sample->fingers;
+    touch.anchor_time   = sample->time;
+    touch.anchor_x      = touch.last_x      = x;
+    touch.anchor_y      = touch.last_y      = y;
+    touch.anchor_spread = touch.last_spread = spread;
+}
+
+static bool touch_gesture_is_continuous(touch_gesture_type_t type) {
+    return type == TOUCH_GESTURE_SCROLL || type == TOUCH_GESTURE_PINCH;
+}
+
+/**
+ * @brief Advances the recognizer by one sample
+ *
+ * @param[in] sample touch sample, oldest first
+ * @return gesture recognized from this sample, with the motion since the previous sample for scroll and pinch
+ */
+static touch_gesture_t touch_gesture_process(const touch_sample_t* sample) {
+    touch_gesture_t gesture = {.type = TOUCH_GESTURE_NONE};
+
+    if (!sample->fingers) {
+        if (touch.state == TOUCH_UNDECIDED && !touch.moved && TIMER_DIFF_16(sample->time, touch.down_time) <= POINTING_DEVICE_GESTURES_TAP_TERM) {
+            gesture.type    = TOUCH_GESTURE_TAP;
+            gesture.fingers = touch.max_fingers;
+        }
+        touch.state = TOUCH_IDLE;
+        return gesture;
+    }
+
+    /* Centroid of the contacts, and the distance between the first two */
+    uint8_t contacts = sample->fingers < TOUCH_SAMPLE_CONTACTS ? sample->fingers : TOUCH_SAMPLE_CONTACTS;
+    int32_t sum_x    = 0, sum_y = 0;
+    for (uint8_t i = 0; i < contacts; i++) {
+        sum_x += sample->contacts[i].x;
+        sum_y += sample->contacts[i].y;
+    }
+    int16_t x      = sum_x / contacts;
+    int16_t y      = sum_y / contacts;
+    int16_t spread = contacts > 1 ? touch_distance(sample->contacts[1].x - sample->contacts[0].x, sample->contacts[1].y - sample->contacts[0].y) : 0;
+
+    if (touch.state == TOUCH_IDLE) {
+        touch.state       = TOUCH_UNDECIDED;
+        touch.down_time   = sample->time;
+        touch.max_fingers = sample->fingers;
+        touch.moved       = false;
+        touch_anchor(sample, x, y, spread);
+        return gesture;
+    }
+
+    if (sample->fingers != touch.fingers) {
+        /* Fingers rarely land or lift at exactly the same time, start over from the new contacts */
+        if (sample->fingers > touch.max_fingers) {
+            touch.max_fingers = sample->fingers;
+        } else if (touch.state != TOUCH_UNDECIDED) {
+            touch.state = TOUCH_DONE;
+        }
+        touch_anchor(sample, x, y, spread);
+        return gesture;
+    }
+
+    int16_t dx = x - touch.anchor_x;
+    int16_t dy = y - touch.anchor_y;
+    if (touch_distance(dx, dy) > POINTING_DEVICE_GESTURES_TAP_DISTANCE) {
+        touch.moved = true;
+    }
+
+    if (touch.state == TOUCH_UNDECIDED) {
+        if (sample->fingers >= POINTING_DEVICE_GESTURES_SWIPE_FINGERS) {
+            if (touch_distance(dx, dy) >= POINTING_DEVICE_GESTURES_SWIPE_DISTANCE) {
+                if (TIMER_DIFF_16(sample->time, touch.anchor_time) <= POINTING_DEVICE_GESTURES_SWIPE_TERM) {
+                    gesture.type    = TOUCH_GESTURE_SWIPE;
+                    gesture.fingers = sample->fingers;
+                    gesture.x       = dx;
+                    gesture.y       = dy;
+                }
+                touch.state = TOUCH_DONE;
+            }
+            return gesture;
+        }
+        if (sample->fingers >= 2) {
+            if (abs(spread - touch.anchor_spread) >= POINTING_DEVICE_GESTURES_PINCH_DISTANCE) {
+                touch.state = TOUCH_PINCHING;
+            } else if (touch_distance(dx, dy) >= POINTING_DEVICE_GESTURES_SCROLL_DISTANCE) {
+                touch.state = TOUCH_SCROLLING;
+            }
+            if (touch.state != TOUCH_UNDECIDED) {
+                touch.last_x      = touch.anchor_x;
+                touch.last_y      = touch.anchor_y;
+                touch.last_spread = touch.anchor_spread;
+            }
+        }
+    }
+
+    /* Scroll and pinch report everything since the anchor, so that no motion is lost to the thresholds */
+    if (touch.state == TOUCH_SCROLLING) {
+        gesture.type    = TOUCH_GESTURE_SCROLL;
+        gesture.fingers = sample->fingers;
+        gesture.x       = x - touch.last_x;
+        gesture.y       = y - touch.last_y;
+    } else if (touch.state == TOUCH_PINCHING) {
+        gesture.type    = TOUCH_GESTURE_PINCH;
+        gesture.fingers = sample->fingers;
+        gesture.pinch   = spread - touch.last_spread;
+    }
+    touch.last_x      = x;
+    touch.last_y      = y;
+    touch.last_spread = spread;
+
+    return gesture;
+}
+
+touch_gesture_t touch_gesture_task(void) {
+    touch_gesture_t gesture = touch_pending;
+    touch_pending.type      = TOUCH_GESTURE_NONE;
+
+    while (touch_tail != touch_head && (gesture.type == TOUCH_GESTURE_NONE || touch_gesture_is_continuous(gesture.type))) {
+        touch_gesture_t event = touch_gesture_process(&touch_samples[touch_tail]);
+        touch_tail            = (touch_tail + 1) & TOUCH_SAMPLES_MASK;
+
+        if (event.type == TOUCH_GESTURE_NONE) {
+            continue;
+        } else if (gesture.type == TOUCH_GESTURE_NONE) {
+            gesture = event;
+        } else if (gesture.type == event.type) {
+            gesture.x += event.x;
+            gesture.y += event.y;
+            gesture.pinch += event.pinch;
+        } else {
+            /* A different gesture, keep it for the next task */
+            touch_pending = event;
+            break;
+        }
+    }
+
+    return gesture;
+}
+#endif
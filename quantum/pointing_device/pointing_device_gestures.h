@@ -56,3 +56,76 @@ cursor_glide_t cursor_glide_start(cursor_glide_context_t* glide);
 /* Update glide engine on the latest cursor movement, cursor glide is based on the final movement */
 void cursor_glide_update(cursor_glide_context_t* glide, mouse_xy_report_t dx, mouse_xy_report_t dy, uint16_t z);
 #endif
+
+#ifdef POINTING_DEVICE_GESTURES_TOUCH_ENABLE
+#    ifndef POINTING_DEVICE_GESTURES_TOUCH_SAMPLES
+#        define POINTING_DEVICE_GESTURES_TOUCH_SAMPLES 16
+#    endif
+#    if (POINTING_DEVICE_GESTURES_TOUCH_SAMPLES & (POINTING_DEVICE_GESTURES_TOUCH_SAMPLES - 1)) != 0 || POINTING_DEVICE_GESTURES_TOUCH_SAMPLES > 128
+#        error "POINTING_DEVICE_GESTURES_TOUCH_SAMPLES must be a power of two, up to 128"
+#    endif
+/* Distances are in sensor coordinates, times in milliseconds */
+#    ifndef POINTING_DEVICE_GESTURES_TAP_TERM
+#        define POINTING_DEVICE_GESTURES_TAP_TERM 200
+#    endif
+#    ifndef POINTING_DEVICE_GESTURES_TAP_DISTANCE
+#        define POINTING_DEVICE_GESTURES_TAP_DISTANCE 30
+#    endif
+#    ifndef POINTING_DEVICE_GESTURES_SCROLL_DISTANCE
+#        define POINTING_DEVICE_GESTURES_SCROLL_DISTANCE 30
+#    endif
+#    ifndef POINTING_DEVICE_GESTURES_SCROLL_DIVISOR
+#        define POINTING_DEVICE_GESTURES_SCROLL_DIVISOR 16
+#    endif
+#    ifndef POINTING_DEVICE_GESTURES_PINCH_DISTANCE
+#        define POINTING_DEVICE_GESTURES_PINCH_DISTANCE 60
+#    endif
+#    ifndef POINTING_DEVICE_GESTURES_SWIPE_DISTANCE
+#        define POINTING_DEVICE_GESTURES_SWIPE_DISTANCE 200
+#    endif
+#    ifndef POINTING_DEVICE_GESTURES_SWIPE_TERM
+#        define POINTING_DEVICE_GESTURES_SWIPE_TERM 300
+#    endif
+#    ifndef POINTING_DEVICE_GESTURES_SWIPE_FINGERS
+#        define POINTING_DEVICE_GESTURES_SWIPE_FINGERS 3
+#    endif
+
+/* Number of contacts whose positions a touch sample carries */
+#    define TOUCH_SAMPLE_CONTACTS 2
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+} touch_contact_t;
+
+typedef struct {
+    uint16_t        time;    /* timer_read() when the sample was taken */
+    uint8_t         fingers; /* Number of fingers on the sensor, 0 once lifted */
+    touch_contact_t contacts[TOUCH_SAMPLE_CONTACTS];
+} touch_sample_t;
+
+typedef enum {
+    TOUCH_GESTURE_NONE,
+    TOUCH_GESTURE_TAP,    /* Fingers lifted quickly without moving */
+    TOUCH_GESTURE_SCROLL, /* Two fingers moving together, x and y give the motion */
+    TOUCH_GESTURE_PINCH,  /* Two fingers moving apart or together, pinch gives the change of distance */
+    TOUCH_GESTURE_SWIPE,  /* Quick motion of POINTING_DEVICE_GESTURES_SWIPE_FINGERS fingers, x and y give the distance */
+} touch_gesture_type_t;
+
+typedef struct {
+    touch_gesture_type_t type;
+    uint8_t              fingers;
+    int16_t              x;
+    int16_t              y;
+    int16_t              pinch;
+} touch_gesture_t;
+
+/* Queue a touch sample from the sensor, to be recognized on the next pointing device task */
+void touch_gesture_record(const touch_sample_t* sample);
+
+/* Recognize the queued samples. Scroll and pinch motion is merged, tap and swipe are returned one at a time */
+touch_gesture_t touch_gesture_task(void);
+
+/* Drop the queued samples and any touch in progress */
+void touch_gesture_reset(void);
+#endif
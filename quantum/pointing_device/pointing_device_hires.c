@@ -0,0 +1,212 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_HIRES_ENABLE
+
+#    include <stdlib.h>
+#    include <string.h>
+#    include "pointing_device.h"
+#    include "util.h"
+
+#    define Q16_ONE 65536
+
+static pointing_device_hires_t hires_local = {};
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+static pointing_device_hires_t hires_shared = {};
+#    endif
+static uint32_t hires_scale       = POINTING_DEVICE_HIRES_SCALE;
+static uint32_t hires_wheel_scale = POINTING_DEVICE_HIRES_WHEEL_SCALE;
+
+#    ifdef POINTING_DEVICE_ACCEL_CURVE
+static const pointing_device_accel_point_t accel_curve[] = POINTING_DEVICE_ACCEL_CURVE;
+#    endif
+
+/**
+ * @brief Multiplies two Q16 factors, saturating so that any count times the result fits in 64 bits
+ */
+static int32_t hires_factor(uint32_t a, uint32_t b) {
+    uint64_t factor = ((uint64_t)a * b) >> 16;
+    return factor > INT32_MAX ? INT32_MAX : (int32_t)factor;
+}
+
+/**
+ * @brief Adds scaled counts to the remainder of an axis, and takes out as much as one report can hold
+ *
+ * Whatever doesn't fit, fractions of a count as well as motion beyond the report range, stays in the remainder for
+ * the following reports.
+ *
+ * @param[in,out] remainder motion not yet reported, in Q16
+ * @param[in] counts motion from the sensor
+ * @param[in] factor Q16 factor applied to counts
+ * @param[in] min lowest value the report can hold
+ * @param[in] max highest value the report can hold
+ * @return motion to report
+ */
+static int32_t hires_accumulate(int32_t *remainder, int32_t counts, int32_t factor, int32_t min, int32_t max) {
+    int64_t total = *remainder + (int64_t)counts * factor;
+    if (total > INT32_MAX) {
+        total = INT32_MAX;
+    } else if (total < INT32_MIN) {
+        total = INT32_MIN;
+    }
+
+    // Truncating toward zero leaves the remainder with the sign of the motion
+    int32_t report = (int32_t)total / Q16_ONE;
+    if (report < min) {
+        report = min;
+    } else if (report > max) {
+        report = max;
+    }
+    *remainder = (int32_t)total - report * Q16_ONE;
+    return report;
+}
+
+/**
+ * @brief Approximates the length of the motion vector, within 12% and without a square root
+ */
+static uint16_t hires_speed(int32_t x, int32_t y) {
+    uint32_t ax    = abs(x);
+    uint32_t ay    = abs(y);
+    uint32_t speed = ax > ay ? ax + ay / 2 : ay + ax / 2;
+    return speed > UINT16_MAX ? UINT16_MAX : speed;
+}
+
+/**
+ * @brief Gain of the acceleration curve configured by POINTING_DEVICE_ACCEL_CURVE
+ *
+ * Interpolates linearly between the points of the curve, which are sorted by speed, and holds the gain of the first
+ * and last points beyond them. Without a curve the gain is 1.
+ *
+ * @param[in] speed sensor counts per report
+ * @return gain in Q16
+ */
+uint32_t pointing_device_accel_curve(uint16_t speed) {
+#    ifdef POINTING_DEVICE_ACCEL_CURVE
+    if (speed <= accel_curve[0].speed) {
+        return accel_curve[0].gain;
+    }
+    for (uint8_t i = 1; i < ARRAY_SIZE(accel_curve); i++) {
+        if (speed < accel_curve[i].speed) {
+            const pointing_device_accel_point_t *low  = &accel_curve[i - 1];
+            const pointing_device_accel_point_t *high = &accel_curve[i];
+            return low->gain + ((int64_t)high->gain - low->gain) * (speed - low->speed) / (high->speed - low->speed);
+        }
+    }
+    return accel_curve[ARRAY_SIZE(accel_curve) - 1].gain;
+#    else
+    return Q16_ONE;
+#    endif
+}
+
+/**
+ * @brief Weak function allowing for keyboard level acceleration
+ *
+ * @param[in] speed sensor counts per report
+ * @return gain in Q16, pointing_device_accel_user(speed) by default
+ */
+__attribute__((weak)) uint32_t pointing_device_accel_kb(uint16_t speed) {
+    return pointing_device_accel_user(speed);
+}
+
+/**
+ * @brief Weak function allowing for user level acceleration
+ *
+ * @param[in] speed sensor counts per report
+ * @return gain in Q16, pointing_device_accel_curve(speed) by default
+ */
+__attribute__((weak)) uint32_t pointing_device_accel_user(uint16_t speed) {
+    return pointing_device_accel_curve(speed);
+}
+
+/**
+ * @brief Scales and accelerates the motion of a mouse report
+ *
+ * Motion is tracked in Q16 per sensor, so that scaling below one count and acceleration beyond the report range both
+ * end up in later reports rather than being dropped.
+ *
+ * @param[in,out] hires motion of the sensor not yet reported
+ * @param[in] mouse_report report_mouse_t with the motion read from the sensor
+ * @return report_mouse_t with the motion to report
+ */
+report_mouse_t pointing_device_hires_apply(pointing_device_hires_t *hires, report_mouse_t mouse_report) {
+    int32_t xy_factor = hires_factor(hires_scale, pointing_device_accel_kb(hires_speed(mouse_report.x, mouse_report.y)));
+    int32_t hv_factor = hires_factor(hires_wheel_scale, Q16_ONE);
+
+    mouse_report.x = hires_accumulate(&hires->x, mouse_report.x, xy_factor, XY_REPORT_MIN, XY_REPORT_MAX);
+    mouse_report.y = hires_accumulate(&hires->y, mouse_report.y, xy_factor, XY_REPORT_MIN, XY_REPORT_MAX);
+    mouse_report.h = hires_accumulate(&hires->h, mouse_report.h, hv_factor, HV_REPORT_MIN, HV_REPORT_MAX);
+    mouse_report.v = hires_accumulate(&hires->v, mouse_report.v, hv_factor, HV_REPORT_MIN, HV_REPORT_MAX);
+    return mouse_report;
+}
+
+/**
+ * @brief Applies the high resolution pipeline to the report of the local sensor
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t
+ */
+report_mouse_t pointing_device_hires_task(report_mouse_t mouse_report) {
+    return pointing_device_hires_apply(&hires_local, mouse_report);
+}
+
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+/**
+ * @brief Applies the high resolution pipeline to the report shared by the other side
+ *
+ * NOTE: Only available when using SPLIT_POINTING_ENABLE and POINTING_DEVICE_COMBINED
+ *
+ * @param[in] mouse_report report_mouse_t
+ * @return report_mouse_t
+ */
+report_mouse_t pointing_device_hires_task_shared(report_mouse_t mouse_report) {
+    return pointing_device_hires_apply(&hires_shared, mouse_report);
+}
+#    endif
+
+/**
+ * @brief Drops all motion not yet reported
+ */
+void pointing_device_hires_reset(void) {
+    memset(&hires_local, 0, sizeof(hires_local));
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+    memset(&hires_shared, 0, sizeof(hires_shared));
+#    endif
+}
+
+/**
+ * @brief Sets the scale applied to X and Y motion
+ *
+ * @param[in] scale Q16 factor, see POINTING_DEVICE_HIRES_Q16
+ */
+void pointing_device_hires_set_scale(uint32_t scale) {
+    hires_scale = scale;
+}
+
+/**
+ * @brief Gets the scale applied to X and Y motion
+ *
+ * @return Q16 factor
+ */
+uint32_t pointing_device_hires_get_scale(void) {
+    return hires_scale;
+}
+
+/**
+ * @brief Sets the scale applied to wheel motion
+ *
+ * @param[in] scale Q16 factor, see POINTING_DEVICE_HIRES_Q16
+ */
+void pointing_device_hires_set_wheel_scale(uint32_t scale) {
+    hires_wheel_scale = scale;
+}
+
+/**
+ * @brief Gets the scale applied to wheel motion
+ *
+ * @return Q16 factor
+ */
+uint32_t pointing_device_hires_get_wheel_scale(void) {
+    return hires_wheel_scale;
+}
+
+#endif // POINTING_DEVICE_HIRES_ENABLE
@@ -0,0 +1,52 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+
+/* check settings and set defaults */
+#ifndef POINTING_DEVICE_HIRES_ENABLE
+#    error "POINTING_DEVICE_HIRES_ENABLE not defined! check config settings"
+#endif
+
+/* converts a factor to the Q16 fixed point format used for scales and gains, e.g. POINTING_DEVICE_HIRES_Q16(0.25) */
+#define POINTING_DEVICE_HIRES_Q16(factor) ((uint32_t)((factor) * 65536.0 + 0.5))
+
+#ifndef POINTING_DEVICE_HIRES_SCALE
+#    define POINTING_DEVICE_HIRES_SCALE POINTING_DEVICE_HIRES_Q16(1)
+#endif
+#ifndef POINTING_DEVICE_HIRES_WHEEL_SCALE
+#    define POINTING_DEVICE_HIRES_WHEEL_SCALE POINTING_DEVICE_HIRES_Q16(1)
+#endif
+
+/* motion not yet reported, in Q16 report units */
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t h;
+    int32_t v;
+} pointing_device_hires_t;
+
+/* point of the acceleration curve: gain in Q16 at a speed in sensor counts per report */
+typedef struct {
+    uint16_t speed;
+    uint32_t gain;
+} pointing_device_accel_point_t;
+
+report_mouse_t pointing_device_hires_apply(pointing_device_hires_t *hires, report_mouse_t mouse_report);
+report_mouse_t pointing_device_hires_task(report_mouse_t mouse_report);
+#if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+report_mouse_t pointing_device_hires_task_shared(report_mouse_t mouse_report);
+#endif
+void     pointing_device_hires_reset(void);
+void     pointing_device_hires_set_scale(uint32_t scale);
+uint32_t pointing_device_hires_get_scale(void);
+void     pointing_device_hires_set_wheel_scale(uint32_t scale);
+uint32_t pointing_device_hires_get_wheel_scale(void);
+
+uint32_t pointing_device_accel_curve(uint16_t speed);
+uint32_t pointing_device_accel_kb(uint16_t speed);
+uint32_t pointing_device_accel_user(uint16_t speed);
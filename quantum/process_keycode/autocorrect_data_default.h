@@ -75,11 +75,49 @@
 #define AUTOCORRECT_MIN_LENGTH 5  // ":ture"
 #define AUTOCORRECT_MAX_LENGTH 10 // "accomodate"
 
-#define DICTIONARY_SIZE 1104
+#define DICTIONARY_SIZE 1111
+#define AUTOCORRECT_FORWARD_TRIE
+#define AUTOCORRECT_LINK_SHIFT 0
 
-static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {108, 43,  0,   6,   71, 0,  7,   81, 0,   8,   199, 0,   9,   240, 1,  10,  250, 1,  11,  26,  2,   17,  53,  2,   18, 190, 2,   19,  202, 2,   21,  212, 2,   22,  20,  3,   23,  67,  3,   28,  16,  4,   0,  72,  50,  0,   22,  60,  0,   0,   11,  23,  44, 8,   11, 23,  44,  0,   132, 0,   8,   22,  18,  18,  15,  0,  132, 115, 101, 115, 0,   11,  23,  12,  26,  22,  0,   129, 99,  104, 0,   68,  94,  0,   8,   106, 0,   15, 174, 0,   21, 187, 0,   0,   12,  15,  25,  17,  12,  0,   131, 97,  108, 105, 100, 0,   74,  119, 0,   12,  129, 0,   21,  140, 0,   24,  165, 0,   0,   17,  12,  22,  0,   131, 103, 110, 101, 100, 0,   25,  21, 8,   7,   0,   131, 105, 118, 101, 100, 0,   72,  147, 0,  24,  156, 0,  0,   9,   8,   21,  0,   129, 114, 101, 100, 0,   6,   6,   18,  0,   129, 114, 101, 100, 0,   15,  6,   17,  12,  0,   129, 100, 101, 0,   18, 22,  8,   21,  11,  23,  0,   130, 104, 111,
-                                                                  108, 100, 0,   4,   26, 18, 9,   0,  131, 114, 119, 97,  114, 100, 0,  68,  233, 0,  6,   246, 0,   7,   4,   1,   8,  16,  1,   10,  52,  1,   15,  81,  1,   21,  90,  1,   22,  117, 1,   23,  144, 1,   24, 215, 1,   25,  228, 1,   0,   6,   19,  22,  8,  16,  4,  17,  0,   130, 97,  99,  101, 0,   19,  4,   22,  8,  16,  4,   17,  0,   131, 112, 97,  99,  101, 0,   12,  21,  8,   25,  18,  0,   130, 114, 105, 100, 101, 0,  23,  0,   68, 25,  1,   17,  36,  1,   0,   21,  4,   24,  10,  0,   130, 110, 116, 101, 101, 0,   4,   21,  24,  4,   10,  0,   135, 117, 97,  114, 97,  110, 116, 101, 101, 0,   68,  59,  1,   7,   69,  1,   0,  24,  10,  44,  0,   131, 97,  117, 103, 101, 0,   8,   15, 12,  25,  12, 21,  19,  0,   130, 103, 101, 0,   22,  4,   9,   0,   130, 108, 115, 101, 0,   76,  97,  1,   24,  109, 1,   0,   24,  20,  4,   0,   132, 99, 113, 117, 105, 114, 101, 0,   23,  44,  0,
-                                                                  130, 114, 117, 101, 0,  4,  0,   79, 126, 1,   24,  134, 1,   0,   9,  0,   131, 97, 108, 115, 101, 0,   6,   8,   5,  0,   131, 97,  117, 115, 101, 0,   4,   0,   71,  156, 1,   19,  193, 1,   21,  203, 1,  0,   18,  16,  0,   80,  166, 1,   18,  181, 1,  0,   18, 6,   4,   0,   135, 99,  111, 109, 109, 111, 100, 97, 116, 101, 0,   6,   6,   4,   0,   132, 109, 111, 100, 97,  116, 101, 0,   7,   24,  0,   132, 112, 100, 97, 116, 101, 0,  8,   19,  8,   22,  0,   132, 97,  114, 97,  116, 101, 0,   10,  8,   15,  15,  18,  6,   0,   130, 97,  103, 117, 101, 0,   8,   12,  6,   8,   21,  0,   131, 101, 105, 118, 101, 0,   12,  8,   11, 6,   0,   130, 105, 101, 102, 0,   17,  0,   76,  3,   2,  21,  16,  2,  0,   15,  8,   12,  6,   0,   133, 101, 105, 108, 105, 110, 103, 0,   12,  23,  22,  0,   131, 114, 105, 110, 103, 0,   70,  33,  2,   23,  44, 2,   0,   12,  23,  26,  22,  0,   131, 105,
-                                                                  116, 99,  104, 0,   10, 12, 8,   11, 0,   129, 104, 116, 0,   72,  69, 2,   10,  80, 2,   18,  89,  2,   21,  156, 2,  24,  167, 2,   0,   22,  18,  18,  11,  6,   0,   131, 115, 101, 110, 0,   12,  21,  23, 22,  0,   129, 110, 103, 0,   12,  0,   86,  98, 2,   23, 124, 2,   0,   68,  105, 2,   22,  114, 2,   0,   12, 15,  0,   131, 105, 115, 111, 110, 0,   4,   6,   6,   18,  0,   131, 105, 111, 110, 0,   76,  131, 2,   22, 146, 2,   0,  23,  12,  19,  8,   21,  0,   134, 101, 116, 105, 116, 105, 111, 110, 0,   18,  19,  0,   131, 105, 116, 105, 111, 110, 0,   23,  24,  8,   21,  0,   131, 116, 117, 114, 110, 0,   85,  174, 2,   23, 183, 2,   0,   23,  8,   21,  0,   130, 117, 114, 110, 0,  8,   21,  0,  128, 114, 110, 0,   7,   8,   24,  22,  19,  0,   131, 101, 117, 100, 111, 0,   24,  18,  18,  15,  0,   129, 107, 117, 112, 0,   72,  219, 2,  18,  3,   3,   0,   76,  229, 2,   15,  238,
-                                                                  2,   17,  248, 2,   0,  11, 23,  44, 0,   130, 101, 105, 114, 0,   23, 12,  9,   0,  131, 108, 116, 101, 114, 0,   23, 22,  12,  15,  0,   130, 101, 110, 101, 114, 0,   23,  4,   21,  8,   23,  17,  12,  0,  135, 116, 101, 114, 97,  116, 111, 114, 0,   72, 30,  3,  17,  38,  3,   24,  51,  3,   0,   15,  4,   9,   0,  129, 115, 101, 0,   4,   12,  23,  17,  18,  6,   0,   131, 97,  105, 110, 115, 0,   22,  17,  8,   6,   17, 18,  6,   0,  133, 115, 101, 110, 115, 117, 115, 0,   74,  86,  3,   11,  96,  3,   15,  118, 3,   17,  129, 3,   22,  218, 3,   24,  232, 3,   0,   11,  24,  4,   6,   0,   130, 103, 104, 116, 0,   71,  103, 3,  10,  110, 3,   0,   12,  26,  0,   129, 116, 104, 0,   17, 8,   15,  0,  129, 116, 104, 0,   22,  24,  8,   21,  0,   131, 115, 117, 108, 116, 0,   68,  139, 3,   8,   150, 3,   22,  210, 3,   0,   21,  4,   19,  19, 4,   0,   130, 101, 110, 116, 0,   85,  157,
-                                                                  3,   25,  200, 3,   0,  68, 164, 3,  21,  175, 3,   0,   19,  4,   0,  132, 112, 97, 114, 101, 110, 116, 0,   4,   19, 0,   68,  185, 3,   19,  193, 3,   0,   133, 112, 97,  114, 101, 110, 116, 0,   4,   0,  131, 101, 110, 116, 0,   8,   15,  8,   21,  0,  130, 97, 110, 116, 0,   18,  6,   0,   130, 110, 115, 116, 0,  12,  9,   8,   17,  4,   16,  0,   132, 105, 102, 101, 115, 116, 0,   83,  239, 3,   23,  6,   4,   0,   87, 246, 3,   24, 254, 3,   0,   17,  12,  0,   131, 112, 117, 116, 0,   18,  0,   130, 116, 112, 117, 116, 0,   19,  24,  18,  0,   131, 116, 112, 117, 116, 0,   70,  29,  4,   8,   41,  4,   11,  51,  4,   21,  69, 4,   0,   8,   24,  20,  8,   21,  9,   0,   129, 110, 99, 121, 0,   23, 9,   4,   22,  0,   130, 101, 116, 121, 0,   6,   21,  4,   21,  12,  8,   11,  0,   135, 105, 101, 114, 97,  114, 99,  104, 121, 0,   4,   5,  12,  15,  0,   130, 114, 97,  114, 121, 0};
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    108, 58, 0, 4, 114, 0, 5, 245, 0, 6, 2, 1, 7, 126, 1, 9, 139, 1, 10, 222, 1, 11, 4, 2, 12, 37, 2, 15, 99, 2, 16,
+    186, 2, 17, 201, 2, 18, 232, 2, 19, 53, 3, 21, 100, 3, 22, 210, 3, 23, 55, 4, 24, 69, 4, 26, 82, 4, 0, 74, 65,
+    0, 23, 76, 0, 0, 24, 4, 10, 8, 0, 131, 97, 117, 103, 101, 0, 75, 83, 0, 24, 106, 0, 0, 72, 90, 0, 12, 98, 0, 0,
+    44, 23, 11, 8, 44, 0, 132, 0, 8, 21, 0, 130, 101, 105, 114, 0, 21, 8, 0, 130, 114, 117, 101, 0, 70, 124, 0, 19,
+    166, 0, 20, 232, 0, 0, 70, 131, 0, 18, 147, 0, 0, 18, 16, 18, 7, 4, 23, 8, 0, 132, 109, 111, 100, 97, 116, 101,
+    0, 16, 16, 18, 7, 4, 23, 8, 0, 135, 99, 111, 109, 109, 111, 100, 97, 116, 101, 0, 68, 173, 0, 19, 205, 0, 0, 21,
+    0, 72, 182, 0, 21, 193, 0, 0, 17, 23, 0, 132, 112, 97, 114, 101, 110, 116, 0, 8, 17, 23, 0, 133, 112, 97, 114,
+    101, 110, 116, 0, 4, 21, 0, 68, 215, 0, 21, 223, 0, 0, 17, 23, 0, 130, 101, 110, 116, 0, 8, 17, 23, 0, 131, 101,
+    110, 116, 0, 24, 12, 21, 8, 0, 132, 99, 113, 117, 105, 114, 101, 0, 8, 6, 24, 4, 22, 8, 0, 131, 97, 117, 115,
+    101, 0, 68, 15, 1, 11, 25, 1, 12, 50, 1, 18, 64, 1, 0, 24, 11, 10, 23, 0, 130, 103, 104, 116, 0, 72, 32, 1, 18,
+    40, 1, 0, 12, 9, 0, 130, 105, 101, 102, 0, 18, 22, 8, 17, 0, 131, 115, 101, 110, 0, 8, 15, 12, 17, 10, 0, 133,
+    101, 105, 108, 105, 110, 103, 0, 79, 74, 1, 17, 86, 1, 22, 118, 1, 0, 15, 8, 10, 24, 8, 0, 130, 97, 103, 117,
+    101, 0, 70, 93, 1, 23, 107, 1, 0, 8, 17, 22, 24, 22, 0, 133, 115, 101, 110, 115, 117, 115, 0, 12, 4, 17, 22, 0,
+    131, 97, 105, 110, 115, 0, 17, 23, 0, 130, 110, 115, 116, 0, 8, 21, 25, 12, 8, 7, 0, 131, 105, 118, 101, 100, 0,
+    68, 155, 1, 12, 177, 1, 15, 188, 1, 18, 198, 1, 21, 210, 1, 0, 79, 162, 1, 22, 169, 1, 0, 8, 22, 0, 129, 115,
+    101, 0, 15, 8, 0, 130, 108, 115, 101, 0, 23, 15, 8, 21, 0, 131, 108, 116, 101, 114, 0, 4, 22, 8, 0, 131, 97,
+    108, 115, 101, 0, 26, 4, 21, 7, 0, 131, 114, 119, 97, 114, 100, 0, 8, 20, 24, 8, 6, 28, 0, 129, 110, 99, 121, 0,
+    68, 229, 1, 24, 247, 1, 0, 24, 21, 4, 17, 23, 8, 8, 0, 135, 117, 97, 114, 97, 110, 116, 101, 101, 0, 4, 21, 4,
+    23, 8, 8, 0, 130, 110, 116, 101, 101, 0, 8, 12, 0, 74, 14, 2, 21, 21, 2, 0, 23, 11, 0, 129, 104, 116, 0, 4, 21,
+    6, 11, 28, 0, 135, 105, 101, 114, 97, 114, 99, 104, 121, 0, 17, 0, 70, 49, 2, 23, 58, 2, 25, 88, 2, 0, 15, 24,
+    8, 7, 0, 129, 100, 101, 0, 72, 65, 2, 19, 80, 2, 0, 21, 4, 23, 18, 21, 0, 135, 116, 101, 114, 97, 116, 111, 114,
+    0, 24, 23, 0, 131, 112, 117, 116, 0, 15, 12, 4, 7, 0, 131, 97, 108, 105, 100, 0, 72, 109, 2, 12, 119, 2, 18,
+    161, 2, 0, 17, 10, 0, 11, 23, 0, 129, 116, 104, 0, 68, 129, 2, 5, 140, 2, 22, 150, 2, 0, 22, 12, 18, 17, 0, 131,
+    105, 115, 111, 110, 0, 4, 21, 28, 0, 130, 114, 97, 114, 121, 0, 23, 17, 8, 21, 0, 130, 101, 110, 101, 114, 0,
+    18, 0, 86, 170, 2, 24, 179, 2, 0, 8, 22, 44, 0, 132, 115, 101, 115, 0, 19, 0, 129, 107, 117, 112, 0, 4, 17, 8,
+    9, 12, 22, 23, 0, 132, 105, 102, 101, 115, 116, 0, 4, 16, 8, 22, 0, 68, 213, 2, 19, 223, 2, 0, 19, 6, 8, 0, 131,
+    112, 97, 99, 101, 0, 6, 4, 8, 0, 130, 97, 99, 101, 0, 70, 242, 2, 24, 15, 3, 25, 41, 3, 0, 6, 0, 68, 251, 2, 24,
+    6, 3, 0, 22, 22, 12, 18, 17, 0, 131, 105, 111, 110, 0, 21, 8, 7, 0, 129, 114, 101, 100, 0, 19, 0, 87, 24, 3, 24,
+    33, 3, 0, 24, 23, 0, 131, 116, 112, 117, 116, 0, 23, 0, 130, 116, 112, 117, 116, 0, 8, 21, 12, 7, 8, 0, 130,
+    114, 105, 100, 101, 0, 82, 63, 3, 21, 76, 3, 22, 89, 3, 0, 22, 23, 12, 18, 17, 0, 131, 105, 116, 105, 111, 110,
+    0, 12, 25, 12, 15, 8, 7, 10, 8, 0, 130, 103, 101, 0, 24, 8, 7, 18, 0, 131, 101, 117, 100, 111, 0, 8, 0, 70, 121,
+    3, 9, 132, 3, 15, 136, 3, 19, 147, 3, 23, 164, 3, 24, 185, 3, 0, 12, 8, 25, 8, 0, 131, 101, 105, 118, 101, 0, 8,
+    192, 6, 3, 8, 25, 8, 17, 23, 0, 130, 97, 110, 116, 0, 12, 23, 12, 23, 12, 18, 17, 0, 134, 101, 116, 105, 116,
+    105, 111, 110, 0, 85, 171, 3, 24, 179, 3, 0, 24, 17, 0, 130, 117, 114, 110, 0, 17, 0, 128, 114, 110, 0, 86, 192,
+    3, 23, 201, 3, 0, 15, 23, 0, 131, 115, 117, 108, 116, 0, 21, 17, 0, 131, 116, 117, 114, 110, 0, 68, 226, 3, 8,
+    236, 3, 12, 250, 3, 23, 5, 4, 26, 30, 4, 0, 9, 23, 8, 28, 0, 130, 101, 116, 121, 0, 19, 8, 21, 4, 23, 8, 0, 132,
+    97, 114, 97, 116, 101, 0, 17, 10, 8, 7, 0, 131, 103, 110, 101, 100, 0, 76, 12, 4, 21, 22, 4, 0, 21, 17, 10, 0,
+    131, 114, 105, 110, 103, 0, 12, 10, 17, 0, 129, 110, 103, 0, 76, 37, 4, 23, 45, 4, 0, 23, 11, 6, 0, 129, 99,
+    104, 0, 12, 6, 11, 0, 131, 105, 116, 99, 104, 0, 11, 21, 8, 22, 18, 15, 7, 0, 130, 104, 111, 108, 100, 0, 7, 19,
+    4, 23, 8, 0, 132, 112, 100, 97, 116, 101, 0, 12, 7, 192, 112, 2
+};
@@ -19,9 +19,30 @@
 #    include "autocorrect_data_default.h"
 #endif
 
+#ifndef AUTOCORRECT_LINK_SHIFT
+#    define AUTOCORRECT_LINK_SHIFT 0
+#endif
+
+#if DICTIONARY_SIZE > UINT16_MAX
+typedef uint32_t autocorrect_state_t;
+#else
+typedef uint16_t autocorrect_state_t;
+#endif
+
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+#ifdef AUTOCORRECT_FORWARD_TRIE
+// Ends a chain whose child is linked to, rather than following the chain
+#    define AUTOCORRECT_CHAIN_LINK 0xC0
+
+// Trie positions of the typos the buffer could still be completing, oldest first
+static autocorrect_state_t autocorrect_cursors[AUTOCORRECT_MAX_LENGTH];
+static uint8_t             autocorrect_cursor_count = 0;
+// Size of the buffer the cursors were advanced over, a mismatch means the buffer was edited
+static uint8_t autocorrect_cursor_buffer_size = 0;
+#endif
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -189,6 +210,170 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+#ifdef AUTOCORRECT_FORWARD_TRIE
+static inline autocorrect_state_t autocorrect_read_link(autocorrect_state_t state) {
+    autocorrect_state_t link = pgm_read_byte(autocorrect_data + state) | pgm_read_byte(autocorrect_data + state + 1) << 8;
+    return link << AUTOCORRECT_LINK_SHIFT;
+}
+
+/**
+ * @brief Moves a trie position along the branch or chain matching `key`
+ *
+ * @param state trie position, updated when a typo continues with `key`
+ * @param key keycode to match
+ * @return true if a typo continues with `key`
+ * @return false if no typo does
+ */
+static bool autocorrect_step(autocorrect_state_t *state, uint8_t key) {
+    autocorrect_state_t pos  = *state;
+    uint8_t             code = pgm_read_byte(autocorrect_data + pos);
+
+    if (code & 64) { // Check for match in node with multiple children.
+        code &= 63;
+        for (; code != key; code = pgm_read_byte(autocorrect_data + (pos += 3))) {
+            if (!code) return false;
+        }
+        // Follow link to child node.
+        pos = autocorrect_read_link(pos + 1);
+    } else if (code != key) { // Check for match in chain, leaves never match.
+        return false;
+    } else if ((code = pgm_read_byte(autocorrect_data + (++pos))) == AUTOCORRECT_CHAIN_LINK) {
+        // Follow link at the end of the chain.
+        pos = autocorrect_read_link(pos + 1);
+    } else {
+        // Skip the chain terminator, and any padding aligning the child.
+        while (!code && pos < DICTIONARY_SIZE) {
+            code = pgm_read_byte(autocorrect_data + (++pos));
+        }
+    }
+
+    // Stop if `pos` becomes an invalid index. This should not normally
+    // happen, it is a safeguard in case of a bug, data corruption, etc.
+    if (pos >= DICTIONARY_SIZE) {
+        return false;
+    }
+
+    *state = pos;
+    return true;
+}
+
+/**
+ * @brief Advances the cursors with `key`, and starts a new cursor at the root
+ *
+ * Typos may not be substrings of one another, so at most one of the cursors completes a typo.
+ *
+ * @param key keycode appended to the buffer
+ * @return trie position of the leaf of the completed typo, or 0 if none was
+ */
+static autocorrect_state_t autocorrect_advance_cursors(uint8_t key) {
+    autocorrect_state_t leaf  = 0;
+    uint8_t             count = 0;
+
+    for (uint8_t i = 0; i <= autocorrect_cursor_count; ++i) {
+        autocorrect_state_t state = i < autocorrect_cursor_count ? autocorrect_cursors[i] : 0;
+        if (!autocorrect_step(&state, key)) {
+            continue;
+        }
+        if (pgm_read_byte(autocorrect_data + state) & 128) {
+            leaf = state;
+        } else if (count < AUTOCORRECT_MAX_LENGTH) {
+            autocorrect_cursors[count++] = state;
+        }
+    }
+    autocorrect_cursor_count = count;
+    return leaf;
+}
+
+/**
+ * @brief Replays the buffer into the cursors if it was edited since they were advanced
+ */
+static void autocorrect_sync_cursors(void) {
+    if (autocorrect_cursor_buffer_size == typo_buffer_size) {
+        return;
+    }
+    autocorrect_cursor_count = 0;
+    for (uint8_t i = 0; i < typo_buffer_size; ++i) {
+        autocorrect_advance_cursors(typo_buffer[i]);
+    }
+    autocorrect_cursor_buffer_size = typo_buffer_size;
+}
+#endif
+
+/**
+ * @brief Applies the typo whose leaf is at `state`, which the buffer ends in
+ *
+ * @param state trie position of the leaf
+ * @param keycode keycode which completed the typo
+ * @param record keyrecord_t structure
+ * @return true Continue processing keycodes, and send to host
+ * @return false Stop processing keycodes, and don't send to host
+ */
+static bool autocorrect_apply_typo(autocorrect_state_t state, uint16_t keycode, keyrecord_t *record) {
+    const uint8_t code       = pgm_read_byte(autocorrect_data + state);
+    const uint8_t backspaces = (code & 63) + !record->event.pressed;
+    const char *  changes    = (const char *)(autocorrect_data + state + 1);
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
+        }
+
+        ++typo_len;
+    }
+
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
+
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+    }
+
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
+        }
+        send_string_P(changes);
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
+    }
+}
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -266,6 +451,10 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             return true;
     }
 
+#ifdef AUTOCORRECT_FORWARD_TRIE
+    autocorrect_sync_cursors();
+#endif
+
     // Rotate oldest character if buffer is full.
     if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
         memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
@@ -274,6 +463,19 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
 
     // Append `keycode` to buffer.
     typo_buffer[typo_buffer_size++] = keycode;
+
+#ifdef AUTOCORRECT_FORWARD_TRIE
+    // Advance the typos the buffer could be completing using a trie stored in `autocorrect_data`. A cursor
+    // which started on the character rotated out above has gone deeper than the longest typo, so has already
+    // been dropped.
+    autocorrect_state_t state      = autocorrect_advance_cursors(keycode);
+    autocorrect_cursor_buffer_size = typo_buffer_size;
+
+    if (state) { // A typo was found! Apply autocorrect.
+        return autocorrect_apply_typo(state, keycode, record);
+    }
+    return true;
+#else
     // Return if buffer is smaller than the shortest word.
     if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
         return true;
@@ -308,69 +510,9 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         code = pgm_read_byte(autocorrect_data + state);
 
         if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
-
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
-
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
-
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+            return autocorrect_apply_typo(state, keycode, record);
         }
     }
     return true;
+#endif
 }
@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "process_dispatch.h"
+
+bool process_record_dispatch(const process_record_handler_t *handlers, uint8_t count, uint16_t keycode, keyrecord_t *record) {
+    const uint8_t event = record->event.pressed ? PROCESS_ON_PRESS : PROCESS_ON_RELEASE;
+
+    for (uint8_t i = 0; i < count; ++i) {
+        const process_record_handler_t *handler = &handlers[i];
+        if (keycode < pgm_read_word(&handler->first) || keycode > pgm_read_word(&handler->last)) {
+            continue;
+        }
+        if (!(pgm_read_byte(&handler->events) & event)) {
+            continue;
+        }
+
+        process_record_func_t process = (process_record_func_t)pgm_read_ptr(&handler->process);
+        if (!process(keycode, record)) {
+            return false;
+        }
+    }
+
+    return true;
+}
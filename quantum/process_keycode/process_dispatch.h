@@ -0,0 +1,51 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "action.h"
+#include "progmem.h"
+
+/** \brief The key events a handler wants to see */
+enum process_record_events {
+    PROCESS_ON_PRESS   = (1 << 0),
+    PROCESS_ON_RELEASE = (1 << 1),
+    PROCESS_ON_ANY     = PROCESS_ON_PRESS | PROCESS_ON_RELEASE,
+};
+
+typedef bool (*process_record_func_t)(uint16_t keycode, keyrecord_t *record);
+
+/**
+ * \brief An entry in a process_record dispatch table.
+ *
+ * The handler is only invoked for keycodes within [first, last] and for the
+ * requested events; anything else skips straight to the next entry. Handlers
+ * acting on disjoint keycode ranges can be listed multiple times, as long as
+ * the entries are adjacent.
+ */
+typedef struct process_record_handler_t {
+    process_record_func_t process;
+    uint16_t              first;
+    uint16_t              last;
+    uint8_t               events;
+} process_record_handler_t;
+
+/** \brief A handler which must observe every key event, whatever the keycode */
+#define PROCESS_RECORD_ALL(func) \
+    { .process = (func), .first = 0x0000, .last = 0xFFFF, .events = PROCESS_ON_ANY }
+
+/** \brief A handler which only acts on the keycodes in [first, last], for the specified events */
+#define PROCESS_RECORD_RANGE(func, first_keycode, last_keycode, event_mask) \
+    { .process = (func), .first = (first_keycode), .last = (last_keycode), .events = (event_mask) }
+
+/** \brief A handler which only acts on a single keycode, for the specified events */
+#define PROCESS_RECORD_KEYCODE(func, keycode, event_mask) PROCESS_RECORD_RANGE(func, keycode, keycode, event_mask)
+
+/**
+ * \brief Runs the handlers in a PROGMEM dispatch table, in order.
+ *
+ * \return false as soon as any handler returns false, otherwise true
+ */
+bool process_record_dispatch(const process_record_handler_t *handlers, uint8_t count, uint16_t keycode, keyrecord_t *record);
@@ -18,11 +18,19 @@
 /* Author: Wojciech Siewierski < wojciech dot siewierski at onet dot pl > */
 #include "process_dynamic_macro.h"
 #include <stddef.h>
+#include <string.h>
 #include "action_layer.h"
 #include "keycodes.h"
 #include "debug.h"
+#include "timer.h"
+#include "util.h"
 #include "wait.h"
 
+#ifdef DYNAMIC_MACRO_PERSIST
+#    include "eeconfig.h"
+#    include "eeprom.h"
+#endif
+
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
 #endif
@@ -82,47 +90,282 @@ __attribute__((weak)) bool dynamic_macro_valid_key_user(uint16_t keycode, keyrec
     return true;
 }
 
-/* Convenience macros used for retrieving the debug info. All of them
- * need a `direction` variable accessible at the call site.
+#if DYNAMIC_MACRO_COUNT < 1
+#    error DYNAMIC_MACRO_COUNT must be at least 1
+#endif
+
+_Static_assert(DYNAMIC_MACRO_BUFFER_SIZE <= UINT16_MAX, "DYNAMIC_MACRO_BUFFER_SIZE must be less than 65536");
+
+/* Events are stored as variable length entries:
+ *
+ *   header    byte    pressed | tap.count << 1 | tap.interrupted << 5 | extended << 6
+ *   extended  byte    type | has keycode << 3 | outside matrix << 4, only if flagged in the header
+ *   key       varint  row * MATRIX_COLS + col, or the row and col bytes if outside the matrix
+ *   delta     varint  milliseconds since the previous event
+ *   keycode   varint  only if the record carries a keycode
+ *
+ * A varint holds 7 bits per byte, least significant first, with the top
+ * bit set on every byte but the last. A key press or release on a usual
+ * matrix typed in quick succession takes three bytes, against the eight
+ * or more of a keyrecord_t.
+ */
+#define DYNAMIC_MACRO_EVENT_MAX_SIZE 10
+
+#define DYNAMIC_MACRO_EXTENDED (1 << 6)
+#define DYNAMIC_MACRO_HAS_KEYCODE (1 << 3)
+#define DYNAMIC_MACRO_OUTSIDE_MATRIX (1 << 4)
+
+/* The macros are stored back to back in a single buffer, in slot order.
+ *
+ * While a macro is being recorded, its old contents are dropped and the
+ * macros after it are moved to the end of the buffer, so that the
+ * recording may use all of the free space:
+ *
+ * &macro_buffer    macro_pointer          macro_tail
+ *  v                    v                     v
+ * +------------------------------------------------------------+
+ * | EARLIER MACROS |>>>> RECORDING >>>>       | LATER MACROS   |
+ * +------------------------------------------------------------+
+ *
+ * Once the recording ends, the later macros are moved back down to
+ * directly follow it. There are no arbitrary limits for the macros'
+ * length in relation to each other: for example one can either have
+ * several medium sized macros or one long macro and a few short ones.
+ */
+static uint8_t macro_buffer[DYNAMIC_MACRO_BUFFER_SIZE];
+
+/* The length in bytes of each macro. */
+static uint16_t macro_length[DYNAMIC_MACRO_COUNT] = {0};
+
+/* 0   - no macro is being recorded right now
+ * 1-N - the number of the macro being recorded */
+static uint8_t macro_id = 0;
+
+/* The position the next event is recorded at, and the beginning of the
+ * macros moved out of its way. */
+static uint16_t macro_pointer = 0;
+static uint16_t macro_tail    = 0;
+
+/* The end of the recording without the keys held down at its end, and
+ * the time of the last recorded event. */
+static uint16_t macro_trim_end  = 0;
+static uint16_t macro_last_time = 0;
+
+#ifdef DYNAMIC_MACRO_PERSIST
+static void dynamic_macro_flag_dirty(void);
+#endif
+
+/**
+ * The beginning of a macro in the macro buffer.
+ */
+static uint16_t dynamic_macro_offset(uint8_t slot) {
+    uint16_t offset = 0;
+    for (uint8_t i = 0; i < slot; ++i) {
+        offset += macro_length[i];
+        if (macro_id == i + 1) {
+            offset = macro_tail;
+        }
+    }
+    return offset;
+}
+
+/**
+ * The `direction` passed to the user hooks for a macro. These predate
+ * more than two macros, when the first macro was written forwards and
+ * the second backwards into a shared buffer.
+ */
+static int8_t dynamic_macro_direction(uint8_t slot) {
+    return slot == 0 ? +1 : slot == 1 ? -1 : slot + 1;
+}
+
+static uint8_t dynamic_macro_put_varint(uint8_t *data, uint16_t value) {
+    uint8_t size = 0;
+    while (value >= 0x80) {
+        data[size++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    data[size++] = value;
+    return size;
+}
+
+static bool dynamic_macro_get_varint(const uint8_t **data, const uint8_t *end, uint16_t *value) {
+    uint8_t byte;
+    uint8_t shift = 0;
+
+    *value = 0;
+    do {
+        if (*data >= end || shift > 14) {
+            return false;
+        }
+        byte = *(*data)++;
+        *value |= (uint16_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return true;
+}
+
+/**
+ * Encode a key event.
+ *
+ * @param data[out] Receives the encoded event, at most DYNAMIC_MACRO_EVENT_MAX_SIZE bytes.
+ * @param record[in] The key event.
+ * @param delta[in] The time since the previous event.
+ * @return The size of the encoded event.
  */
-#define DYNAMIC_MACRO_CURRENT_SLOT() (direction > 0 ? 1 : 2)
-#define DYNAMIC_MACRO_CURRENT_LENGTH(BEGIN, POINTER) ((int)(direction * ((POINTER) - (BEGIN))))
-#define DYNAMIC_MACRO_CURRENT_CAPACITY(BEGIN, END2) ((int)(direction * ((END2) - (BEGIN)) + 1))
+static uint8_t dynamic_macro_encode(uint8_t *data, const keyrecord_t *record, uint16_t delta) {
+    uint16_t keycode = 0;
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+    keycode = record->keycode;
+#endif
+
+    uint8_t header   = record->event.pressed;
+    uint8_t extended = record->event.type;
+#ifndef NO_ACTION_TAPPING
+    header |= record->tap.count << 1 | record->tap.interrupted << 5;
+#endif
+    if (keycode) {
+        extended |= DYNAMIC_MACRO_HAS_KEYCODE;
+    }
+    if (record->event.key.row >= MATRIX_ROWS || record->event.key.col >= MATRIX_COLS) {
+        extended |= DYNAMIC_MACRO_OUTSIDE_MATRIX;
+    }
+
+    uint8_t size = 0;
+    if (extended != KEY_EVENT) {
+        data[size++] = header | DYNAMIC_MACRO_EXTENDED;
+        data[size++] = extended;
+    } else {
+        data[size++] = header;
+    }
+    if (extended & DYNAMIC_MACRO_OUTSIDE_MATRIX) {
+        data[size++] = record->event.key.row;
+        data[size++] = record->event.key.col;
+    } else {
+        size += dynamic_macro_put_varint(data + size, record->event.key.row * MATRIX_COLS + record->event.key.col);
+    }
+    size += dynamic_macro_put_varint(data + size, delta);
+    if (keycode) {
+        size += dynamic_macro_put_varint(data + size, keycode);
+    }
+    return size;
+}
+
+/**
+ * Decode a key event.
+ *
+ * @param data[in,out] The encoded event, advanced past it.
+ * @param end[in] The end of the macro.
+ * @param record[out] The key event.
+ * @param delta[out] The time since the previous event.
+ * @return false if the event is truncated.
+ */
+static bool dynamic_macro_decode(const uint8_t **data, const uint8_t *end, keyrecord_t *record, uint16_t *delta) {
+    if (end - *data < 2) {
+        return false;
+    }
+
+    uint8_t header   = *(*data)++;
+    uint8_t extended = header & DYNAMIC_MACRO_EXTENDED ? *(*data)++ : KEY_EVENT;
+
+    *record = (keyrecord_t){
+        .event =
+            {
+                .pressed = header & 1,
+                .type    = extended & 7,
+            },
+    };
+#ifndef NO_ACTION_TAPPING
+    record->tap.count       = (header >> 1) & 15;
+    record->tap.interrupted = (header >> 5) & 1;
+#endif
+
+    if (extended & DYNAMIC_MACRO_OUTSIDE_MATRIX) {
+        if (end - *data < 2) {
+            return false;
+        }
+        record->event.key = MAKE_KEYPOS((*data)[0], (*data)[1]);
+        *data += 2;
+    } else {
+        uint16_t index;
+        if (!dynamic_macro_get_varint(data, end, &index)) {
+            return false;
+        }
+        record->event.key = MAKE_KEYPOS(index / MATRIX_COLS, index % MATRIX_COLS);
+    }
+
+    if (!dynamic_macro_get_varint(data, end, delta)) {
+        return false;
+    }
+    if (extended & DYNAMIC_MACRO_HAS_KEYCODE) {
+        uint16_t keycode;
+        if (!dynamic_macro_get_varint(data, end, &keycode)) {
+            return false;
+        }
+#if defined(COMBO_ENABLE) || defined(REPEAT_KEY_ENABLE)
+        record->keycode = keycode;
+#endif
+    }
+    return true;
+}
 
 /**
  * Start recording of the dynamic macro.
  *
- * @param[out] macro_pointer The new macro buffer iterator.
- * @param[in]  macro_buffer  The macro buffer used to initialize macro_pointer.
+ * @param slot[in] The macro to record, replacing its contents.
  */
-void dynamic_macro_record_start(keyrecord_t **macro_pointer, keyrecord_t *macro_buffer, int8_t direction) {
+static void dynamic_macro_record_start(uint8_t slot) {
     dprintln("dynamic macro recording: started");
 
-    dynamic_macro_record_start_kb(direction);
+    dynamic_macro_record_start_kb(dynamic_macro_direction(slot));
 
     clear_keyboard();
     layer_clear();
-    *macro_pointer = macro_buffer;
+
+    /* Drop the old contents, and move the later macros out of the way. */
+    uint16_t start = dynamic_macro_offset(slot);
+    uint16_t later = dynamic_macro_offset(DYNAMIC_MACRO_COUNT) - start - macro_length[slot];
+    macro_tail     = DYNAMIC_MACRO_BUFFER_SIZE - later;
+    memmove(macro_buffer + macro_tail, macro_buffer + start + macro_length[slot], later);
+
+    macro_length[slot] = 0;
+    macro_pointer      = start;
+    macro_trim_end     = start;
+    macro_id           = slot + 1;
 }
 
 /**
  * Play the dynamic macro.
  *
- * @param macro_buffer[in] The beginning of the macro buffer being played.
- * @param macro_end[in]    The element after the last macro buffer element.
- * @param direction[in]    Either +1 or -1, which way to iterate the buffer.
+ * The events are replayed with the time between them as recorded, the
+ * last of them happening now.
+ *
+ * @param slot[in] The macro to play.
  */
-void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_t direction) {
-    dprintf("dynamic macro: slot %d playback\n", DYNAMIC_MACRO_CURRENT_SLOT());
+void dynamic_macro_play(uint8_t slot) {
+    if (slot >= DYNAMIC_MACRO_COUNT) {
+        return;
+    }
+
+    dprintf("dynamic macro: slot %d playback\n", slot + 1);
 
     layer_state_t saved_layer_state = layer_state;
 
     clear_keyboard();
     layer_clear();
 
-    while (macro_buffer != macro_end) {
-        process_record(macro_buffer);
-        macro_buffer += direction;
+    const uint8_t *begin = macro_buffer + dynamic_macro_offset(slot);
+    const uint8_t *end   = begin + macro_length[slot];
+    keyrecord_t    record;
+    uint16_t       delta;
+    uint16_t       time = timer_read();
+
+    for (const uint8_t *data = begin; dynamic_macro_decode(&data, end, &record, &delta);) {
+        time -= delta;
+    }
+    for (const uint8_t *data = begin; dynamic_macro_decode(&data, end, &record, &delta);) {
+        time += delta;
+        record.event.time = time;
+        process_record(&record);
 #ifdef DYNAMIC_MACRO_DELAY
         wait_ms(DYNAMIC_MACRO_DELAY);
 #endif
@@ -132,116 +375,179 @@ void dynamic_macro_play(keyrecord_t *macro_buffer, keyrecord_t *macro_end, int8_
 
     layer_state_set(saved_layer_state);
 
-    dynamic_macro_play_kb(direction);
+    dynamic_macro_play_kb(dynamic_macro_direction(slot));
 }
 
 /**
  * Record a single key in a dynamic macro.
  *
- * @param macro_buffer[in] The start of the used macro buffer.
- * @param macro_pointer[in,out] The current buffer position.
- * @param macro2_end[in] The end of the other macro.
- * @param direction[in]  Either +1 or -1, which way to iterate the buffer.
- * @param record[in]     The current keypress.
+ * @param slot[in]   The macro being recorded.
+ * @param record[in] The current keypress.
  */
-void dynamic_macro_record_key(keyrecord_t *macro_buffer, keyrecord_t **macro_pointer, keyrecord_t *macro2_end, int8_t direction, keyrecord_t *record) {
+static void dynamic_macro_record_key(uint8_t slot, keyrecord_t *record) {
+    uint16_t start = dynamic_macro_offset(slot);
+
     /* If we've just started recording, ignore all the key releases. */
-    if (!record->event.pressed && *macro_pointer == macro_buffer) {
+    if (!record->event.pressed && macro_pointer == start) {
         dprintln("dynamic macro: ignoring a leading key-up event");
         return;
     }
 
-    /* The other end of the other macro is the last buffer element it
-     * is safe to use before overwriting the other macro.
+    uint8_t event[DYNAMIC_MACRO_EVENT_MAX_SIZE];
+    uint8_t size = dynamic_macro_encode(event, record, macro_pointer == start ? 0 : TIMER_DIFF_16(record->event.time, macro_last_time));
+
+    /* The beginning of the later macros is the end of the space that is
+     * safe to use before overwriting them.
      */
-    if (*macro_pointer - direction != macro2_end) {
-        **macro_pointer = *record;
-        *macro_pointer += direction;
+    if (macro_pointer + size <= macro_tail) {
+        memcpy(macro_buffer + macro_pointer, event, size);
+        macro_pointer += size;
+        macro_last_time = record->event.time;
+        if (!record->event.pressed) {
+            macro_trim_end = macro_pointer;
+        }
     }
-    dynamic_macro_record_key_kb(direction, record);
+    dynamic_macro_record_key_kb(dynamic_macro_direction(slot), record);
 
-    dprintf("dynamic macro: slot %d length: %d/%d\n", DYNAMIC_MACRO_CURRENT_SLOT(), DYNAMIC_MACRO_CURRENT_LENGTH(macro_buffer, *macro_pointer), DYNAMIC_MACRO_CURRENT_CAPACITY(macro_buffer, macro2_end));
+    dprintf("dynamic macro: slot %d length: %d/%d bytes\n", slot + 1, macro_pointer - start, macro_tail - start);
 }
 
 /**
  * End recording of the dynamic macro. Essentially just update the
- * pointer to the end of the macro.
+ * length of the macro, and move the later macros back behind it.
  */
-void dynamic_macro_record_end(keyrecord_t *macro_buffer, keyrecord_t *macro_pointer, int8_t direction, keyrecord_t **macro_end) {
-    dynamic_macro_record_end_kb(direction);
+static void dynamic_macro_record_end(uint8_t slot) {
+    dynamic_macro_record_end_kb(dynamic_macro_direction(slot));
 
     /* Do not save the keys being held when stopping the recording,
      * i.e. the keys used to access the layer DM_RSTP is on.
      */
-    while (macro_pointer != macro_buffer && (macro_pointer - direction)->event.pressed) {
-        dprintln("dynamic macro: trimming a trailing key-down event");
-        macro_pointer -= direction;
+    if (macro_trim_end != macro_pointer) {
+        dprintln("dynamic macro: trimming trailing key-down events");
     }
 
-    dprintf("dynamic macro: slot %d saved, length: %d\n", DYNAMIC_MACRO_CURRENT_SLOT(), DYNAMIC_MACRO_CURRENT_LENGTH(macro_buffer, macro_pointer));
+    uint16_t start = dynamic_macro_offset(slot);
+    memmove(macro_buffer + macro_trim_end, macro_buffer + macro_tail, DYNAMIC_MACRO_BUFFER_SIZE - macro_tail);
+    macro_length[slot] = macro_trim_end - start;
+
+    dprintf("dynamic macro: slot %d saved, length: %d bytes\n", slot + 1, macro_length[slot]);
 
-    *macro_end = macro_pointer;
+#ifdef DYNAMIC_MACRO_PERSIST
+    dynamic_macro_flag_dirty();
+#endif
 }
 
-/* Both macros use the same buffer but read/write on different
- * ends of it.
- *
- * Macro1 is written left-to-right starting from the beginning of
- * the buffer.
- *
- * Macro2 is written right-to-left starting from the end of the
- * buffer.
- *
- * &macro_buffer   macro_end
- *  v                   v
- * +------------------------------------------------------------+
- * |>>>>>> MACRO1 >>>>>>      <<<<<<<<<<<<< MACRO2 <<<<<<<<<<<<<|
- * +------------------------------------------------------------+
- *                           ^                                 ^
- *                         r_macro_end                  r_macro_buffer
- *
- * During the recording when one macro encounters the end of the
- * other macro, the recording is stopped. Apart from this, there
- * are no arbitrary limits for the macros' length in relation to
- * each other: for example one can either have two medium sized
- * macros or one long macro and one short macro. Or even one empty
- * and one using the whole buffer.
+/**
+ * Start recording a dynamic macro, stopping any recording in progress.
  */
-static keyrecord_t macro_buffer[DYNAMIC_MACRO_SIZE];
+void dynamic_macro_start_recording(uint8_t slot) {
+    if (slot >= DYNAMIC_MACRO_COUNT) {
+        return;
+    }
+    dynamic_macro_stop_recording();
+    dynamic_macro_record_start(slot);
+}
 
-/* Pointer to the first buffer element after the first macro.
- * Initially points to the very beginning of the buffer since the
- * macro is empty. */
-static keyrecord_t *macro_end = macro_buffer;
+/**
+ * If a dynamic macro is currently being recorded, stop recording.
+ */
+void dynamic_macro_stop_recording(void) {
+    if (macro_id != 0) {
+        dynamic_macro_record_end(macro_id - 1);
+    }
+    macro_id = 0;
+}
 
-/* The other end of the macro buffer. Serves as the beginning of
- * the second macro. */
-static keyrecord_t *const r_macro_buffer = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
+#ifdef DYNAMIC_MACRO_PERSIST
+#    ifndef DYNAMIC_MACRO_EEPROM_ADDR
+#        if defined(VIA_ENABLE) || defined(DYNAMIC_KEYMAP_ENABLE)
+#            error DYNAMIC_MACRO_EEPROM_ADDR must be set to EEPROM not used by the dynamic keymap, see DYNAMIC_KEYMAP_EEPROM_MAX_ADDR
+#        endif
+#        define DYNAMIC_MACRO_EEPROM_ADDR (EECONFIG_SIZE)
+#    endif
+
+/* Stored layout of the macros. The magic number changes with the size of
+ * the buffer and the number of macros, so that a layout change discards
+ * them rather than reading garbage.
+ */
+typedef struct PACKED {
+    uint16_t magic;
+    uint16_t length[DYNAMIC_MACRO_COUNT];
+    uint8_t  data[DYNAMIC_MACRO_BUFFER_SIZE];
+} dynamic_macro_eeprom_t;
+
+#    define DYNAMIC_MACRO_EEPROM_MAGIC ((uint16_t)(0xD3A0 + DYNAMIC_MACRO_COUNT + (DYNAMIC_MACRO_BUFFER_SIZE << 4)))
+#    define DYNAMIC_MACRO_EEPROM(member) ((uint8_t *)(DYNAMIC_MACRO_EEPROM_ADDR) + offsetof(dynamic_macro_eeprom_t, member))
+
+_Static_assert((DYNAMIC_MACRO_EEPROM_ADDR) + sizeof(dynamic_macro_eeprom_t) <= (TOTAL_EEPROM_BYTE_COUNT), "Dynamic macros are configured to use more EEPROM than is available, reduce DYNAMIC_MACRO_BUFFER_SIZE.");
+
+/* Whether the macros changed since they were stored, when they last did,
+ * and how far storing them has got. */
+static bool     macro_dirty        = false;
+static uint16_t macro_dirty_timer  = 0;
+static uint16_t macro_flush_offset = 0;
+
+static void dynamic_macro_flag_dirty(void) {
+    macro_dirty        = true;
+    macro_dirty_timer  = timer_read();
+    macro_flush_offset = 0;
+}
+#endif
 
-/* Like macro_end but for the second macro. */
-static keyrecord_t *r_macro_end = macro_buffer + DYNAMIC_MACRO_SIZE - 1;
+/**
+ * Load the stored macros.
+ */
+void dynamic_macro_init(void) {
+#ifdef DYNAMIC_MACRO_PERSIST
+    if (eeprom_read_word((const uint16_t *)DYNAMIC_MACRO_EEPROM(magic)) != DYNAMIC_MACRO_EEPROM_MAGIC) {
+        return;
+    }
 
-/* A persistent pointer to the current macro position (iterator)
- * used during the recording. */
-static keyrecord_t *macro_pointer = NULL;
+    uint16_t length[DYNAMIC_MACRO_COUNT];
+    uint32_t used = 0;
+    eeprom_read_block(length, DYNAMIC_MACRO_EEPROM(length), sizeof(length));
+    for (uint8_t i = 0; i < DYNAMIC_MACRO_COUNT; ++i) {
+        used += length[i];
+    }
+    if (used > DYNAMIC_MACRO_BUFFER_SIZE) {
+        return;
+    }
 
-/* 0   - no macro is being recorded right now
- * 1,2 - either macro 1 or 2 is being recorded */
-static uint8_t macro_id = 0;
+    memcpy(macro_length, length, sizeof(macro_length));
+    eeprom_read_block(macro_buffer, DYNAMIC_MACRO_EEPROM(data), used);
+    macro_dirty = false;
+#endif
+}
 
 /**
- * If a dynamic macro is currently being recorded, stop recording.
+ * Store the macros once they have not changed for DYNAMIC_MACRO_FLUSH_DELAY,
+ * writing at most DYNAMIC_MACRO_FLUSH_CHUNK_SIZE bytes per call so that the
+ * scan loop is never held up for long.
  */
-void dynamic_macro_stop_recording(void) {
-    switch (macro_id) {
-        case 1:
-            dynamic_macro_record_end(macro_buffer, macro_pointer, +1, &macro_end);
-            break;
-        case 2:
-            dynamic_macro_record_end(r_macro_buffer, macro_pointer, -1, &r_macro_end);
-            break;
+void dynamic_macro_task(void) {
+#ifdef DYNAMIC_MACRO_PERSIST
+    if (!macro_dirty || macro_id != 0 || timer_elapsed(macro_dirty_timer) < DYNAMIC_MACRO_FLUSH_DELAY) {
+        return;
     }
-    macro_id = 0;
+
+    if (macro_flush_offset == 0) {
+        /* Invalidate the stored macros until all of them have been written. */
+        eeprom_update_word((uint16_t *)DYNAMIC_MACRO_EEPROM(magic), (uint16_t)~DYNAMIC_MACRO_EEPROM_MAGIC);
+    }
+
+    uint16_t used = dynamic_macro_offset(DYNAMIC_MACRO_COUNT);
+    if (macro_flush_offset < used) {
+        uint16_t size = MIN(used - macro_flush_offset, DYNAMIC_MACRO_FLUSH_CHUNK_SIZE);
+        eeprom_update_block(macro_buffer + macro_flush_offset, DYNAMIC_MACRO_EEPROM(data) + macro_flush_offset, size);
+        macro_flush_offset += size;
+        return;
+    }
+
+    eeprom_update_block(macro_length, DYNAMIC_MACRO_EEPROM(length), sizeof(macro_length));
+    eeprom_update_word((uint16_t *)DYNAMIC_MACRO_EEPROM(magic), DYNAMIC_MACRO_EEPROM_MAGIC);
+    macro_dirty = false;
+    dprintln("dynamic macro: stored");
+#endif
 }
 
 /* Handle the key events related to the dynamic macros.
@@ -252,18 +558,16 @@ bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record) {
         if (!record->event.pressed) {
             switch (keycode) {
                 case QK_DYNAMIC_MACRO_RECORD_START_1:
-                    dynamic_macro_record_start(&macro_pointer, macro_buffer, +1);
-                    macro_id = 1;
+                    dynamic_macro_start_recording(0);
                     return false;
                 case QK_DYNAMIC_MACRO_RECORD_START_2:
-                    dynamic_macro_record_start(&macro_pointer, r_macro_buffer, -1);
-                    macro_id = 2;
+                    dynamic_macro_start_recording(1);
                     return false;
                 case QK_DYNAMIC_MACRO_PLAY_1:
-                    dynamic_macro_play(macro_buffer, macro_end, +1);
+                    dynamic_macro_play(0);
                     return false;
                 case QK_DYNAMIC_MACRO_PLAY_2:
-                    dynamic_macro_play(r_macro_buffer, r_macro_end, -1);
+                    dynamic_macro_play(1);
                     return false;
             }
         }
@@ -289,14 +593,7 @@ bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record) {
             default:
                 if (dynamic_macro_valid_key_kb(keycode, record)) {
                     /* Store the key in the macro buffer and process it normally. */
-                    switch (macro_id) {
-                        case 1:
-                            dynamic_macro_record_key(macro_buffer, &macro_pointer, r_macro_end, +1, record);
-                            break;
-                        case 2:
-                            dynamic_macro_record_key(r_macro_buffer, &macro_pointer, macro_end, -1, record);
-                            break;
-                    }
+                    dynamic_macro_record_key(macro_id - 1, record);
                 }
                 return true;
                 break;
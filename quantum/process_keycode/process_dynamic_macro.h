@@ -22,10 +22,11 @@
 #include <stdbool.h>
 #include "action.h"
 
-/* May be overridden with a custom value. Be aware that the effective
- * macro length is half of this value: each keypress is recorded twice
- * because of the down-event and up-event. This is not a bug, it's the
- * intended behavior.
+/* May be overridden with a custom value. The macros are given as much
+ * RAM as this many key records would take, but store events in a
+ * compact form, so that they fit several times as many key events.
+ * Each keypress is recorded twice because of the down-event and
+ * up-event.
  *
  * Usually it should be fine to set the macro size to at least 256 but
  * there have been reports of it being too much in some users' cases,
@@ -35,6 +36,30 @@
 #    define DYNAMIC_MACRO_SIZE 128
 #endif
 
+/* The size in bytes of the buffer shared by the macros. */
+#ifndef DYNAMIC_MACRO_BUFFER_SIZE
+#    define DYNAMIC_MACRO_BUFFER_SIZE (DYNAMIC_MACRO_SIZE * sizeof(keyrecord_t))
+#endif
+
+/* The number of macros. The first two are recorded and played with the
+ * DM_REC1/DM_REC2 and DM_PLY1/DM_PLY2 keycodes, any further ones through
+ * dynamic_macro_start_recording() and dynamic_macro_play().
+ */
+#ifndef DYNAMIC_MACRO_COUNT
+#    define DYNAMIC_MACRO_COUNT 2
+#endif
+
+/* With DYNAMIC_MACRO_PERSIST, the macros are stored in EEPROM once they
+ * have been left unchanged for this long, a chunk of this many bytes per
+ * scan.
+ */
+#ifndef DYNAMIC_MACRO_FLUSH_DELAY
+#    define DYNAMIC_MACRO_FLUSH_DELAY 1000
+#endif
+#ifndef DYNAMIC_MACRO_FLUSH_CHUNK_SIZE
+#    define DYNAMIC_MACRO_FLUSH_CHUNK_SIZE 16
+#endif
+
 void dynamic_macro_led_blink(void);
 bool process_dynamic_macro(uint16_t keycode, keyrecord_t *record);
 bool dynamic_macro_record_start_kb(int8_t direction);
@@ -47,4 +72,8 @@ bool dynamic_macro_record_end_kb(int8_t direction);
 bool dynamic_macro_record_end_user(int8_t direction);
 bool dynamic_macro_valid_key_kb(uint16_t keycode, keyrecord_t *record);
 bool dynamic_macro_valid_key_user(uint16_t keycode, keyrecord_t *record);
+void dynamic_macro_start_recording(uint8_t slot);
 void dynamic_macro_stop_recording(void);
+void dynamic_macro_play(uint8_t slot);
+void dynamic_macro_init(void);
+void dynamic_macro_task(void);
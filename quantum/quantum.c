@@ -15,6 +15,7 @@
  */
 
 #include "quantum.h"
+#include "process_dispatch.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "process_backlight.h"
@@ -245,8 +246,16 @@ uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache) {
         uint8_t layer;
 
         if (event.pressed && update_layer_cache) {
-            layer = layer_switch_get_layer(event.key);
-            update_source_layers_cache(event.key, layer);
+            layer       = layer_switch_get_layer(event.key);
+            bool update = true;
+#    ifndef NO_ACTION_TAPPING
+            // A release of the key still waiting behind a tapping key needs the source layer of the previous press,
+            // the cache is updated again once this press is processed
+            update = !waiting_buffer_has_release(event.key);
+#    endif
+            if (update) {
+                update_source_layers_cache(event.key, layer);
+            }
         } else {
             layer = read_source_layers_cache(event.key);
         }
@@ -271,153 +280,172 @@ void post_process_record_quantum(keyrecord_t *record) {
     post_process_record_kb(keycode, record);
 }
 
-/* Core keycode function, hands off handling to other functions,
-    then processes internal quantum keycodes, and then processes
-    ACTIONs.                                                      */
-bool process_record_quantum(keyrecord_t *record) {
-    uint16_t keycode = get_record_keycode(record, true);
-
-    // This is how you use actions here
-    // if (keycode == QK_LEADER) {
-    //   action_t action;
-    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
-    //   process_action(record, action);
-    //   return false;
-    // }
-
-#if defined(SECURE_ENABLE)
-    if (!preprocess_secure(keycode, record)) {
-        return false;
-    }
-#endif
-
-#ifdef TAP_DANCE_ENABLE
-    if (preprocess_tap_dance(keycode, record)) {
-        // The tap dance might have updated the layer state, therefore the
-        // result of the keycode lookup might change.
-        keycode = get_record_keycode(record, true);
-    }
-#endif
-
-#ifdef RGBLIGHT_ENABLE
-    if (record->event.pressed) {
-        preprocess_rgblight();
-    }
-#endif
-
-#ifdef WPM_ENABLE
-    if (record->event.pressed) {
-        update_wpm(keycode);
-    }
-#endif
-
-    if (!(
-#if defined(KEY_LOCK_ENABLE)
-            // Must run first to be able to mask key_up events.
-            process_key_lock(&keycode, record) &&
-#endif
+/* Handlers run by process_record_quantum, in order. Each declares the
+   keycodes and events it acts on, so that a key event only visits the
+   handlers which are interested in it -- plain keycodes skip everything
+   except the handlers observing every key.                          */
+// clang-format off
+static const process_record_handler_t process_record_handlers[] PROGMEM = {
 #if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
-            // Must run asap to ensure all keypresses are recorded.
-            process_dynamic_macro(keycode, record) &&
+    // Must run asap to ensure all keypresses are recorded.
+    PROCESS_RECORD_ALL(process_dynamic_macro),
 #endif
 #ifdef REPEAT_KEY_ENABLE
-            process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
+    PROCESS_RECORD_ALL(process_last_key),
+    PROCESS_RECORD_ALL(process_repeat_key),
 #endif
 #if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
+    PROCESS_RECORD_ALL(process_clicky),
 #endif
 #ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
+    PROCESS_RECORD_ALL(process_haptic),
 #endif
 #if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_record_via, QK_MACRO, QK_MACRO_MAX, PROCESS_ON_PRESS),
 #endif
 #if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
+    PROCESS_RECORD_ALL(process_auto_mouse),
 #endif
-            process_record_kb(keycode, record) &&
+    PROCESS_RECORD_ALL(process_record_kb),
 #if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_secure, QK_SECURE_LOCK, QK_SECURE_REQUEST, PROCESS_ON_RELEASE),
 #endif
 #if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_sequencer, QK_SEQUENCER, QK_SEQUENCER_MAX, PROCESS_ON_PRESS),
 #endif
 #if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_midi, QK_MIDI, QK_MIDI_MAX, PROCESS_ON_ANY),
 #endif
 #ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_audio, QK_AUDIO, QK_AUDIO_MAX, PROCESS_ON_PRESS),
 #endif
 #if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_backlight, QK_LIGHTING, QK_LIGHTING_MAX, PROCESS_ON_PRESS),
 #endif
 #if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_led_matrix, QK_LIGHTING, QK_LIGHTING_MAX, PROCESS_ON_PRESS),
 #endif
 #ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_steno, QK_STENO, QK_STENO_MAX, PROCESS_ON_ANY),
 #endif
 #if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
+    // Consumes every key while music mode is active.
+    PROCESS_RECORD_ALL(process_music),
 #endif
 #ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
+    PROCESS_RECORD_ALL(process_caps_word),
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+    PROCESS_RECORD_ALL(process_key_override),
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_tap_dance, QK_TAP_DANCE, QK_TAP_DANCE_MAX, PROCESS_ON_ANY),
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
+#    if defined(UCIS_ENABLE)
+    // Consumes every key while an input sequence is active.
+    PROCESS_RECORD_ALL(process_unicode_common),
+#    else
+    PROCESS_RECORD_RANGE(process_unicode_common, QK_UNICODE_MODE_NEXT, QK_UNICODE_MODE_EMACS, PROCESS_ON_PRESS),
+    PROCESS_RECORD_RANGE(process_unicode_common, QK_UNICODE, QK_UNICODE_MAX, PROCESS_ON_PRESS),
+#    endif
 #endif
 #ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
+    PROCESS_RECORD_ALL(process_leader),
 #endif
 #ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
+    PROCESS_RECORD_ALL(process_auto_shift),
 #endif
 #ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_dynamic_tapping_term, QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN, PROCESS_ON_PRESS),
 #endif
 #ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
+    PROCESS_RECORD_ALL(process_space_cadet),
 #endif
 #ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_magic, QK_MAGIC, QK_MAGIC_MAX, PROCESS_ON_PRESS),
 #endif
 #ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
+    PROCESS_RECORD_KEYCODE(process_grave_esc, QK_GRAVE_ESCAPE, PROCESS_ON_ANY),
 #endif
 #if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_underglow, QK_LIGHTING, QK_LIGHTING_MAX, PROCESS_ON_PRESS),
 #endif
 #if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_rgb_matrix, QK_LIGHTING, QK_LIGHTING_MAX, PROCESS_ON_ANY),
 #endif
 #ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_joystick, QK_JOYSTICK, QK_JOYSTICK_MAX, PROCESS_ON_ANY),
 #endif
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_programmable_button, QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX, PROCESS_ON_ANY),
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+    PROCESS_RECORD_ALL(process_autocorrect),
 #endif
 #ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_tri_layer, QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER, PROCESS_ON_ANY),
 #endif
 #if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_default_layer, QK_PERSISTENT_DEF_LAYER, QK_PERSISTENT_DEF_LAYER_MAX, PROCESS_ON_RELEASE),
 #endif
 #ifdef LAYER_LOCK_ENABLE
-            process_layer_lock(keycode, record) &&
+    PROCESS_RECORD_ALL(process_layer_lock),
 #endif
 #ifdef BLUETOOTH_ENABLE
-            process_connection(keycode, record) &&
+    PROCESS_RECORD_RANGE(process_connection, QK_CONNECTION, QK_CONNECTION_MAX, PROCESS_ON_PRESS),
 #endif
-            true)) {
+};
+// clang-format on
+
+/* Core keycode function, hands off handling to other functions,
+    then processes internal quantum keycodes, and then processes
+    ACTIONs.                                                      */
+bool process_record_quantum(keyrecord_t *record) {
+    uint16_t keycode = get_record_keycode(record, true);
+
+    // This is how you use actions here
+    // if (keycode == QK_LEADER) {
+    //   action_t action;
+    //   action.code = ACTION_DEFAULT_LAYER_SET(0);
+    //   process_action(record, action);
+    //   return false;
+    // }
+
+#if defined(SECURE_ENABLE)
+    if (!preprocess_secure(keycode, record)) {
+        return false;
+    }
+#endif
+
+#ifdef TAP_DANCE_ENABLE
+    if (preprocess_tap_dance(keycode, record)) {
+        // The tap dance might have updated the layer state, therefore the
+        // result of the keycode lookup might change.
+        keycode = get_record_keycode(record, true);
+    }
+#endif
+
+#ifdef RGBLIGHT_ENABLE
+    if (record->event.pressed) {
+        preprocess_rgblight();
+    }
+#endif
+
+#ifdef WPM_ENABLE
+    if (record->event.pressed) {
+        update_wpm(keycode);
+    }
+#endif
+
+#if defined(KEY_LOCK_ENABLE)
+    // Must run first to be able to mask key_up events.
+    if (!process_key_lock(&keycode, record)) {
+        return false;
+    }
+#endif
+
+    if (!process_record_dispatch(process_record_handlers, ARRAY_SIZE(process_record_handlers), keycode, record)) {
         return false;
     }
 
@@ -20,6 +20,10 @@
 #include "matrix.h"
 #include "keyboard.h"
 
+#ifdef ANALOG_MATRIX_ENABLE
+#    include "analog_matrix.h"
+#endif
+
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
 #endif
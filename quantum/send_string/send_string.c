@@ -238,6 +238,267 @@ void send_char_with_delay(char ascii_code, uint8_t interval) {
     }
 }
 
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+
+// Queued string awaiting, or in the middle of, being typed
+typedef struct send_string_job_t {
+    const char *           cursor;
+    send_string_reader_t   reader;
+    send_string_callback_t callback;
+    void *                 cb_arg;
+    uint16_t               remaining;
+    uint8_t                interval;
+    send_string_token_t    token;
+} send_string_job_t;
+
+// Single key event produced by parsing the current job
+typedef struct send_string_op_t {
+    uint8_t keycode;
+    bool    pressed;
+} send_string_op_t;
+
+// Enough for shift, altgr, the key itself and a dead key space, pressed and released
+#    define SEND_STRING_MAX_OPS 8
+
+#    define SEND_STRING_LENGTH_UNBOUNDED UINT16_MAX
+
+static send_string_job_t   jobs[SEND_STRING_ASYNC_QUEUE_SIZE];
+static uint8_t             job_count = 0;
+static send_string_op_t    ops[SEND_STRING_MAX_OPS];
+static uint8_t             op_count       = 0;
+static uint8_t             op_pos         = 0;
+static send_string_token_t last_token     = INVALID_SEND_STRING_TOKEN;
+static deferred_token      executor_token = INVALID_DEFERRED_TOKEN;
+
+DEFERRED_EXECUTOR_TABLE(executor, 1);
+
+static char send_string_read_ram(const char *ptr) {
+    return *ptr;
+}
+
+#    if defined(__AVR__)
+static char send_string_read_progmem(const char *ptr) {
+    return pgm_read_byte(ptr);
+}
+#    else
+#        define send_string_read_progmem send_string_read_ram
+#    endif
+
+static char job_next_char(send_string_job_t *job) {
+    if (job->remaining == 0) {
+        return 0;
+    }
+    if (job->remaining != SEND_STRING_LENGTH_UNBOUNDED) {
+        --job->remaining;
+    }
+    return job->reader(job->cursor++);
+}
+
+static inline void push_op(uint8_t keycode, bool pressed) {
+    ops[op_count++] = (send_string_op_t){.keycode = keycode, .pressed = pressed};
+}
+
+static void push_char_ops(char ascii_code) {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        PLAY_SONG(bell_song);
+        return;
+    }
+#    endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    if (is_shifted) push_op(KC_LEFT_SHIFT, true);
+    if (is_altgred) push_op(KC_RIGHT_ALT, true);
+    push_op(keycode, true);
+    push_op(keycode, false);
+    if (is_altgred) push_op(KC_RIGHT_ALT, false);
+    if (is_shifted) push_op(KC_LEFT_SHIFT, false);
+    if (is_dead) {
+        push_op(KC_SPACE, true);
+        push_op(KC_SPACE, false);
+    }
+}
+
+// Parses the next character or sequence of the job into the op list.
+// Returns false at the end of the string, otherwise sets `delay_ms` for any requested SS_DELAY().
+static bool parse_next(send_string_job_t *job, uint32_t *delay_ms) {
+    op_count  = 0;
+    op_pos    = 0;
+    *delay_ms = 0;
+
+    char ascii_code = job_next_char(job);
+    if (!ascii_code) {
+        return false;
+    }
+    if (ascii_code != SS_QMK_PREFIX) {
+        push_char_ops(ascii_code);
+        return true;
+    }
+
+    uint8_t keycode;
+    switch (job_next_char(job)) {
+        case SS_TAP_CODE:
+            if (!(keycode = job_next_char(job))) return false;
+            push_op(keycode, true);
+            push_op(keycode, false);
+            return true;
+        case SS_DOWN_CODE:
+            if (!(keycode = job_next_char(job))) return false;
+            push_op(keycode, true);
+            return true;
+        case SS_UP_CODE:
+            if (!(keycode = job_next_char(job))) return false;
+            push_op(keycode, false);
+            return true;
+        case SS_DELAY_CODE:
+            // Digits are terminated by '|', which gets consumed along with them
+            while (isdigit(keycode = job_next_char(job))) {
+                *delay_ms = (*delay_ms * 10) + (keycode - '0');
+            }
+            return keycode != 0;
+        case 0:
+            return false;
+        default:
+            return true;
+    }
+}
+
+static void finish_job(uint8_t index, bool completed) {
+    send_string_job_t job = jobs[index];
+    for (uint8_t i = index + 1; i < job_count; ++i) {
+        jobs[i - 1] = jobs[i];
+    }
+    --job_count;
+    if (index == 0) {
+        op_count = 0;
+        op_pos   = 0;
+    }
+    if (job.callback) {
+        job.callback(job.token, completed, job.cb_arg);
+    }
+}
+
+static uint32_t send_string_async_tick(uint32_t trigger_time, void *cb_arg) {
+    while (job_count > 0) {
+        send_string_job_t *job = &jobs[0];
+
+        // Send the next key event of the current character, or all of them if there's no interval to honour
+        if (op_pos < op_count) {
+            do {
+                send_string_op_t *op = &ops[op_pos++];
+                if (op->pressed) {
+                    register_code(op->keycode);
+                } else {
+                    unregister_code(op->keycode);
+                }
+            } while (job->interval == 0 && op_pos < op_count);
+            return job->interval ? job->interval : 1;
+        }
+
+        uint32_t delay_ms;
+        if (!parse_next(job, &delay_ms)) {
+            finish_job(0, true);
+        } else if (delay_ms > 0) {
+            return delay_ms;
+        }
+    }
+
+    executor_token = INVALID_DEFERRED_TOKEN;
+    return 0;
+}
+
+static send_string_token_t send_string_async_enqueue(const char *string, uint16_t length, send_string_reader_t reader, uint8_t interval, send_string_callback_t callback, void *cb_arg) {
+    if (!string || job_count >= SEND_STRING_ASYNC_QUEUE_SIZE) {
+        return INVALID_SEND_STRING_TOKEN;
+    }
+
+    // Start ticking if the queue was idle
+    if (executor_token == INVALID_DEFERRED_TOKEN) {
+        executor_token = defer_exec_advanced(&executor, 1, send_string_async_tick, NULL);
+        if (executor_token == INVALID_DEFERRED_TOKEN) {
+            return INVALID_SEND_STRING_TOKEN;
+        }
+    }
+
+    // Tokens of queued strings are unique, so skip over any still in use
+    bool in_use;
+    do {
+        in_use = false;
+        if (++last_token == INVALID_SEND_STRING_TOKEN) {
+            ++last_token;
+        }
+        for (uint8_t i = 0; i < job_count; ++i) {
+            in_use |= jobs[i].token == last_token;
+        }
+    } while (in_use);
+
+    jobs[job_count++] = (send_string_job_t){
+        .cursor    = string,
+        .reader    = reader,
+        .callback  = callback,
+        .cb_arg    = cb_arg,
+        .remaining = length,
+        .interval  = interval,
+        .token     = last_token,
+    };
+    return last_token;
+}
+
+send_string_token_t send_string_async(const char *string, uint8_t interval, send_string_callback_t callback, void *cb_arg) {
+    return send_string_async_enqueue(string, SEND_STRING_LENGTH_UNBOUNDED, send_string_read_ram, interval, callback, cb_arg);
+}
+
+#    if defined(__AVR__)
+send_string_token_t send_string_async_P(const char *string, uint8_t interval, send_string_callback_t callback, void *cb_arg) {
+    return send_string_async_enqueue(string, SEND_STRING_LENGTH_UNBOUNDED, send_string_read_progmem, interval, callback, cb_arg);
+}
+#    endif
+
+send_string_token_t send_string_async_with_reader(const char *string, send_string_reader_t reader, uint8_t interval, send_string_callback_t callback, void *cb_arg) {
+    if (!reader) {
+        return INVALID_SEND_STRING_TOKEN;
+    }
+    return send_string_async_enqueue(string, SEND_STRING_LENGTH_UNBOUNDED, reader, interval, callback, cb_arg);
+}
+
+bool send_string_async_cancel(send_string_token_t token) {
+    for (uint8_t i = 0; i < job_count; ++i) {
+        if (jobs[i].token == token) {
+            // Don't leave modifiers or the current key stuck down
+            if (i == 0) {
+                for (; op_pos < op_count; ++op_pos) {
+                    if (!ops[op_pos].pressed) {
+                        unregister_code(ops[op_pos].keycode);
+                    }
+                }
+            }
+            finish_job(i, false);
+            return true;
+        }
+    }
+    return false;
+}
+
+void send_string_async_cancel_all(void) {
+    while (job_count > 0) {
+        send_string_async_cancel(jobs[0].token);
+    }
+}
+
+bool send_string_async_is_busy(void) {
+    return job_count > 0;
+}
+
+void send_string_async_task(void) {
+    deferred_exec_advanced_task(&executor);
+}
+#endif // DEFERRED_EXEC_ENABLE
+
 void send_dword(uint32_t number) {
     send_word(number >> 16);
     send_word(number & 0xFFFFUL);
@@ -264,32 +525,21 @@ void send_nibble(uint8_t number) {
     }
 }
 
+static const char base64_alphabet[64] PROGMEM = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
 void tap_random_base64(void) {
 #if defined(__AVR_ATmega32U4__)
     uint8_t key = (TCNT0 + TCNT1 + TCNT3 + TCNT4) % 64;
 #else
     uint8_t key = rand() % 64;
 #endif
-    switch (key) {
-        case 0 ... 25:
-            send_char(key + 'A');
-            break;
-        case 26 ... 51:
-            send_char(key - 26 + 'a');
-            break;
-        case 52:
-            send_char('0');
-            break;
-        case 53 ... 61:
-            send_char(key - 53 + '1');
-            break;
-        case 62:
-            send_char('+');
-            break;
-        case 63:
-            send_char('/');
-            break;
+#ifdef DEFERRED_EXEC_ENABLE
+    // Keep ordering with anything still being typed in the background
+    if (send_string_async_is_busy() && send_string_async_enqueue(&base64_alphabet[key], 1, send_string_read_progmem, TAP_CODE_DELAY, NULL, NULL) != INVALID_SEND_STRING_TOKEN) {
+        return;
     }
+#endif
+    send_char(pgm_read_byte(&base64_alphabet[key]));
 }
 
 #if defined(__AVR__)
@@ -23,6 +23,7 @@
  * \{
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "progmem.h"
@@ -161,4 +162,107 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 #define SEND_STRING_DELAY(string, interval) send_string_with_delay_P(PSTR(string), interval)
 
+#if defined(DEFERRED_EXEC_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief The maximum number of strings which may be queued for asynchronous sending, including the one being typed.
+ */
+#    ifndef SEND_STRING_ASYNC_QUEUE_SIZE
+#        define SEND_STRING_ASYNC_QUEUE_SIZE 4
+#    endif
+
+/**
+ * \brief A token identifying a queued asynchronous string, usable for cancellation.
+ */
+typedef uint8_t send_string_token_t;
+
+/**
+ * \brief The token returned when a string could not be queued.
+ */
+#    define INVALID_SEND_STRING_TOKEN 0
+
+/**
+ * \brief Reads a single character of a string queued for asynchronous sending.
+ *
+ * \param ptr The location of the character to read.
+ * \return The character at that location.
+ */
+typedef char (*send_string_reader_t)(const char *ptr);
+
+/**
+ * \brief Invoked once a queued string has finished being typed, or was cancelled.
+ *
+ * \param token The token returned when the string was queued.
+ * \param completed `true` if the whole string was typed, `false` if it was cancelled.
+ * \param cb_arg The argument supplied when the string was queued.
+ */
+typedef void (*send_string_callback_t)(send_string_token_t token, bool completed, void *cb_arg);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background.
+ *
+ * The string is parsed incrementally and typed one character per task tick, so the matrix, split link and lighting keep being serviced. Delays inserted through `SS_DELAY()` no longer block either.
+ *
+ * The string is not copied, so it must remain valid until the callback has been invoked.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait between each key event.
+ * \param callback The function to invoke once the string has been typed or cancelled, may be `NULL`.
+ * \param cb_arg The argument to pass to the callback, may be `NULL` if unused.
+ * \return A token usable for cancellation, or `INVALID_SEND_STRING_TOKEN` if the queue is full.
+ */
+send_string_token_t send_string_async(const char *string, uint8_t interval, send_string_callback_t callback, void *cb_arg);
+
+/**
+ * \brief Queue a string, read through a custom accessor, to be typed out in the background.
+ *
+ * Allows strings living in EEPROM or other non-memory-mapped storage to be typed without first being copied to RAM.
+ *
+ * \param string The location of the string to type out, as understood by `reader`.
+ * \param reader The function used to read each character of the string.
+ * \param interval The amount of time, in milliseconds, to wait between each key event.
+ * \param callback The function to invoke once the string has been typed or cancelled, may be `NULL`.
+ * \param cb_arg The argument to pass to the callback, may be `NULL` if unused.
+ * \return A token usable for cancellation, or `INVALID_SEND_STRING_TOKEN` if the queue is full.
+ */
+send_string_token_t send_string_async_with_reader(const char *string, send_string_reader_t reader, uint8_t interval, send_string_callback_t callback, void *cb_arg);
+
+/**
+ * \brief Cancel a queued string.
+ *
+ * If the string is currently being typed, any keys held down for the current character are released first. The callback is invoked with `completed` set to `false`.
+ *
+ * \param token The token returned when the string was queued.
+ * \return `true` if the string was found and cancelled, otherwise `false`.
+ */
+bool send_string_async_cancel(send_string_token_t token);
+
+/**
+ * \brief Cancel every queued string.
+ */
+void send_string_async_cancel_all(void);
+
+/**
+ * \brief Check whether any string is queued or being typed.
+ *
+ * \return `true` if the asynchronous queue is not empty.
+ */
+bool send_string_async_is_busy(void);
+
+/**
+ * \brief Types out queued strings. Called from the main loop, should not be invoked by keyboard/user code.
+ */
+void send_string_async_task(void);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out in the background.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async(string, interval, callback, cb_arg).
+ */
+send_string_token_t send_string_async_P(const char *string, uint8_t interval, send_string_callback_t callback, void *cb_arg);
+#    else
+#        define send_string_async_P(string, interval, callback, cb_arg) send_string_async(string, interval, callback, cb_arg)
+#    endif
+#endif
+
 /** \} */
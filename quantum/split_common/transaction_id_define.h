@@ -80,8 +80,14 @@ enum serial_transaction_id {
 #endif // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+#    ifdef POINTING_DEVICE_MOTION_PIN
+    GET_POINTING_MOTION,
+    GET_POINTING_MOTION_DATA,
+    PUT_POINTING_MOTION_ACK,
+#    else
     GET_POINTING_CHECKSUM,
     GET_POINTING_DATA,
+#    endif
     PUT_POINTING_CPI,
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
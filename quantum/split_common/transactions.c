@@ -249,8 +249,9 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
             bool    actioned = false;
             uint8_t index;
             bool    clockwise;
-            while (okay && encoder_dequeue_event_advanced(&split_shmem->encoders.events, &index, &clockwise)) {
-                okay &= encoder_queue_event(index, clockwise);
+            uint8_t steps;
+            while (okay && encoder_dequeue_event_advanced(&split_shmem->encoders.events, &index, &clockwise, &steps)) {
+                okay &= encoder_queue_steps(index, clockwise, steps);
                 actioned = true;
             }
 
@@ -715,13 +716,38 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
         return true;
     }
 #    endif
-    static uint32_t last_update     = 0;
     static uint32_t last_cpi_update = 0;
     static uint16_t last_cpi        = 0;
-    report_mouse_t  temp_state;
     uint16_t        temp_cpi;
+#    ifdef POINTING_DEVICE_MOTION_PIN
+    static uint8_t                last_motion_count = 0;
+    static uint8_t                last_motion_ack   = 0;
+    static uint32_t               last_ack_update   = 0;
+    split_slave_pointing_motion_t motion;
+    // Only the motion count is polled, the report is read once per motion of the other side
+    bool okay = transport_read(GET_POINTING_MOTION, &motion.count, sizeof(motion.count));
+    if (okay && motion.count != last_motion_count) {
+        okay = transport_read(GET_POINTING_MOTION_DATA, &motion, sizeof(motion));
+        if (okay && motion.count != last_motion_count) {
+            pointing_device_set_shared_report(motion.report);
+            pointing_device_set_shared_motion(motion.timestamp);
+            last_motion_count = motion.count;
+        }
+    }
+    if (okay) {
+        // The other side keeps new motion in its sensor until the previous report is acknowledged
+        split_shmem->pointing.motion_ack = last_motion_count;
+        okay                             = send_if_condition(PUT_POINTING_MOTION_ACK, &last_ack_update, last_motion_ack != last_motion_count, &split_shmem->pointing.motion_ack, sizeof(split_shmem->pointing.motion_ack));
+        if (okay) {
+            last_motion_ack = last_motion_count;
+        }
+    }
+#    else
+    static uint32_t last_update = 0;
+    report_mouse_t  temp_state;
     bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
     if (okay) pointing_device_set_shared_report(temp_state);
+#    endif
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi) {
         split_shmem->pointing.cpi = temp_cpi;
@@ -745,7 +771,7 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
         return;
     }
 #    endif
-#    if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+#    if (POINTING_DEVICE_TASK_THROTTLE_MS > 0) && !defined(POINTING_DEVICE_MOTION_PIN)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
         return;
@@ -764,6 +790,21 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
         pointing_device_driver->set_cpi(pointing.cpi);
     }
 
+#    ifdef POINTING_DEVICE_MOTION_PIN
+    // Motion keeps accumulating in the sensor until the initiator has taken the previous report
+    if (pointing.motion_ack != pointing.motion.count || !pointing_device_motion_detected()) {
+        return;
+    }
+
+    pointing.motion.report    = pointing_device_driver->get_report((report_mouse_t){0});
+    pointing.motion.timestamp = sync_timer_read32();
+    pointing.motion.count++;
+
+    // Leave the acknowledgement alone, the initiator may have written it in the meantime
+    split_shared_memory_lock();
+    memcpy(&split_shmem->pointing.motion, &pointing.motion, sizeof(split_slave_pointing_motion_t));
+    split_shared_memory_unlock();
+#    else
     pointing.report = pointing_device_driver->get_report((report_mouse_t){0});
     // Now update the checksum given that the pointing has been written to
     pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
@@ -771,11 +812,16 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     split_shared_memory_lock();
     memcpy(&split_shmem->pointing, &pointing, sizeof(split_slave_pointing_sync_t));
     split_shared_memory_unlock();
+#    endif
 }
 
 #    define TRANSACTIONS_POINTING_MASTER() TRANSACTION_HANDLER_MASTER(pointing)
 #    define TRANSACTIONS_POINTING_SLAVE() TRANSACTION_HANDLER_SLAVE(pointing)
-#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_MOTION] = trans_target2initiator_initializer(pointing.motion.count), [GET_POINTING_MOTION_DATA] = trans_target2initiator_initializer(pointing.motion), [PUT_POINTING_MOTION_ACK] = trans_initiator2target_initializer(pointing.motion_ack), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    else
+#        define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    endif
 
 #else // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
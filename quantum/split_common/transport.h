@@ -108,10 +108,22 @@ typedef struct _split_mods_sync_t {
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 #    include "pointing_device.h"
+#    ifdef POINTING_DEVICE_MOTION_PIN
+typedef struct _split_slave_pointing_motion_t {
+    uint8_t        count;     // Bumped for every report read on motion
+    uint32_t       timestamp; // Sync timer at which the motion was read
+    report_mouse_t report;
+} split_slave_pointing_motion_t;
+#    endif
 typedef struct _split_slave_pointing_sync_t {
+#    ifdef POINTING_DEVICE_MOTION_PIN
+    split_slave_pointing_motion_t motion;
+    uint8_t                       motion_ack;
+#    else
     uint8_t        checksum;
     report_mouse_t report;
-    uint16_t       cpi;
+#    endif
+    uint16_t cpi;
 } split_slave_pointing_sync_t;
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
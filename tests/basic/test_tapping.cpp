@@ -190,3 +190,109 @@ TEST_F(Tapping, TapA_CTL_T_KeyWhileReleasingLayer) {
     run_one_scan_loop();
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(Tapping, ReleaseWaitingBehindTappingKeyKeepsLayerOfItsPress) {
+    TestDriver driver;
+    InSequence s;
+    auto       layer_key         = KeymapKey(0, 7, 0, MO(1));
+    auto       trans_key         = KeymapKey(1, 7, 0, KC_TRNS);
+    auto       mod_tap_hold_key  = KeymapKey(0, 8, 0, SFT_T(KC_P));
+    auto       mod_tap_trans_key = KeymapKey(1, 8, 0, KC_TRNS);
+    auto       regular_key0      = KeymapKey(0, 9, 0, KC_LSFT);
+    auto       regular_key1      = KeymapKey(1, 9, 0, KC_B);
+
+    set_keymap({layer_key, trans_key, mod_tap_hold_key, mod_tap_trans_key, regular_key0, regular_key1});
+
+    layer_key.press();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+
+    regular_key1.press();
+    EXPECT_REPORT(driver, (KC_B));
+    run_one_scan_loop();
+
+    layer_key.release();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+
+    mod_tap_hold_key.press();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+
+    // The release waits behind the mod-tap key, as the key is a modifier on layer 0
+    regular_key1.release();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+
+    // Pressing the key again on layer 0 must not change the layer the waiting release resolves on
+    regular_key0.press();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    mod_tap_hold_key.release();
+    EXPECT_REPORT(driver, (KC_B, KC_P));
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_P));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    regular_key0.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Tapping, WaitingBufferOverflowSettlesTappingKeyAsHeld) {
+    TestDriver driver;
+    InSequence s;
+    auto       layer_key         = KeymapKey(0, 7, 0, MO(1));
+    auto       trans_key         = KeymapKey(1, 7, 0, KC_TRNS);
+    auto       mod_tap_hold_key  = KeymapKey(0, 8, 0, SFT_T(KC_P));
+    auto       mod_tap_trans_key = KeymapKey(1, 8, 0, KC_TRNS);
+    auto       regular_key0      = KeymapKey(0, 9, 0, KC_A);
+    auto       regular_key1      = KeymapKey(1, 9, 0, KC_B);
+
+    set_keymap({layer_key, trans_key, mod_tap_hold_key, mod_tap_trans_key, regular_key0, regular_key1});
+
+    layer_key.press();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+
+    mod_tap_hold_key.press();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+
+    // Releasing the layer is delayed while tapping is in progress
+    layer_key.release();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+
+    // Six more events fill the waiting buffer
+    for (int i = 0; i < 3; i++) {
+        regular_key0.press();
+        run_one_scan_loop();
+        regular_key0.release();
+        run_one_scan_loop();
+    }
+    VERIFY_AND_CLEAR(driver);
+
+    // One more settles the mod-tap key as held, rather than dropping the waiting events with the layer release
+    EXPECT_REPORT(driver, (KC_LSFT));
+    for (int i = 0; i < 4; i++) {
+        EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+        EXPECT_REPORT(driver, (KC_LSFT));
+    }
+    regular_key0.press();
+    run_one_scan_loop();
+    regular_key0.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(layer_state, 0);
+
+    mod_tap_hold_key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
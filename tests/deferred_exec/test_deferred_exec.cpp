@@ -0,0 +1,150 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <set>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+}
+
+namespace {
+
+struct invocation_t {
+    uintptr_t id;
+    uint32_t  trigger_time;
+};
+
+std::vector<invocation_t> invocations;
+uint32_t                  repeat_delay = 0;
+
+uint32_t record_callback(uint32_t trigger_time, void* cb_arg) {
+    invocations.push_back({(uintptr_t)cb_arg, trigger_time});
+    return repeat_delay;
+}
+
+class DeferredExec : public TestFixture {
+   public:
+    void SetUp() override {
+        invocations.clear();
+        repeat_delay = 0;
+    }
+
+    void TearDown() override {
+        for (auto token : tokens) {
+            cancel_deferred_exec(token);
+        }
+    }
+
+    deferred_token defer(uint32_t delay_ms, uintptr_t id) {
+        deferred_token token = defer_exec(delay_ms, record_callback, (void*)id);
+        tokens.push_back(token);
+        return token;
+    }
+
+    std::vector<uintptr_t> invoked_ids() {
+        std::vector<uintptr_t> ids;
+        for (auto& invocation : invocations) {
+            ids.push_back(invocation.id);
+        }
+        return ids;
+    }
+
+    std::vector<deferred_token> tokens;
+};
+
+TEST_F(DeferredExec, RunsInDeadlineOrder) {
+    TestDriver driver;
+    defer(30, 3);
+    defer(10, 1);
+    defer(20, 2);
+
+    uint32_t deadline = 0;
+    ASSERT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, timer_read32() + 10);
+
+    idle_for(9);
+    deferred_exec_task();
+    EXPECT_TRUE(invocations.empty());
+
+    idle_for(25);
+    deferred_exec_task();
+    EXPECT_EQ(invoked_ids(), std::vector<uintptr_t>({1, 2, 3}));
+    EXPECT_FALSE(deferred_exec_next_deadline(&deadline));
+}
+
+TEST_F(DeferredExec, CancelAndExtend) {
+    TestDriver driver;
+    deferred_token first  = defer(10, 1);
+    deferred_token second = defer(20, 2);
+    deferred_token third  = defer(30, 3);
+
+    EXPECT_TRUE(cancel_deferred_exec(first));
+    EXPECT_FALSE(cancel_deferred_exec(first));
+    EXPECT_TRUE(extend_deferred_exec(second, 50));
+    EXPECT_FALSE(extend_deferred_exec(first, 50));
+
+    uint32_t deadline = 0;
+    ASSERT_TRUE(deferred_exec_next_deadline(&deadline));
+    EXPECT_EQ(deadline, timer_read32() + 30);
+
+    idle_for(40);
+    deferred_exec_task();
+    EXPECT_EQ(invoked_ids(), std::vector<uintptr_t>({3}));
+
+    idle_for(20);
+    deferred_exec_task();
+    EXPECT_EQ(invoked_ids(), std::vector<uintptr_t>({3, 2}));
+    EXPECT_FALSE(cancel_deferred_exec(third));
+}
+
+TEST_F(DeferredExec, RepeatsRelativeToTriggerTime) {
+    TestDriver driver;
+    uint32_t start = timer_read32();
+    repeat_delay   = 10;
+    defer(10, 1);
+
+    // Running late doesn't shift the schedule, but only one invocation happens per pass
+    idle_for(25);
+    deferred_exec_task();
+    ASSERT_EQ(invocations.size(), 1);
+    EXPECT_EQ(invocations[0].trigger_time, start + 10);
+
+    deferred_exec_task();
+    ASSERT_EQ(invocations.size(), 2);
+    EXPECT_EQ(invocations[1].trigger_time, start + 20);
+
+    deferred_exec_task();
+    EXPECT_EQ(invocations.size(), 2);
+}
+
+TEST_F(DeferredExec, TokensAreNotReusedImmediately) {
+    std::set<deferred_token> seen;
+    for (int i = 0; i < 32; ++i) {
+        deferred_token token = defer_exec(10, record_callback, nullptr);
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+        EXPECT_EQ(seen.count(token), 0);
+        seen.insert(token);
+        EXPECT_TRUE(cancel_deferred_exec(token));
+    }
+}
+
+TEST_F(DeferredExec, RejectsWhenFull) {
+    TestDriver driver;
+    for (int i = 0; i < MAX_DEFERRED_EXECUTORS; ++i) {
+        EXPECT_NE(defer(10 + i, i), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer_exec(5, record_callback, nullptr), INVALID_DEFERRED_TOKEN);
+
+    // Freeing any slot makes room again
+    EXPECT_TRUE(cancel_deferred_exec(tokens[3]));
+    EXPECT_NE(defer(5, 99), INVALID_DEFERRED_TOKEN);
+
+    idle_for(30);
+    deferred_exec_task();
+    EXPECT_EQ(invoked_ids(), std::vector<uintptr_t>({99, 0, 1, 2, 4, 5, 6, 7}));
+}
+
+} // namespace
@@ -0,0 +1 @@
+DIGITIZER_ENABLE = yes
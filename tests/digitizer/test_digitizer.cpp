@@ -0,0 +1,186 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "digitizer.h"
+}
+
+namespace {
+std::vector<report_digitizer_t> reports;
+bool                            ready = true;
+} // namespace
+
+extern "C" void send_digitizer(report_digitizer_t *report) {
+    reports.push_back(*report);
+}
+
+extern "C" bool digitizer_ready(void) {
+    return ready;
+}
+
+class Digitizer : public TestFixture {
+   public:
+    void SetUp() override {
+        reports.clear();
+        ready = true;
+    }
+
+    void TearDown() override {
+        ready = true;
+        digitizer_set_contacts(nullptr, 0);
+        digitizer_set_button(false);
+        digitizer_task();
+        digitizer_task();
+    }
+
+    // Finds a contact of the report by its position
+    static const report_digitizer_contact_t *contact_at(const report_digitizer_t &report, uint16_t x, uint16_t y) {
+        for (uint8_t i = 0; i < report.contact_count; i++) {
+            if (report.contacts[i].x == x && report.contacts[i].y == y) {
+                return &report.contacts[i];
+            }
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(Digitizer, ContactsKeepTheirIdentifierAsTheyMove) {
+    TestDriver driver;
+
+    digitizer_contact_t down[] = {{DIGITIZER_CONTACT_ID_NONE, true, 1000, 1000}, {DIGITIZER_CONTACT_ID_NONE, true, 9000, 9000}};
+    digitizer_set_contacts(down, 2);
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_EQ(reports[0].contact_count, 2);
+    auto first  = *contact_at(reports[0], 1000, 1000);
+    auto second = *contact_at(reports[0], 9000, 9000);
+    EXPECT_TRUE(first.tip);
+    EXPECT_TRUE(second.tip);
+    EXPECT_NE(first.contact_id, second.contact_id);
+
+    // The sensor lists the fingers in another order
+    digitizer_contact_t moved[] = {{DIGITIZER_CONTACT_ID_NONE, true, 9100, 8900}, {DIGITIZER_CONTACT_ID_NONE, true, 1100, 1050}};
+    digitizer_set_contacts(moved, 2);
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_EQ(contact_at(reports[1], 1100, 1050)->contact_id, first.contact_id);
+    EXPECT_EQ(contact_at(reports[1], 9100, 8900)->contact_id, second.contact_id);
+}
+
+TEST_F(Digitizer, SensorIdentifiersAreFollowed) {
+    TestDriver driver;
+
+    digitizer_contact_t down[] = {{4, true, 1000, 1000}, {7, true, 2000, 1000}};
+    digitizer_set_contacts(down, 2);
+    run_one_scan_loop();
+    auto first = *contact_at(reports[0], 1000, 1000);
+
+    // Too far to track by position, the identifier from the sensor is what counts
+    digitizer_contact_t crossed[] = {{7, true, 1000, 1000}, {4, true, 30000, 30000}};
+    digitizer_set_contacts(crossed, 2);
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_EQ(contact_at(reports[1], 30000, 30000)->contact_id, first.contact_id);
+    EXPECT_NE(contact_at(reports[1], 1000, 1000)->contact_id, first.contact_id);
+}
+
+TEST_F(Digitizer, LiftedContactIsReportedUpOnce) {
+    TestDriver driver;
+
+    digitizer_contact_t two[] = {{DIGITIZER_CONTACT_ID_NONE, true, 1000, 1000}, {DIGITIZER_CONTACT_ID_NONE, true, 9000, 9000}};
+    digitizer_set_contacts(two, 2);
+    run_one_scan_loop();
+
+    digitizer_set_contacts(two, 1);
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_EQ(reports[1].contact_count, 2);
+    EXPECT_TRUE(contact_at(reports[1], 1000, 1000)->tip);
+    EXPECT_FALSE(contact_at(reports[1], 9000, 9000)->tip);
+
+    digitizer_set_contacts(two, 1);
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 3);
+    EXPECT_EQ(reports[2].contact_count, 1);
+    EXPECT_TRUE(reports[2].contacts[0].tip);
+}
+
+TEST_F(Digitizer, BusyEndpointMergesUpdates) {
+    TestDriver driver;
+
+    ready                       = false;
+    digitizer_contact_t first[] = {{DIGITIZER_CONTACT_ID_NONE, true, 1000, 1000}};
+    digitizer_set_contacts(first, 1);
+    run_one_scan_loop();
+    digitizer_contact_t last[] = {{DIGITIZER_CONTACT_ID_NONE, true, 1200, 1100}};
+    digitizer_set_contacts(last, 1);
+    run_one_scan_loop();
+    EXPECT_TRUE(reports.empty());
+
+    ready = true;
+    run_one_scan_loop();
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_EQ(reports[0].contact_count, 1);
+    EXPECT_EQ(reports[0].contacts[0].x, 1200);
+    EXPECT_EQ(reports[0].contacts[0].y, 1100);
+}
+
+TEST_F(Digitizer, TapWhileBusyIsNotLost) {
+    TestDriver driver;
+
+    ready                     = false;
+    digitizer_contact_t tap[] = {{DIGITIZER_CONTACT_ID_NONE, true, 5000, 5000}};
+    digitizer_set_contacts(tap, 1);
+    digitizer_set_contacts(nullptr, 0);
+    run_one_scan_loop();
+    EXPECT_TRUE(reports.empty());
+
+    // The host sees the finger down, then up
+    ready = true;
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_EQ(reports[0].contact_count, 1);
+    EXPECT_TRUE(reports[0].contacts[0].tip);
+    EXPECT_EQ(reports[1].contact_count, 1);
+    EXPECT_FALSE(reports[1].contacts[0].tip);
+    EXPECT_EQ(reports[1].contacts[0].contact_id, reports[0].contacts[0].contact_id);
+}
+
+TEST_F(Digitizer, ContactsBeyondReportAreIgnored) {
+    TestDriver driver;
+
+    digitizer_contact_t four[] = {
+        {0, true, 1000, 1000},
+        {1, true, 2000, 1000},
+        {2, false, 3000, 1000},
+        {3, true, 4000, 1000},
+    };
+    digitizer_set_contacts(four, 4);
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_EQ(reports[0].contact_count, DIGITIZER_CONTACT_COUNT);
+    EXPECT_FALSE(contact_at(reports[0], 3000, 1000)->confidence);
+    EXPECT_EQ(contact_at(reports[0], 4000, 1000), nullptr);
+}
+
+TEST_F(Digitizer, ButtonIsReported) {
+    TestDriver driver;
+
+    digitizer_set_button(true);
+    run_one_scan_loop();
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_TRUE(reports[0].button);
+    EXPECT_EQ(reports[0].contact_count, 0);
+
+    // Unchanged state isn't sent again
+    run_one_scan_loop();
+    EXPECT_EQ(reports.size(), 1);
+}
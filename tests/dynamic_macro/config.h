@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Room for just 8 key records, which the compact encoding fits far more events in
+#define DYNAMIC_MACRO_SIZE 8
+#define DYNAMIC_MACRO_COUNT 3
+#define DYNAMIC_MACRO_PERSIST
+
+#define EEPROM_TEST_HARNESS_SIZE 512
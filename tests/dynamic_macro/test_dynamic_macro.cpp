@@ -0,0 +1,156 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "process_dynamic_macro.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+using testing::NiceMock;
+
+class DynamicMacro : public TestFixture {
+   public:
+    KeymapKey rec1 = KeymapKey(0, 0, 0, DM_REC1);
+    KeymapKey rec2 = KeymapKey(0, 1, 0, DM_REC2);
+    KeymapKey stop = KeymapKey(0, 2, 0, DM_RSTP);
+    KeymapKey ply1 = KeymapKey(0, 3, 0, DM_PLY1);
+    KeymapKey ply2 = KeymapKey(0, 4, 0, DM_PLY2);
+    KeymapKey key_a = KeymapKey(0, 5, 0, KC_A);
+    KeymapKey key_b = KeymapKey(0, 6, 0, KC_B);
+    KeymapKey key_c = KeymapKey(0, 7, 0, KC_C);
+
+    void SetUp() override {
+        set_keymap({rec1, rec2, stop, ply1, ply2, key_a, key_b, key_c});
+
+        // Start each test with empty macros
+        NiceMock<TestDriver> driver;
+        for (uint8_t slot = 0; slot < DYNAMIC_MACRO_COUNT; slot++) {
+            dynamic_macro_start_recording(slot);
+            dynamic_macro_stop_recording();
+        }
+    }
+};
+
+TEST_F(DynamicMacro, RecordsAndPlaysMacro) {
+    TestDriver driver;
+
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_REPORT(driver, (KC_B));
+    }
+    tap_key(rec1);
+    tap_keys(key_a, key_b);
+    tap_key(stop);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_REPORT(driver, (KC_B));
+    }
+    tap_key(ply1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, FitsMoreEventsThanKeyRecords) {
+    TestDriver driver;
+    const int  taps = DYNAMIC_MACRO_SIZE * 5 / 4;
+
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_C)).Times(taps);
+    tap_key(rec1);
+    for (int i = 0; i < taps; i++) {
+        tap_key(key_c);
+    }
+    tap_key(stop);
+    VERIFY_AND_CLEAR(driver);
+
+    // Each tap is two events, two and a half times as many as the buffer holds key records
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_C)).Times(taps);
+    tap_key(ply1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, RerecordingKeepsOtherMacros) {
+    TestDriver driver;
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(rec2);
+    tap_key(key_b);
+    tap_key(stop);
+    tap_key(rec1);
+    tap_key(key_a);
+    tap_key(stop);
+    dynamic_macro_start_recording(2);
+    tap_keys(key_a, key_b);
+    dynamic_macro_stop_recording();
+    tap_key(rec1);
+    tap_keys(key_c, key_c);
+    tap_key(stop);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_REPORT(driver, (KC_C));
+        EXPECT_REPORT(driver, (KC_C));
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_REPORT(driver, (KC_B));
+    }
+    tap_key(ply2);
+    tap_key(ply1);
+    dynamic_macro_play(2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, TrimsKeysHeldWhenRecordingStops) {
+    TestDriver driver;
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(rec1);
+    tap_key(key_a);
+    key_b.press();
+    run_one_scan_loop();
+    tap_key(stop);
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_A));
+    tap_key(ply1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicMacro, StoresMacrosOnceUnchanged) {
+    TestDriver driver;
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    tap_key(rec1);
+    tap_key(key_a);
+    tap_key(stop);
+    idle_for(DYNAMIC_MACRO_FLUSH_DELAY + 100);
+
+    // Changes are only stored after a while, so a restart right away loses this one
+    tap_key(rec1);
+    tap_key(key_b);
+    tap_key(stop);
+    idle_for(DYNAMIC_MACRO_FLUSH_DELAY / 2);
+    dynamic_macro_init();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_A));
+    tap_key(ply1);
+    VERIFY_AND_CLEAR(driver);
+}
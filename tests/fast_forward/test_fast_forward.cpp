@@ -0,0 +1,105 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+namespace {
+
+uint32_t invoked_at = 0;
+
+uint32_t record_callback(uint32_t trigger_time, void* cb_arg) {
+    invoked_at = timer_read32();
+    return 0;
+}
+
+} // namespace
+
+class FastForward : public TestFixture {
+   public:
+    void SetUp() override {
+        invoked_at = 0;
+    }
+};
+
+TEST_F(FastForward, ReachesTheEndOfTheIdlePeriod) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    uint32_t start = timer_read32();
+    fast_forward(60000);
+    EXPECT_EQ(timer_read32() - start, 60000);
+}
+
+TEST_F(FastForward, StopsAtDeferredExecutorDeadlines) {
+    TestDriver driver;
+    EXPECT_NO_REPORT(driver);
+
+    uint32_t       start = timer_read32();
+    deferred_token token = defer_exec(45000, record_callback, NULL);
+    EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+
+    fast_forward(60000);
+    EXPECT_EQ(invoked_at - start, 45000);
+}
+
+TEST_F(FastForward, ResolvesTapHoldKeysLikeIdling) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_A));
+
+    set_keymap({mod_tap_key});
+
+    mod_tap_key.press();
+    EXPECT_REPORT(driver, (KC_LSFT));
+    fast_forward(TAPPING_TERM * 100);
+    VERIFY_AND_CLEAR(driver);
+
+    mod_tap_key.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(FastForward, RestoresLayersModsAndTime) {
+    TestDriver driver;
+    auto       key_a   = KeymapKey(0, 0, 0, KC_A);
+    auto       key_osm = KeymapKey(0, 1, 0, OSM(MOD_LCTL));
+    auto       key_b   = KeymapKey(1, 0, 0, KC_B);
+
+    set_keymap({key_a, key_osm, key_b});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_osm);
+    layer_on(1);
+    VERIFY_AND_CLEAR(driver);
+
+    KeyboardState state = snapshot_state();
+
+    // Leave the snapshot behind
+    EXPECT_REPORT(driver, (KC_LCTL, KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    layer_off(1);
+    idle_for(1000);
+    VERIFY_AND_CLEAR(driver);
+
+    restore_state(state);
+    EXPECT_EQ(timer_read32(), state.time);
+    EXPECT_TRUE(layer_state_is(1));
+    EXPECT_EQ(get_oneshot_mods(), MOD_BIT(KC_LCTL));
+
+    // Replaying from the snapshot gives the same result
+    EXPECT_REPORT(driver, (KC_LCTL, KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+}
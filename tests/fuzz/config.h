@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Seed of the random key event streams, change it to explore other streams
+#define FUZZ_SEED 0x514D4B
+
+// Number of key events generated for each feature profile
+#define FUZZ_EVENT_COUNT 20000
@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+enum combos { jk_combo, kl_combo };
+
+uint16_t const jk_combo_keys[] = {KC_J, KC_K, COMBO_END};
+uint16_t const kl_combo_keys[] = {KC_K, KC_L, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [jk_combo] = COMBO(jk_combo_keys, KC_ESC),
+    [kl_combo] = COMBO(kl_combo_keys, LCTL(KC_Z))
+};
+
+tap_dance_action_t tap_dance_actions[] = {
+    [0] = ACTION_TAP_DANCE_DOUBLE(KC_X, KC_Y),
+};
+
+const key_override_t delete_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t home_override   = ko_make_basic(MOD_MASK_CTRL, KC_A, KC_HOME);
+
+const key_override_t *key_overrides[] = {
+    &delete_override,
+    &home_override,
+};
+// clang-format on
@@ -0,0 +1,287 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "process_autocorrect.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+
+#ifndef FUZZ_SEED
+#    define FUZZ_SEED 0
+#endif
+
+#ifndef FUZZ_EVENT_COUNT
+#    define FUZZ_EVENT_COUNT 10000
+#endif
+
+namespace {
+
+/**
+ * @brief The features exercised by a random key event stream.
+ */
+struct FuzzProfile {
+    const char* name;
+    bool        mod_taps;
+    bool        combos;
+    bool        tap_dance;
+    bool        key_overrides;
+    bool        autocorrect;
+};
+
+// clang-format off
+const FuzzProfile profiles[] = {
+    {"plain",         false, false, false, false, false},
+    {"mod_taps",      true,  false, false, false, false},
+    {"combos",        false, true,  false, false, false},
+    {"tap_dance",     false, false, true,  false, false},
+    {"key_overrides", false, false, false, true,  false},
+    {"autocorrect",   false, false, false, false, true },
+    {"all",           true,  true,  true,  true,  true },
+};
+// clang-format on
+
+std::ostream& operator<<(std::ostream& os, const FuzzProfile& profile) {
+    return os << profile.name;
+}
+
+/**
+ * @brief Counts how often each HID code and modifier appears in and disappears from consecutive keyboard reports.
+ */
+class ReportBalance {
+   public:
+    void record(const report_keyboard_t& report) {
+        for (uint8_t code : codes(report)) {
+            if (!last.count(code)) {
+                downs[code]++;
+            }
+        }
+        for (uint8_t code : last) {
+            if (!codes(report).count(code)) {
+                ups[code]++;
+            }
+        }
+        last = codes(report);
+        reports++;
+    }
+
+    // Codes still down, or released more often than pressed
+    std::vector<uint8_t> unbalanced() const {
+        std::vector<uint8_t> result;
+        for (auto& [code, count] : downs) {
+            auto up = ups.find(code);
+            if (up == ups.end() || up->second != count) {
+                result.push_back(code);
+            }
+        }
+        return result;
+    }
+
+    size_t reports = 0;
+
+   private:
+    static std::set<uint8_t> codes(const report_keyboard_t& report) {
+        std::set<uint8_t> result;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            if (report.mods & (1 << bit)) {
+                result.insert(KC_LEFT_CTRL + bit);
+            }
+        }
+        for (uint8_t key : report.keys) {
+            if (key != KC_NO) {
+                result.insert(key);
+            }
+        }
+        return result;
+    }
+
+    std::set<uint8_t>         last;
+    std::map<uint8_t, size_t> downs;
+    std::map<uint8_t, size_t> ups;
+};
+
+} // namespace
+
+class Fuzz : public TestFixture, public testing::WithParamInterface<FuzzProfile> {
+   public:
+    void SetUp() override {
+        const FuzzProfile& profile = GetParam();
+
+        if (profile.autocorrect) {
+            autocorrect_enable();
+        } else {
+            autocorrect_disable();
+        }
+
+        // The layer keys move the first letters to digits, and turn the dual-role keys into plain keys
+        uint8_t col = 0;
+        for (uint16_t keycode : {KC_A, KC_E, KC_F, KC_L, KC_R, KC_S, KC_T, KC_U, KC_SPC}) {
+            map_key(0, col, keycode, col < 3 ? KC_1 + col : KC_TRNS);
+            col++;
+        }
+        if (profile.mod_taps) {
+            map_key(1, 0, SFT_T(KC_I), KC_7);
+            map_key(1, 1, CTL_T(KC_O), KC_8);
+            map_key(1, 2, LT(1, KC_N), KC_9);
+            map_key(1, 3, MO(1));
+        }
+        if (profile.combos) {
+            map_key(2, 0, KC_J);
+            map_key(2, 1, KC_K);
+        }
+        if (profile.tap_dance) {
+            map_key(2, 2, TD(0));
+        }
+        if (profile.key_overrides) {
+            map_key(3, 0, KC_BSPC);
+            map_key(3, 1, KC_LSFT);
+            map_key(3, 2, KC_LCTL);
+        }
+    }
+
+    void TearDown() override {
+        autocorrect_disable();
+    }
+
+    /**
+     * @brief Maps a key on the base layer, and its counterpart on the layer reached by the layer keys.
+     */
+    void map_key(uint8_t row, uint8_t col, uint16_t keycode, uint16_t layer_keycode = KC_TRNS) {
+        keys.push_back(KeymapKey(0, col, row, keycode));
+        add_key(keys.back());
+        add_key(KeymapKey(1, col, row, layer_keycode));
+    }
+
+    // Runs one scan loop, adding its cost to the totals
+    std::chrono::nanoseconds timed_scan() {
+        auto start = std::chrono::steady_clock::now();
+        keyboard_task();
+        housekeeping_task();
+        auto cost = std::chrono::steady_clock::now() - start;
+        advance_time(1);
+
+        scan_time += cost;
+        scans++;
+        return cost;
+    }
+
+    void idle(unsigned ms) {
+        for (unsigned i = 0; i < ms; i++) {
+            timed_scan();
+        }
+    }
+
+    // Runs the scan loop which processes a key event, which is what the throughput is measured on
+    void timed_event() {
+        auto cost = timed_scan();
+
+        event_time += cost;
+        max_event_cost = std::max(max_event_cost, cost);
+        events++;
+    }
+
+    void expect_released(const ReportBalance& balance, uint32_t seed, size_t burst) {
+        EXPECT_THAT(balance.unbalanced(), testing::IsEmpty()) << "seed " << seed << ", burst " << burst << ": codes left in reports";
+        EXPECT_EQ(get_mods(), 0) << "seed " << seed << ", burst " << burst;
+        EXPECT_EQ(get_weak_mods(), 0) << "seed " << seed << ", burst " << burst;
+        EXPECT_EQ(layer_state, 0) << "seed " << seed << ", burst " << burst;
+        EXPECT_TRUE(is_keyboard_report_empty()) << "seed " << seed << ", burst " << burst << ": keys stuck in the report";
+    }
+
+    bool is_keyboard_report_empty() const {
+        return keyboard_report->mods == 0 && std::all_of(std::begin(keyboard_report->keys), std::end(keyboard_report->keys), [](uint8_t key) { return key == KC_NO; });
+    }
+
+    std::vector<KeymapKey>   keys;
+    std::chrono::nanoseconds scan_time{0};
+    size_t                   scans = 0;
+    std::chrono::nanoseconds event_time{0};
+    std::chrono::nanoseconds max_event_cost{0};
+    size_t                   events = 0;
+};
+
+/*
+ * Plays random bursts of overlapping key presses and releases, releasing every key after each burst. Once the
+ * keyboard settles, no key may be left in the report and every code added to a report must have been removed again.
+ */
+TEST_P(Fuzz, RandomKeyStreamsReleaseEveryKey) {
+    NiceMock<TestDriver> driver;
+    ReportBalance        balance;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&](report_keyboard_t& report) { balance.record(report); }));
+
+    const uint32_t seed = FUZZ_SEED + std::distance(std::begin(profiles), std::find_if(std::begin(profiles), std::end(profiles), [&](const FuzzProfile& profile) { return std::string(profile.name) == GetParam().name; }));
+    std::mt19937   random(seed);
+    auto           chance = [&](unsigned percent) { return std::uniform_int_distribution<unsigned>(0, 99)(random) < percent; };
+    auto           pick   = [&](size_t count) { return std::uniform_int_distribution<size_t>(0, count - 1)(random); };
+
+    std::vector<size_t>      held;
+    size_t                   bursts = 0;
+
+    while (events < FUZZ_EVENT_COUNT) {
+        size_t burst_length = 1 + pick(32);
+
+        for (size_t i = 0; i < burst_length; i++) {
+            // Mostly roll over a few keys at a time, as a typist would
+            bool press = held.empty() || (held.size() < 4 && chance(55));
+            if (press) {
+                size_t key  = pick(keys.size());
+                auto   same = std::find(held.begin(), held.end(), key);
+                if (same == held.end()) {
+                    keys[key].press();
+                    held.push_back(key);
+                } else {
+                    keys[key].release();
+                    held.erase(same);
+                }
+            } else {
+                auto key = held.begin() + pick(held.size());
+                keys[*key].release();
+                held.erase(key);
+            }
+
+            timed_event();
+
+            // Land on both sides of the tapping and combo terms
+            idle(chance(80) ? pick(TAPPING_TERM / 4) : pick(TAPPING_TERM * 2));
+        }
+
+        for (size_t key : held) {
+            keys[key].release();
+            timed_event();
+        }
+        held.clear();
+
+        fast_forward(TAPPING_TERM * 4);
+        expect_released(balance, seed, bursts++);
+        if (HasFailure()) {
+            break;
+        }
+    }
+
+    double events_per_sec  = events / std::chrono::duration<double>(event_time).count();
+    auto   max_event_us    = std::chrono::duration<double, std::micro>(max_event_cost).count();
+    auto   average_scan_ns = std::chrono::duration<double, std::nano>(scan_time).count() / scans;
+
+    RecordProperty("events", events);
+    RecordProperty("events_per_second", (int)events_per_sec);
+    RecordProperty("max_event_cost_ns", (int)max_event_cost.count());
+
+    std::cout << "[ BENCH    ] " << GetParam().name << ": " << events << " events, " << balance.reports << " reports; " << (size_t)events_per_sec << " events/s, max event cost " << max_event_us << " us, " << average_scan_ns << " ns per scan" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(Profiles, Fuzz, testing::ValuesIn(profiles), [](const testing::TestParamInfo<FuzzProfile>& info) { return std::string(info.param.name); });
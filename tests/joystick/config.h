@@ -0,0 +1,16 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "test_common.h"
+
+// The test platform has no GPIO of its own
+typedef uint8_t pin_t;
+
+#define JOYSTICK_AXIS_COUNT 2
+#define JOYSTICK_OVERSAMPLE 4
+#define JOYSTICK_FILTER_SHIFT 2
+#define JOYSTICK_DEADZONE 4
+#define JOYSTICK_HYSTERESIS 2
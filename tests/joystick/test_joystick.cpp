@@ -0,0 +1,143 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <functional>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "joystick.h"
+}
+
+namespace {
+std::vector<report_joystick_t> reports;
+// ADC reading of the analog axis, given how many samples have been taken
+std::function<uint16_t(uint32_t)> adc = [](uint32_t) { return 512; };
+uint32_t                          samples = 0;
+} // namespace
+
+extern "C" {
+joystick_config_t joystick_axes[JOYSTICK_AXIS_COUNT] = {
+    JOYSTICK_AXIS_IN(1, 0, 512, 1023),
+    JOYSTICK_AXIS_VIRTUAL,
+};
+
+uint16_t joystick_axis_sample(uint8_t axis) {
+    return adc(samples++);
+}
+
+void send_joystick(report_joystick_t *report) {
+    reports.push_back(*report);
+}
+}
+
+class Joystick : public TestFixture {
+   public:
+    void SetUp() override {
+        reports.clear();
+        samples = 0;
+    }
+
+    void TearDown() override {
+        // Let the filter settle back at rest for the next test
+        TestDriver driver;
+        adc = [](uint32_t) { return 512; };
+        idle_for(50);
+    }
+};
+
+TEST_F(Joystick, NoiseAtRestSendsNoReports) {
+    TestDriver driver;
+
+    // A few counts of noise either side of the rest position
+    adc = [](uint32_t n) { return 512 + (int)((n * 7919) % 13) - 6; };
+    idle_for(500);
+
+    EXPECT_TRUE(reports.empty());
+    EXPECT_EQ(joystick_state.axes[0], 0);
+}
+
+TEST_F(Joystick, OversamplingAveragesOutAlternatingNoise) {
+    TestDriver driver;
+
+    // Far outside the deadzone on every single sample, but centered on average
+    adc = [](uint32_t n) { return n % 2 ? 512 + 100 : 512 - 100; };
+    idle_for(100);
+
+    EXPECT_TRUE(reports.empty());
+}
+
+TEST_F(Joystick, SmallOffsetStaysInDeadzone) {
+    TestDriver driver;
+
+    adc = [](uint32_t) { return 512 + 16; };
+    idle_for(100);
+
+    EXPECT_TRUE(reports.empty());
+}
+
+TEST_F(Joystick, MovementIsReportedAndSettles) {
+    TestDriver driver;
+
+    adc = [](uint32_t) { return 1023; };
+    idle_for(100);
+
+    ASSERT_FALSE(reports.empty());
+    EXPECT_EQ(reports.back().axes[0], JOYSTICK_MAX_VALUE);
+    // The filter eases towards the new position over a handful of reports, rather than one per scan
+    EXPECT_LT(reports.size(), 20);
+
+    size_t moving = reports.size();
+    idle_for(100);
+    EXPECT_EQ(reports.size(), moving);
+
+    adc = [](uint32_t) { return 512; };
+    idle_for(100);
+
+    EXPECT_GT(reports.size(), moving);
+    EXPECT_EQ(reports.back().axes[0], 0);
+}
+
+TEST_F(Joystick, HysteresisHoldsSmallChanges) {
+    TestDriver driver;
+
+    adc = [](uint32_t) { return 512 + 256; };
+    idle_for(100);
+    ASSERT_FALSE(reports.empty());
+    int16_t held = reports.back().axes[0];
+    size_t  sent = reports.size();
+
+    // The filter approaches from below, so the held value may trail the axis by up to the hysteresis: noise below
+    // the axis stays within it
+    adc = [](uint32_t n) { return 512 + 256 - (int)(n / 64 % 4); };
+    idle_for(200);
+
+    EXPECT_EQ(reports.size(), sent);
+    EXPECT_EQ(joystick_state.axes[0], held);
+
+    // A real movement
+    adc = [](uint32_t) { return 512 + 256 + 40; };
+    idle_for(100);
+
+    EXPECT_GT(reports.size(), sent);
+    EXPECT_GT(reports.back().axes[0], held + JOYSTICK_HYSTERESIS);
+}
+
+TEST_F(Joystick, ReadingAnAxisDoesNotStepTheFilter) {
+    TestDriver driver;
+
+    // Settle the filter at rest
+    run_one_scan_loop();
+
+    adc = [](uint32_t) { return 1023; };
+    for (int i = 0; i < 50; i++) {
+        EXPECT_EQ(joystick_read_axis(0), JOYSTICK_MAX_VALUE);
+    }
+
+    // The first report only moves by a step of the filter
+    run_one_scan_loop();
+    ASSERT_FALSE(reports.empty());
+    EXPECT_LT(reports.back().axes[0], JOYSTICK_MAX_VALUE / 2);
+}
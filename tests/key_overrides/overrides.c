@@ -0,0 +1,19 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+// clang-format off
+const key_override_t f1_override        = ko_make_basic(MOD_MASK_GUI, KC_1, KC_F1);
+const key_override_t delete_override    = ko_make_with_layers(MOD_MASK_SHIFT, KC_BSPC, KC_DEL, 1 << 0);
+const key_override_t insert_override    = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_INS);
+const key_override_t ctrl_alt_override  = ko_make_basic(MOD_MASK_CA, KC_NO, KC_F13);
+const key_override_t ctrl_alt_a_override = ko_make_basic(MOD_MASK_CA, KC_A, KC_F14);
+
+const key_override_t *key_overrides[] = {
+    &f1_override,
+    &delete_override,
+    &insert_override,
+    &ctrl_alt_override,
+    &ctrl_alt_a_override,
+};
+// clang-format on
@@ -0,0 +1,129 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+class KeyOverrides : public TestFixture {};
+
+TEST_F(KeyOverrides, TriggerKeyActivatesOverride) {
+    TestDriver driver;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_shift, key_bspc});
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    key_bspc.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_bspc.release();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrides, LayerMaskSelectsBetweenOverridesSharingATrigger) {
+    TestDriver driver;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_mo(0, 2, 0, MO(1));
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    KeymapKey  key_shift_1(1, 0, 0, KC_LSFT);
+    KeymapKey  key_mo_1(1, 2, 0, KC_TRNS);
+    KeymapKey  key_bspc_1(1, 1, 0, KC_BSPC);
+    set_keymap({key_shift, key_mo, key_bspc, key_shift_1, key_mo_1, key_bspc_1});
+
+    // The layer 0 only override comes first, so it takes precedence there...
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_DEL)).Times(1);
+    key_shift.press();
+    run_one_scan_loop();
+    tap_key(key_bspc);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // ...while the second one applies on any other layer
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_INS)).Times(1);
+    EXPECT_REPORT(driver, (KC_DEL)).Times(0);
+    key_mo.press();
+    run_one_scan_loop();
+    key_shift_1.press();
+    run_one_scan_loop();
+    tap_key(key_bspc_1);
+    key_shift_1.release();
+    run_one_scan_loop();
+    key_mo_1.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrides, ModifierActivatesOverrideForHeldTrigger) {
+    TestDriver driver;
+    KeymapKey  key_gui(0, 0, 0, KC_LGUI);
+    KeymapKey  key_1(0, 1, 0, KC_1);
+    set_keymap({key_gui, key_1});
+
+    EXPECT_REPORT(driver, (KC_1));
+    key_1.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The replacement is only registered after the key repeat delay
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_F1)).Times(1);
+    key_gui.press();
+    run_one_scan_loop();
+    idle_for(600);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_1.release();
+    run_one_scan_loop();
+    key_gui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverrides, EarlierTriggerlessOverrideWins) {
+    TestDriver driver;
+    KeymapKey  key_ctrl(0, 0, 0, KC_LCTL);
+    KeymapKey  key_alt(0, 1, 0, KC_LALT);
+    KeymapKey  key_a(0, 2, 0, KC_A);
+    set_keymap({key_ctrl, key_alt, key_a});
+
+    // With KC_A held, completing the modifiers satisfies both overrides, and the one defined first is chosen
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_A, KC_F13)).Times(1);
+    EXPECT_REPORT(driver, (KC_A, KC_F14)).Times(0);
+    key_a.press();
+    run_one_scan_loop();
+    key_ctrl.press();
+    run_one_scan_loop();
+    key_alt.press();
+    run_one_scan_loop();
+    idle_for(600);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    key_a.release();
+    run_one_scan_loop();
+    key_alt.release();
+    run_one_scan_loop();
+    key_ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
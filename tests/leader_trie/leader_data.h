@@ -0,0 +1,33 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Generated by `qmk generate-leader-data`
+
+#pragma once
+
+// Leader sequences (5 entries):
+//   0: KC_A -> KC_1
+//   1: KC_A, KC_B -> KC_2
+//   2: KC_A, KC_B, KC_C -> LSFT(KC_3)
+//   3: KC_C, KC_D -> KC_4
+//   4: KC_E -> KC_NO
+
+// Sequences may use the keycodes declared by the keymap
+#if __has_include("keymap.h")
+#    include "keymap.h"
+#endif
+
+#define LEADER_TRIE_ENABLE
+#define LEADER_SEQUENCE_COUNT 5
+#define LEADER_TRIE_SIZE 24
+
+// clang-format off
+static const uint16_t leader_trie[LEADER_TRIE_SIZE] PROGMEM = {
+    0x0003, KC_A, 7, KC_C, 17, KC_E, 22, 0x8001, 0, KC_B, 11, 0x8001, 1, KC_C, 15, 0x8000, 2, 0x0001, KC_D, 20, 0x8000,
+    3, 0x8000, 4
+};
+
+static const uint16_t leader_sequence_keycodes[LEADER_SEQUENCE_COUNT] PROGMEM = {
+    KC_1, KC_2, LSFT(KC_3), KC_4, KC_NO
+};
+// clang-format on
@@ -0,0 +1,16 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+uint16_t last_matched_sequence = UINT16_MAX;
+uint8_t  leader_end_count      = 0;
+
+bool leader_sequence_user(uint16_t index) {
+    last_matched_sequence = index;
+    return true;
+}
+
+void leader_end_user(void) {
+    leader_end_count++;
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define MK_KINEMATIC
+#define MOUSEKEY_KINEMATIC_FRICTION 8000
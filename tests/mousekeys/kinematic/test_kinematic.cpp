@@ -0,0 +1,197 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+
+class MousekeyKinematic : public TestFixture {
+   public:
+    void SetUp() override {
+        mk_delay    = MOUSEKEY_DELAY / 10;
+        mk_interval = MOUSEKEY_INTERVAL;
+    }
+
+    // Sums up the motion of every mouse report sent
+    void record_motion(TestDriver& driver) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([this](report_mouse_t& report) {
+            x += report.x;
+            y += report.y;
+            h += report.h;
+            v += report.v;
+            reports++;
+            last = report;
+        }));
+    }
+
+    int            x = 0, y = 0, h = 0, v = 0;
+    int            reports = 0;
+    report_mouse_t last    = {};
+};
+
+TEST_F(MousekeyKinematic, TapMovesOneStep) {
+    TestDriver driver;
+    KeymapKey  mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_RIGHT};
+
+    set_keymap({mouse_key});
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    mouse_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(MOUSEKEY_DELAY / 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    mouse_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(MOUSEKEY_DELAY * 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeyKinematic, DistanceDoesNotDependOnInterval) {
+    KeymapKey mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_DOWN};
+    set_keymap({mouse_key});
+
+    // 100 px/s accelerating by 2000 px/s^2 for half a second covers 300 px, after the initial step
+    int distances[2];
+    for (uint8_t i = 0; i < 2; i++) {
+        TestDriver driver;
+        record_motion(driver);
+        y           = 0;
+        mk_interval = i ? 20 : 5;
+
+        mouse_key.press();
+        idle_for(MOUSEKEY_DELAY + 500);
+        distances[i] = y;
+
+        mouse_key.release();
+        idle_for(500);
+        VERIFY_AND_CLEAR(driver);
+    }
+
+    // Motion since the last movement is only reported on the next one, up to 20 ms later
+    EXPECT_NEAR(distances[0], 1 + 300, 25);
+    EXPECT_NEAR(distances[1], distances[0], 25);
+}
+
+TEST_F(MousekeyKinematic, SpeedIsCappedAtMaximum) {
+    TestDriver driver;
+    KeymapKey  mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_LEFT};
+
+    set_keymap({mouse_key});
+    record_motion(driver);
+
+    mouse_key.press();
+    idle_for(MOUSEKEY_DELAY + 2000);
+
+    // 2000 px/s over 8 ms
+    x = 0;
+    idle_for(MOUSEKEY_INTERVAL * 10);
+    EXPECT_EQ(x, -MOUSEKEY_KINEMATIC_MAX_SPEED * MOUSEKEY_INTERVAL * 10 / 1000);
+
+    mouse_key.release();
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeyKinematic, DiagonalMovesAtTheSameSpeed) {
+    TestDriver driver;
+    KeymapKey  right = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_RIGHT};
+    KeymapKey  up    = KeymapKey{0, 1, 0, QK_MOUSE_CURSOR_UP};
+
+    set_keymap({right, up});
+    record_motion(driver);
+
+    right.press();
+    up.press();
+    idle_for(MOUSEKEY_DELAY + 2000);
+
+    x = 0;
+    y = 0;
+    idle_for(1000);
+    EXPECT_NEAR(x, 1414, 10);
+    EXPECT_NEAR(y, -1414, 10);
+
+    right.release();
+    up.release();
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeyKinematic, CursorGlidesToAStopAfterRelease) {
+    TestDriver driver;
+    KeymapKey  mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_RIGHT};
+
+    set_keymap({mouse_key});
+    record_motion(driver);
+
+    mouse_key.press();
+    idle_for(MOUSEKEY_DELAY + 2000);
+    mouse_key.release();
+    run_one_scan_loop();
+
+    // Slowing down from 2000 px/s by 8000 px/s^2 takes 250 ms and covers 250 px, give or take the interval during
+    // which the key was released
+    x = 0;
+    idle_for(300);
+    EXPECT_NEAR(x, 250, 2000 * MOUSEKEY_INTERVAL / 1000);
+
+    reports = 0;
+    idle_for(300);
+    EXPECT_EQ(reports, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeyKinematic, AccelerationKeysSelectConstantSpeeds) {
+    TestDriver driver;
+    KeymapKey  mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_RIGHT};
+    KeymapKey  accel     = KeymapKey{0, 1, 0, QK_MOUSE_ACCELERATION_0};
+
+    set_keymap({mouse_key, accel});
+    record_motion(driver);
+
+    accel.press();
+    run_one_scan_loop();
+    mouse_key.press();
+    idle_for(MOUSEKEY_DELAY + MOUSEKEY_INTERVAL);
+
+    x = 0;
+    idle_for(1000);
+    EXPECT_NEAR(x, MOUSEKEY_KINEMATIC_MAX_SPEED / 4, 5);
+
+    mouse_key.release();
+    accel.release();
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MousekeyKinematic, WheelScrollsInSteps) {
+    TestDriver driver;
+    KeymapKey  mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_WHEEL_UP};
+
+    set_keymap({mouse_key});
+    record_motion(driver);
+
+    mouse_key.press();
+    run_one_scan_loop();
+    EXPECT_EQ(v, 1);
+
+    // 12 steps/s accelerating by 20 steps/s^2 for a second covers 22 steps
+    idle_for(MOUSEKEY_DELAY + 1000);
+    EXPECT_NEAR(v, 1 + 22, 2);
+    EXPECT_LE(last.v, 1);
+
+    mouse_key.release();
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS TRUE
+
+// Reference and target surfaces for the tiled surface tests, plus the QGF, primitives and flash asset test surfaces
+#define SURFACE_NUM_DEVICES 5
+
+// Keep the asset store away from address zero, so that offsets are exercised
+#define QUANTUM_PAINTER_ASSET_STORE_ADDRESS 0x1000
@@ -0,0 +1,94 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdio.h>
+#include <string.h>
+
+#include "flash.h"
+#include "flash_mock.h"
+
+// File-backed NOR flash, so that reads go through a real storage layer rather than straight out of a RAM array.
+static FILE *flash_file = NULL;
+
+flash_mock_stats_t flash_mock_stats = {0};
+
+static flash_status_t flash_mock_fill(uint32_t addr, size_t len) {
+    if (addr + len > MOCK_FLASH_SIZE) {
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+    uint8_t erased[MOCK_FLASH_SECTOR_SIZE];
+    memset(erased, 0xFF, sizeof(erased));
+    fseek(flash_file, addr, SEEK_SET);
+    while (len > 0) {
+        size_t chunk = len < sizeof(erased) ? len : sizeof(erased);
+        if (fwrite(erased, 1, chunk, flash_file) != chunk) {
+            return FLASH_STATUS_ERROR;
+        }
+        len -= chunk;
+    }
+    return FLASH_STATUS_SUCCESS;
+}
+
+void flash_init(void) {
+    if (!flash_file) {
+        flash_file = tmpfile();
+    }
+    flash_mock_fill(0, MOCK_FLASH_SIZE);
+    memset(&flash_mock_stats, 0, sizeof(flash_mock_stats));
+}
+
+flash_status_t flash_is_busy(void) {
+    return FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t flash_begin_erase_chip(void) {
+    return flash_mock_fill(0, MOCK_FLASH_SIZE);
+}
+
+flash_status_t flash_wait_erase_chip(void) {
+    return FLASH_STATUS_SUCCESS;
+}
+
+flash_status_t flash_erase_chip(void) {
+    return flash_mock_fill(0, MOCK_FLASH_SIZE);
+}
+
+flash_status_t flash_erase_block(uint32_t addr) {
+    return flash_mock_fill(addr & ~(MOCK_FLASH_BLOCK_SIZE - 1), MOCK_FLASH_BLOCK_SIZE);
+}
+
+flash_status_t flash_erase_sector(uint32_t addr) {
+    return flash_mock_fill(addr & ~(MOCK_FLASH_SECTOR_SIZE - 1), MOCK_FLASH_SECTOR_SIZE);
+}
+
+flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
+    if (!flash_file || addr + len > MOCK_FLASH_SIZE) {
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+    flash_mock_stats.read_transactions++;
+    flash_mock_stats.read_bytes += len;
+    fseek(flash_file, addr, SEEK_SET);
+    return fread(buf, 1, len, flash_file) == len ? FLASH_STATUS_SUCCESS : FLASH_STATUS_ERROR;
+}
+
+flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len) {
+    if (!flash_file || addr + len > MOCK_FLASH_SIZE) {
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+
+    // NOR flash can only clear bits, so merge with the existing contents
+    const uint8_t *src = (const uint8_t *)buf;
+    for (size_t i = 0; i < len; ++i) {
+        uint8_t existing;
+        fseek(flash_file, addr + i, SEEK_SET);
+        if (fread(&existing, 1, 1, flash_file) != 1) {
+            return FLASH_STATUS_ERROR;
+        }
+        existing &= src[i];
+        fseek(flash_file, addr + i, SEEK_SET);
+        if (fwrite(&existing, 1, 1, flash_file) != 1) {
+            return FLASH_STATUS_ERROR;
+        }
+    }
+    return FLASH_STATUS_SUCCESS;
+}
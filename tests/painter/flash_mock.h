@@ -0,0 +1,24 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#ifndef MOCK_FLASH_SIZE
+#    define MOCK_FLASH_SIZE (256 * 1024)
+#endif
+#ifndef MOCK_FLASH_BLOCK_SIZE
+#    define MOCK_FLASH_BLOCK_SIZE (64 * 1024)
+#endif
+#ifndef MOCK_FLASH_SECTOR_SIZE
+#    define MOCK_FLASH_SECTOR_SIZE (4 * 1024)
+#endif
+
+typedef struct flash_mock_stats_t {
+    uint32_t read_transactions;
+    uint32_t read_bytes;
+} flash_mock_stats_t;
+
+// Counters for the number of flash transactions issued, reset by flash_init().
+extern flash_mock_stats_t flash_mock_stats;
@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Minimal QGF writer, producing 1bpp grayscale frames.
+class QgfBuilder {
+   public:
+    QgfBuilder(uint16_t width, uint16_t height, uint16_t delay) : width(width), height(height), delay(delay) {}
+
+    struct Rect {
+        uint16_t l, t, r, b;
+    };
+
+    void add_full_frame(const std::vector<uint8_t>& data, uint8_t compression = 0x00) {
+        std::vector<uint8_t> frame;
+        append_frame_descriptor(frame, 0x00, compression);
+        append_block(frame, 0x05, data);
+        frames.push_back(frame);
+    }
+
+    void add_delta_frame(const std::vector<Rect>& rects, const std::vector<std::vector<uint8_t>>& data) {
+        std::vector<uint8_t> frame;
+        append_frame_descriptor(frame, 0x02, 0x00);
+        std::vector<uint8_t> delta;
+        for (auto& rect : rects) {
+            for (uint16_t v : {rect.l, rect.t, rect.r, rect.b}) {
+                append_u16(delta, v);
+            }
+        }
+        append_block(frame, 0x04, delta);
+        for (auto& d : data) {
+            append_block(frame, 0x05, d);
+        }
+        frames.push_back(frame);
+    }
+
+    std::vector<uint8_t> build() const {
+        const uint32_t graphics_descriptor_size = 5 + 18;
+        const uint32_t frame_offsets_size       = 5 + 4 * frames.size();
+
+        std::vector<uint32_t> offsets;
+        uint32_t              total = graphics_descriptor_size + frame_offsets_size;
+        for (auto& frame : frames) {
+            offsets.push_back(total);
+            total += frame.size();
+        }
+
+        std::vector<uint8_t> graphics_descriptor = {0x51, 0x47, 0x46, 0x01};
+        append_u32(graphics_descriptor, total);
+        append_u32(graphics_descriptor, ~total);
+        append_u16(graphics_descriptor, width);
+        append_u16(graphics_descriptor, height);
+        append_u16(graphics_descriptor, frames.size());
+
+        std::vector<uint8_t> frame_offsets;
+        for (auto offset : offsets) {
+            append_u32(frame_offsets, offset);
+        }
+
+        std::vector<uint8_t> out;
+        append_block(out, 0x00, graphics_descriptor);
+        append_block(out, 0x01, frame_offsets);
+        for (auto& frame : frames) {
+            out.insert(out.end(), frame.begin(), frame.end());
+        }
+        return out;
+    }
+
+    static void append_u16(std::vector<uint8_t>& v, uint16_t x) {
+        v.push_back(x & 0xFF);
+        v.push_back(x >> 8);
+    }
+
+    static void append_u32(std::vector<uint8_t>& v, uint32_t x) {
+        append_u16(v, x & 0xFFFF);
+        append_u16(v, x >> 16);
+    }
+
+    static void append_block(std::vector<uint8_t>& v, uint8_t type_id, const std::vector<uint8_t>& payload) {
+        v.push_back(type_id);
+        v.push_back(~type_id & 0xFF);
+        v.push_back(payload.size() & 0xFF);
+        v.push_back((payload.size() >> 8) & 0xFF);
+        v.push_back((payload.size() >> 16) & 0xFF);
+        v.insert(v.end(), payload.begin(), payload.end());
+    }
+
+   private:
+    uint16_t                          width;
+    uint16_t                          height;
+    uint16_t                          delay;
+    std::vector<std::vector<uint8_t>> frames;
+
+    void append_frame_descriptor(std::vector<uint8_t>& v, uint8_t flags, uint8_t compression) {
+        std::vector<uint8_t> descriptor = {0x00, flags, compression, 0xFF};
+        append_u16(descriptor, delay);
+        append_block(v, 0x02, descriptor);
+    }
+};
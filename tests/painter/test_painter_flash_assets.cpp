@@ -0,0 +1,217 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+#include "qgf_builder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+#include "qp_asset_store.h"
+#include "flash.h"
+#include "flash_mock.h"
+}
+
+namespace {
+
+constexpr uint16_t SURFACE_SIZE = 32;
+
+constexpr uint16_t BLACK = 0x0000;
+constexpr uint16_t WHITE = 0xFFFF;
+
+using Asset = std::pair<std::string, std::vector<uint8_t>>;
+
+// Asset store writer, matching the layout produced by `qmk painter-make-asset-store`.
+std::vector<uint8_t> build_asset_store(std::vector<Asset> assets, uint8_t name_length = 16) {
+    std::sort(assets.begin(), assets.end());
+
+    std::vector<uint8_t> out = {0x51, 0x50, 0x41, 0x01};
+    QgfBuilder::append_u16(out, assets.size());
+    out.push_back(name_length);
+    out.push_back(0x00);
+
+    uint32_t offset = out.size() + assets.size() * (name_length + 8);
+    for (auto& asset : assets) {
+        std::string name = asset.first;
+        name.resize(name_length, '\0');
+        out.insert(out.end(), name.begin(), name.end());
+        QgfBuilder::append_u32(out, offset);
+        QgfBuilder::append_u32(out, asset.second.size());
+        offset += asset.second.size();
+    }
+    for (auto& asset : assets) {
+        out.insert(out.end(), asset.second.begin(), asset.second.end());
+    }
+    return out;
+}
+
+// Minimal QFF writer, producing a 1bpp grayscale font with 2x4 ASCII glyphs -- one byte per glyph.
+std::vector<uint8_t> build_font(const std::vector<uint8_t>& glyphs) {
+    const uint32_t total = (5 + 20) + (5 + 95 * 3) + (5 + 95);
+
+    std::vector<uint8_t> font_descriptor = {0x51, 0x46, 0x46, 0x01};
+    QgfBuilder::append_u32(font_descriptor, total);
+    QgfBuilder::append_u32(font_descriptor, ~total);
+    font_descriptor.insert(font_descriptor.end(), {4 /* line height */, 1 /* has ascii */, 0, 0 /* no unicode */, 0x00 /* GRAYSCALE_1BPP */, 0x00, 0x00, 0xFF});
+
+    std::vector<uint8_t> ascii_table;
+    for (uint32_t i = 0; i < 95; ++i) {
+        uint32_t value = (i << 6) | 2;
+        ascii_table.insert(ascii_table.end(), {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16)});
+    }
+
+    std::vector<uint8_t> data(95, 0x00);
+    std::copy(glyphs.begin(), glyphs.end(), data.begin() + ('A' - 0x20));
+
+    std::vector<uint8_t> out;
+    QgfBuilder::append_block(out, 0x00, font_descriptor);
+    QgfBuilder::append_block(out, 0x01, ascii_table);
+    QgfBuilder::append_block(out, 0x04, data);
+    return out;
+}
+
+// Produces a 1bpp image with a distinct, non-repeating bit pattern.
+std::vector<uint8_t> build_image(uint16_t width, uint16_t height, uint8_t seed) {
+    std::vector<uint8_t> data((width * height + 7) / 8);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = (uint8_t)(i * 37 + seed);
+    }
+    QgfBuilder builder(width, height, 0);
+    builder.add_full_frame(data);
+    return builder.build();
+}
+
+class PainterFlashAssets : public TestFixture {
+   public:
+    void SetUp() override {
+        static uint8_t          framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_SIZE, SURFACE_SIZE, 16)];
+        static painter_device_t surface = nullptr;
+        if (!surface) {
+            surface = qp_make_rgb565_surface(SURFACE_SIZE, SURFACE_SIZE, framebuffer);
+        }
+        device = surface;
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0));
+        ASSERT_TRUE(qp_rect(device, 0, 0, SURFACE_SIZE - 1, SURFACE_SIZE - 1, 0, 0, 0, true));
+
+        flash_init();
+        qp_flash_stream_invalidate_cache();
+    }
+
+    void program(uint32_t address, const std::vector<uint8_t>& data) {
+        ASSERT_EQ(flash_write_range(address, data.data(), data.size()), FLASH_STATUS_SUCCESS);
+    }
+
+    uint16_t pixel(uint16_t x, uint16_t y) {
+        return ((surface_painter_device_t*)device)->u16buffer[y * SURFACE_SIZE + x];
+    }
+
+    // Checks the surface against a 1bpp image drawn at the origin, LSB-first.
+    void expect_image(const std::vector<uint8_t>& data, uint16_t width, uint16_t height) {
+        for (uint16_t y = 0; y < height; ++y) {
+            for (uint16_t x = 0; x < width; ++x) {
+                uint32_t i   = y * width + x;
+                bool     set = (data[i / 8] >> (i % 8)) & 1;
+                EXPECT_EQ(pixel(x, y), set ? WHITE : BLACK) << "x=" << x << ", y=" << y;
+            }
+        }
+    }
+
+    painter_device_t device;
+};
+
+TEST_F(PainterFlashAssets, LoadsImageByName) {
+    auto small = build_image(8, 4, 1);
+    auto large = build_image(32, 32, 2);
+    program(QUANTUM_PAINTER_ASSET_STORE_ADDRESS, build_asset_store({{"small", small}, {"large", large}, {"another", small}}));
+
+    painter_image_handle_t image = qp_load_image_asset("large");
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->width, 32);
+    EXPECT_EQ(image->height, 32);
+    EXPECT_TRUE(qp_drawimage(device, 0, 0, image));
+    expect_image(std::vector<uint8_t>(large.end() - 128, large.end()), 32, 32);
+    EXPECT_TRUE(qp_close_image(image));
+
+    EXPECT_EQ(qp_load_image_asset("missing"), nullptr);
+    EXPECT_EQ(qp_load_image_asset("smal"), nullptr);
+}
+
+TEST_F(PainterFlashAssets, ReadAheadBatchesFlashTransactions) {
+    auto     data    = build_image(32, 32, 3);
+    uint32_t address = 0x2000;
+    program(address, data);
+
+    flash_mock_stats = {};
+    painter_image_handle_t image = qp_load_image_flash(address);
+    ASSERT_NE(image, nullptr);
+    EXPECT_TRUE(qp_drawimage(device, 0, 0, image));
+    expect_image(std::vector<uint8_t>(data.end() - 128, data.end()), 32, 32);
+    EXPECT_TRUE(qp_close_image(image));
+
+    // Everything is read in whole blocks, and the blocks are only ever fetched once
+    uint32_t blocks = (data.size() + QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE - 1) / QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE;
+    EXPECT_LE(flash_mock_stats.read_transactions, blocks);
+    EXPECT_EQ(flash_mock_stats.read_bytes, flash_mock_stats.read_transactions * QUANTUM_PAINTER_FLASH_CACHE_BLOCK_SIZE);
+}
+
+TEST_F(PainterFlashAssets, LoadsFontByName) {
+    // 'A' is the top half lit, 'B' is the left column lit
+    program(QUANTUM_PAINTER_ASSET_STORE_ADDRESS, build_asset_store({{"font", build_font({0x0F, 0x55})}, {"image", build_image(8, 4, 4)}}));
+
+    painter_font_handle_t font = qp_load_font_asset("font");
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(font->line_height, 4);
+    EXPECT_EQ(qp_textwidth(font, "AB"), 4);
+    EXPECT_EQ(qp_drawtext(device, 0, 0, font, "AB"), 4);
+    expect_image({0x77, 0x44}, 4, 4);
+    EXPECT_TRUE(qp_close_font(font));
+}
+
+TEST_F(PainterFlashAssets, IndexMatchesWholeNames) {
+    auto a = build_image(8, 4, 5);
+    auto b = build_image(8, 4, 6);
+    program(QUANTUM_PAINTER_ASSET_STORE_ADDRESS, build_asset_store({{"exactly8", a}, {"exact", b}}, 8));
+
+    uint32_t address, length;
+    ASSERT_TRUE(qp_asset_store_find(QUANTUM_PAINTER_ASSET_STORE_ADDRESS, "exactly8", &address, &length));
+    EXPECT_EQ(length, a.size());
+    ASSERT_TRUE(qp_asset_store_find(QUANTUM_PAINTER_ASSET_STORE_ADDRESS, "exact", &address, &length));
+    EXPECT_EQ(length, b.size());
+    EXPECT_FALSE(qp_asset_store_find(QUANTUM_PAINTER_ASSET_STORE_ADDRESS, "exactly8x", &address, &length));
+    EXPECT_FALSE(qp_asset_store_find(QUANTUM_PAINTER_ASSET_STORE_ADDRESS, "exac", &address, &length));
+
+    // Erased flash isn't an asset store
+    EXPECT_FALSE(qp_asset_store_find(QUANTUM_PAINTER_ASSET_STORE_ADDRESS + 0x10000, "exact", &address, &length));
+}
+
+TEST_F(PainterFlashAssets, ReloadsAfterFlashRewrite) {
+    auto     first   = build_image(8, 4, 7);
+    auto     second  = build_image(8, 4, 8);
+    uint32_t address = 0x3000;
+
+    program(address, first);
+    painter_image_handle_t image = qp_load_image_flash(address);
+    ASSERT_NE(image, nullptr);
+    EXPECT_TRUE(qp_drawimage(device, 0, 0, image));
+    expect_image(std::vector<uint8_t>(first.end() - 4, first.end()), 8, 4);
+    EXPECT_TRUE(qp_close_image(image));
+
+    ASSERT_EQ(flash_erase_sector(address), FLASH_STATUS_SUCCESS);
+    program(address, second);
+    qp_flash_stream_invalidate_cache();
+
+    image = qp_load_image_flash(address);
+    ASSERT_NE(image, nullptr);
+    EXPECT_TRUE(qp_drawimage(device, 0, 0, image));
+    expect_image(std::vector<uint8_t>(second.end() - 4, second.end()), 8, 4);
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+} // namespace
@@ -0,0 +1,296 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdio>
+#include <set>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+}
+
+namespace {
+
+constexpr uint16_t PANEL_SIZE = 64;
+constexpr uint16_t CENTER     = 32;
+
+constexpr uint16_t BLACK = 0x0000;
+constexpr uint16_t WHITE = 0xFFFF;
+
+using PixelSet = std::set<std::pair<int, int>>;
+
+// Counts the commands sent to the surface -- on a real panel, each viewport and pixdata call is a separate bus transaction.
+static uint32_t                        viewport_calls = 0;
+static uint32_t                        pixdata_calls  = 0;
+static surface_painter_driver_vtable_t counting_vtable;
+static bool (*surface_viewport)(painter_device_t, uint16_t, uint16_t, uint16_t, uint16_t);
+static bool (*surface_pixdata)(painter_device_t, const void*, uint32_t);
+
+static bool counting_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    ++viewport_calls;
+    return surface_viewport(device, left, top, right, bottom);
+}
+
+static bool counting_pixdata(painter_device_t device, const void* pixel_data, uint32_t native_pixel_count) {
+    ++pixdata_calls;
+    return surface_pixdata(device, pixel_data, native_pixel_count);
+}
+
+// Reference implementations of the previous per-pixel algorithms, used to ensure the span-based versions draw the same pixels.
+PixelSet reference_line(int x0, int y0, int x1, int y1) {
+    PixelSet pixels;
+    int      x = x0, y = y0;
+    int      slopex = x0 < x1 ? 1 : -1, slopey = y0 < y1 ? 1 : -1;
+    int      dx = abs(x1 - x0), dy = -abs(y1 - y0);
+    int      e = dx + dy;
+    while (x != x1 || y != y1) {
+        pixels.insert({x, y});
+        int e2 = 2 * e;
+        if (e2 >= dy) {
+            e += dy;
+            x += slopex;
+        }
+        if (e2 <= dx) {
+            e += dx;
+            y += slopey;
+        }
+    }
+    pixels.insert({x, y});
+    return pixels;
+}
+
+void insert_row(PixelSet& pixels, int l, int r, int y) {
+    for (int x = std::min(l, r); x <= std::max(l, r); ++x) {
+        pixels.insert({x, y});
+    }
+}
+
+PixelSet reference_circle(int cx, int cy, int radius, bool filled) {
+    PixelSet pixels;
+    auto     plot = [&](int ox, int oy) {
+        if (filled) {
+            insert_row(pixels, cx - ox, cx + ox, cy + oy);
+            insert_row(pixels, cx - ox, cx + ox, cy - oy);
+            insert_row(pixels, cx - oy, cx + oy, cy + ox);
+            insert_row(pixels, cx - oy, cx + oy, cy - ox);
+        } else {
+            for (auto p : {std::make_pair(ox, oy), std::make_pair(oy, ox)}) {
+                pixels.insert({cx + p.first, cy + p.second});
+                pixels.insert({cx - p.first, cy + p.second});
+                pixels.insert({cx + p.first, cy - p.second});
+                pixels.insert({cx - p.first, cy - p.second});
+            }
+        }
+    };
+    int x = 0, y = radius, err = ((5 - (radius >> 2)) >> 2);
+    plot(x, y);
+    while (x < y) {
+        x++;
+        if (err < 0) {
+            err += (x << 1) + 1;
+        } else {
+            y--;
+            err += ((x - y) << 1) + 1;
+        }
+        plot(x, y);
+    }
+    return pixels;
+}
+
+PixelSet reference_ellipse(int cx, int cy, int sizex, int sizey, bool filled) {
+    PixelSet pixels;
+    auto     plot = [&](int ox, int oy) {
+        if (filled) {
+            insert_row(pixels, cx - ox, cx + ox, cy + oy);
+            insert_row(pixels, cx - ox, cx + ox, cy - oy);
+        } else {
+            pixels.insert({cx + ox, cy + oy});
+            pixels.insert({cx - ox, cy + oy});
+            pixels.insert({cx + ox, cy - oy});
+            pixels.insert({cx - ox, cy - oy});
+        }
+    };
+    int32_t aa = sizex * sizex, bb = sizey * sizey, fa = 4 * aa, fb = 4 * bb;
+    int     dx = 0, dy = sizey;
+    for (int32_t delta = (2 * bb) + (aa * (1 - (2 * sizey))); bb * dx <= aa * dy; dx++) {
+        plot(dx, dy);
+        if (delta >= 0) {
+            delta += fa * (1 - dy);
+            dy--;
+        }
+        delta += bb * (4 * dx + 6);
+    }
+    dx = sizex;
+    dy = 0;
+    for (int32_t delta = (2 * aa) + (bb * (1 - (2 * sizex))); aa * dy <= bb * dx; dy++) {
+        plot(dx, dy);
+        if (delta >= 0) {
+            delta += fb * (1 - dx);
+            dx--;
+        }
+        delta += aa * (4 * dy + 6);
+    }
+    return pixels;
+}
+
+class PainterPrimitives : public TestFixture {
+   public:
+    void SetUp() override {
+        static uint8_t          framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_SIZE, PANEL_SIZE, 16)];
+        static painter_device_t surface = nullptr;
+        if (!surface) {
+            surface = qp_make_rgb565_surface(PANEL_SIZE, PANEL_SIZE, framebuffer);
+
+            painter_driver_t* driver      = (painter_driver_t*)surface;
+            counting_vtable               = *(const surface_painter_driver_vtable_t*)driver->driver_vtable;
+            surface_viewport              = counting_vtable.base.viewport;
+            surface_pixdata               = counting_vtable.base.pixdata;
+            counting_vtable.base.viewport = counting_viewport;
+            counting_vtable.base.pixdata  = counting_pixdata;
+            driver->driver_vtable         = (const painter_driver_vtable_t*)&counting_vtable;
+        }
+        device = surface;
+        ASSERT_NE(device, nullptr);
+        reset();
+    }
+
+    void reset() {
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0));
+        viewport_calls = 0;
+        pixdata_calls  = 0;
+    }
+
+    uint16_t pixel(int x, int y) {
+        return ((surface_painter_device_t*)device)->u16buffer[y * PANEL_SIZE + x];
+    }
+
+    PixelSet drawn_pixels() {
+        PixelSet pixels;
+        for (int y = 0; y < PANEL_SIZE; ++y) {
+            for (int x = 0; x < PANEL_SIZE; ++x) {
+                if (pixel(x, y) != BLACK) {
+                    pixels.insert({x, y});
+                }
+            }
+        }
+        return pixels;
+    }
+
+    uint32_t transactions() const {
+        return viewport_calls + pixdata_calls;
+    }
+
+    painter_device_t device;
+};
+
+TEST_F(PainterPrimitives, LinesMatchPerPixelRendering) {
+    const int endpoints[][4] = {{2, 3, 60, 20}, {60, 20, 2, 3}, {5, 60, 12, 1}, {40, 2, 30, 61}, {0, 0, 63, 63}, {63, 0, 0, 63}, {10, 10, 11, 50}, {1, 30, 62, 31}};
+    for (auto& e : endpoints) {
+        reset();
+        EXPECT_TRUE(qp_line(device, e[0], e[1], e[2], e[3], 0, 0, 255));
+        EXPECT_EQ(drawn_pixels(), reference_line(e[0], e[1], e[2], e[3])) << e[0] << "," << e[1] << " -> " << e[2] << "," << e[3];
+    }
+}
+
+TEST_F(PainterPrimitives, CirclesMatchPerPixelRendering) {
+    for (int radius = 0; radius < 31; ++radius) {
+        for (bool filled : {false, true}) {
+            reset();
+            EXPECT_TRUE(qp_circle(device, CENTER, CENTER, radius, 0, 0, 255, filled));
+            EXPECT_EQ(drawn_pixels(), reference_circle(CENTER, CENTER, radius, filled)) << "radius=" << radius << ", filled=" << filled;
+        }
+    }
+}
+
+TEST_F(PainterPrimitives, EllipsesMatchPerPixelRendering) {
+    const int sizes[][2] = {{1, 1}, {2, 1}, {1, 2}, {30, 10}, {10, 30}, {25, 24}, {30, 1}, {1, 30}, {17, 5}};
+    for (auto& size : sizes) {
+        for (bool filled : {false, true}) {
+            reset();
+            EXPECT_TRUE(qp_ellipse(device, CENTER, CENTER, size[0], size[1], 0, 0, 255, filled));
+            EXPECT_EQ(drawn_pixels(), reference_ellipse(CENTER, CENTER, size[0], size[1], filled)) << "size=" << size[0] << "x" << size[1] << ", filled=" << filled;
+        }
+    }
+}
+
+TEST_F(PainterPrimitives, AntiAliasedLineBlendsAdjacentPixels) {
+    EXPECT_TRUE(qp_line_aa(device, 2, 10, 61, 30, 0, 0, 255, 0, 0, 0));
+
+    // Endpoints are exact, so they're full intensity
+    EXPECT_EQ(pixel(2, 10), WHITE);
+    EXPECT_EQ(pixel(61, 30), WHITE);
+
+    // Each column has one or two pixels, with a single pair of transactions
+    for (int x = 2; x <= 61; ++x) {
+        int count = 0;
+        for (int y = 0; y < PANEL_SIZE; ++y) {
+            count += pixel(x, y) != BLACK ? 1 : 0;
+        }
+        EXPECT_GE(count, 1) << "x=" << x;
+        EXPECT_LE(count, 2) << "x=" << x;
+    }
+    EXPECT_EQ(viewport_calls, 60);
+    EXPECT_EQ(pixdata_calls, 60);
+
+    // At least some pixels are partially covered
+    bool has_partial = false;
+    for (auto& p : drawn_pixels()) {
+        has_partial |= pixel(p.first, p.second) != WHITE;
+    }
+    EXPECT_TRUE(has_partial);
+}
+
+TEST_F(PainterPrimitives, AntiAliasedCircleIsSymmetrical) {
+    EXPECT_TRUE(qp_circle_aa(device, CENTER, CENTER, 20, 0, 0, 255, 0, 0, 0));
+
+    EXPECT_EQ(pixel(CENTER, CENTER + 20), WHITE);
+    EXPECT_EQ(pixel(CENTER, CENTER - 20), WHITE);
+    EXPECT_EQ(pixel(CENTER + 20, CENTER), WHITE);
+    EXPECT_EQ(pixel(CENTER - 20, CENTER), WHITE);
+    EXPECT_EQ(pixel(CENTER, CENTER), BLACK);
+
+    for (int y = 0; y < PANEL_SIZE; ++y) {
+        for (int x = 1; x < PANEL_SIZE; ++x) {
+            EXPECT_EQ(pixel(x, y), pixel(2 * CENTER - x, y)) << "x=" << x << ", y=" << y;
+            EXPECT_EQ(pixel(x, y), pixel(y, x)) << "x=" << x << ", y=" << y;
+        }
+    }
+}
+
+TEST_F(PainterPrimitives, TransactionCounts) {
+    struct Benchmark {
+        const char* name;
+        bool (*draw)(painter_device_t);
+        PixelSet (*reference)();
+    };
+
+    // Previously, every pixel not drawn as part of a horizontal line was sent with its own viewport and pixdata
+    const Benchmark benchmarks[] = {
+        {"line (shallow)", [](painter_device_t d) { return qp_line(d, 0, 10, 63, 30, 0, 0, 255); }, []() { return reference_line(0, 10, 63, 30); }},
+        {"line (steep)", [](painter_device_t d) { return qp_line(d, 10, 0, 30, 63, 0, 0, 255); }, []() { return reference_line(10, 0, 30, 63); }},
+        {"circle r=30", [](painter_device_t d) { return qp_circle(d, CENTER, CENTER, 30, 0, 0, 255, false); }, []() { return reference_circle(CENTER, CENTER, 30, false); }},
+        {"ellipse 30x15", [](painter_device_t d) { return qp_ellipse(d, CENTER, CENTER, 30, 15, 0, 0, 255, false); }, []() { return reference_ellipse(CENTER, CENTER, 30, 15, false); }},
+    };
+
+    printf("%-16s %8s %14s\n", "primitive", "pixels", "transactions");
+    for (auto& benchmark : benchmarks) {
+        reset();
+        EXPECT_TRUE(benchmark.draw(device));
+        uint32_t per_pixel = 2 * benchmark.reference().size();
+        printf("%-16s %8u %14u\n", benchmark.name, (unsigned)benchmark.reference().size(), (unsigned)transactions());
+        EXPECT_LT(transactions() * 2, per_pixel) << benchmark.name;
+    }
+
+    // Filled shapes send each row once, rather than redrawing overlapping rows
+    reset();
+    EXPECT_TRUE(qp_circle(device, CENTER, CENTER, 30, 0, 0, 255, true));
+    printf("%-16s %8u %14u\n", "circle r=30 fill", (unsigned)drawn_pixels().size(), (unsigned)transactions());
+    EXPECT_LE(viewport_calls, 2 * 30 + 1);
+}
+
+} // namespace
@@ -0,0 +1,146 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+#include "qgf_builder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+
+void advance_time(uint32_t ms);
+void qp_internal_task(void);
+}
+
+namespace {
+
+constexpr uint16_t IMAGE_WIDTH  = 8;
+constexpr uint16_t IMAGE_HEIGHT = 4;
+constexpr uint16_t FRAME_DELAY  = 50;
+
+constexpr uint16_t BLACK = 0x0000;
+constexpr uint16_t WHITE = 0xFFFF;
+
+// Wraps the surface's viewport call so that the number of regions sent to the "panel" can be counted.
+static uint32_t                        viewport_calls = 0;
+static surface_painter_driver_vtable_t counting_vtable;
+static bool (*surface_viewport)(painter_device_t, uint16_t, uint16_t, uint16_t, uint16_t);
+
+static bool counting_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    ++viewport_calls;
+    return surface_viewport(device, left, top, right, bottom);
+}
+
+class PainterQGF : public TestFixture {
+   public:
+    void SetUp() override {
+        static uint8_t          framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(IMAGE_WIDTH, IMAGE_HEIGHT, 16)];
+        static painter_device_t surface = nullptr;
+        if (!surface) {
+            surface = qp_make_rgb565_surface(IMAGE_WIDTH, IMAGE_HEIGHT, framebuffer);
+
+            painter_driver_t* driver      = (painter_driver_t*)surface;
+            counting_vtable               = *(const surface_painter_driver_vtable_t*)driver->driver_vtable;
+            surface_viewport              = counting_vtable.base.viewport;
+            counting_vtable.base.viewport = counting_viewport;
+            driver->driver_vtable         = (const painter_driver_vtable_t*)&counting_vtable;
+        }
+        device = surface;
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0));
+        ASSERT_TRUE(qp_rect(device, 0, 0, IMAGE_WIDTH - 1, IMAGE_HEIGHT - 1, 0, 0, 255, true));
+        viewport_calls = 0;
+    }
+
+    uint16_t pixel(uint16_t x, uint16_t y) {
+        return ((surface_painter_device_t*)device)->u16buffer[y * IMAGE_WIDTH + x];
+    }
+
+    void advance_animation() {
+        advance_time(FRAME_DELAY);
+        qp_internal_task();
+    }
+
+    painter_device_t device;
+};
+
+TEST_F(PainterQGF, DrawsFullFrame) {
+    QgfBuilder builder(IMAGE_WIDTH, IMAGE_HEIGHT, FRAME_DELAY);
+    builder.add_full_frame({0x0F, 0xF0, 0x00, 0xFF});
+    auto data = builder.build();
+
+    painter_image_handle_t image = qp_load_image_mem(data.data());
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->width, IMAGE_WIDTH);
+    EXPECT_EQ(image->height, IMAGE_HEIGHT);
+
+    EXPECT_TRUE(qp_drawimage(device, 0, 0, image));
+    EXPECT_EQ(viewport_calls, 1);
+    for (uint16_t x = 0; x < IMAGE_WIDTH; ++x) {
+        EXPECT_EQ(pixel(x, 0), x < 4 ? WHITE : BLACK);
+        EXPECT_EQ(pixel(x, 1), x < 4 ? BLACK : WHITE);
+        EXPECT_EQ(pixel(x, 2), BLACK);
+        EXPECT_EQ(pixel(x, 3), WHITE);
+    }
+
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+TEST_F(PainterQGF, DeltaFramesOnlyDrawChangedRegions) {
+    QgfBuilder builder(IMAGE_WIDTH, IMAGE_HEIGHT, FRAME_DELAY);
+    builder.add_full_frame({0x04, 0x00}, 0x01 /* RLE: 4x 0x00 */);
+    builder.add_delta_frame({{1, 0, 2, 1}, {5, 3, 7, 3}}, {{0x0F}, {0x05}});
+    builder.add_delta_frame({}, {});
+    auto data = builder.build();
+
+    painter_image_handle_t image = qp_load_image_mem(data.data());
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->frame_count, 3);
+
+    // First frame is drawn immediately, as a whole
+    deferred_token token = qp_animate(device, 0, 0, image);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(viewport_calls, 1);
+    for (uint16_t y = 0; y < IMAGE_HEIGHT; ++y) {
+        for (uint16_t x = 0; x < IMAGE_WIDTH; ++x) {
+            EXPECT_EQ(pixel(x, y), BLACK);
+        }
+    }
+
+    // Second frame only touches its two regions, everything else is left as-is
+    viewport_calls = 0;
+    advance_animation();
+    EXPECT_EQ(viewport_calls, 2);
+    for (uint16_t y = 0; y < IMAGE_HEIGHT; ++y) {
+        for (uint16_t x = 0; x < IMAGE_WIDTH; ++x) {
+            bool in_first  = x >= 1 && x <= 2 && y <= 1;
+            bool in_second = y == 3 && (x == 5 || x == 7);
+            EXPECT_EQ(pixel(x, y), (in_first || in_second) ? WHITE : BLACK) << "x=" << x << ", y=" << y;
+        }
+    }
+
+    // Third frame is unchanged, so nothing gets sent at all
+    viewport_calls = 0;
+    advance_animation();
+    EXPECT_EQ(viewport_calls, 0);
+    EXPECT_EQ(pixel(1, 0), WHITE);
+    EXPECT_EQ(pixel(6, 3), BLACK);
+
+    qp_stop_animation(token);
+    EXPECT_TRUE(qp_close_image(image));
+}
+
+TEST_F(PainterQGF, RejectsMalformedDeltaBlock) {
+    QgfBuilder builder(IMAGE_WIDTH, IMAGE_HEIGHT, FRAME_DELAY);
+    builder.add_full_frame({0x00, 0x00, 0x00, 0x00});
+    builder.add_delta_frame({{1, 0, 2, 1}}, {});
+    auto data = builder.build();
+
+    // Missing the data block corresponding to the delta region
+    EXPECT_EQ(qp_load_image_mem(data.data()), nullptr);
+}
+
+} // namespace
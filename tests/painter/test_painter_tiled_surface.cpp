@@ -0,0 +1,146 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+}
+
+namespace {
+
+constexpr uint16_t PANEL_WIDTH  = 24;
+constexpr uint16_t PANEL_HEIGHT = 20;
+constexpr uint16_t BAND_HEIGHT  = 8; // last band is partial
+constexpr uint16_t BAND_COUNT   = (PANEL_HEIGHT + BAND_HEIGHT - 1) / BAND_HEIGHT;
+
+// Counts the regions sent to the target surface.
+static uint32_t                        viewport_calls = 0;
+static surface_painter_driver_vtable_t counting_vtable;
+static bool (*surface_viewport)(painter_device_t, uint16_t, uint16_t, uint16_t, uint16_t);
+
+static bool counting_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    ++viewport_calls;
+    return surface_viewport(device, left, top, right, bottom);
+}
+
+class PainterTiledSurface : public TestFixture {
+   public:
+    void SetUp() override {
+        static uint8_t          reference_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+        static uint8_t          target_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, PANEL_HEIGHT, 16)];
+        static uint8_t          band_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(PANEL_WIDTH, BAND_HEIGHT, 16)];
+        static painter_device_t reference_surface = nullptr;
+        static painter_device_t target_surface    = nullptr;
+        static painter_device_t tiled_surface     = nullptr;
+        if (!tiled_surface) {
+            reference_surface = qp_make_rgb565_surface(PANEL_WIDTH, PANEL_HEIGHT, reference_buffer);
+            target_surface    = qp_make_rgb565_surface(PANEL_WIDTH, PANEL_HEIGHT, target_buffer);
+            tiled_surface     = qp_make_rgb565_tiled_surface(PANEL_WIDTH, PANEL_HEIGHT, BAND_HEIGHT, band_buffer);
+
+            painter_driver_t* driver      = (painter_driver_t*)target_surface;
+            counting_vtable               = *(const surface_painter_driver_vtable_t*)driver->driver_vtable;
+            surface_viewport              = counting_vtable.base.viewport;
+            counting_vtable.base.viewport = counting_viewport;
+            driver->driver_vtable         = (const painter_driver_vtable_t*)&counting_vtable;
+        }
+        reference = reference_surface;
+        target    = target_surface;
+        tiled     = tiled_surface;
+        ASSERT_NE(reference, nullptr);
+        ASSERT_NE(target, nullptr);
+        ASSERT_NE(tiled, nullptr);
+        ASSERT_TRUE(qp_init(reference, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(target, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(tiled, QP_ROTATION_0));
+        viewport_calls = 0;
+    }
+
+    // Draws the same scene directly onto the reference surface, and into the tiled surface's display list.
+    void draw_scene(uint8_t circle_hue) {
+        ASSERT_TRUE(qp_rect(reference, 2, 2, 21, 17, 0, 255, 255, true));
+        ASSERT_TRUE(qp_line(reference, 0, 0, 23, 19, 85, 255, 255));
+        ASSERT_TRUE(qp_circle(reference, 12, 3, 3, circle_hue, 255, 255, true));
+        ASSERT_TRUE(qp_rect(reference, 18, 15, 23, 19, 0, 0, 255, false));
+
+        ASSERT_TRUE(qp_tiled_surface_reset(tiled));
+        ASSERT_TRUE(qp_tiled_surface_rect(tiled, 2, 2, 21, 17, 0, 255, 255, true));
+        ASSERT_TRUE(qp_tiled_surface_line(tiled, 0, 0, 23, 19, 85, 255, 255));
+        ASSERT_TRUE(qp_tiled_surface_circle(tiled, 12, 3, 3, circle_hue, 255, 255, true));
+        ASSERT_TRUE(qp_tiled_surface_rect(tiled, 18, 15, 23, 19, 0, 0, 255, false));
+    }
+
+    void expect_target_matches_reference() {
+        const uint16_t* expected = ((surface_painter_device_t*)reference)->u16buffer;
+        const uint16_t* actual   = ((surface_painter_device_t*)target)->u16buffer;
+        for (uint16_t y = 0; y < PANEL_HEIGHT; ++y) {
+            for (uint16_t x = 0; x < PANEL_WIDTH; ++x) {
+                EXPECT_EQ(actual[y * PANEL_WIDTH + x], expected[y * PANEL_WIDTH + x]) << "x=" << x << ", y=" << y;
+            }
+        }
+    }
+
+    painter_device_t reference;
+    painter_device_t target;
+    painter_device_t tiled;
+};
+
+TEST_F(PainterTiledSurface, MatchesDirectRendering) {
+    draw_scene(170);
+    EXPECT_TRUE(qp_tiled_surface_draw(tiled, target, 0, 0, false));
+    EXPECT_EQ(viewport_calls, BAND_COUNT);
+    expect_target_matches_reference();
+}
+
+TEST_F(PainterTiledSurface, SkipsUnchangedBands) {
+    draw_scene(170);
+    EXPECT_TRUE(qp_tiled_surface_draw(tiled, target, 0, 0, false));
+
+    // Same scene again, nothing needs to be sent
+    viewport_calls = 0;
+    draw_scene(170);
+    EXPECT_TRUE(qp_tiled_surface_draw(tiled, target, 0, 0, false));
+    EXPECT_EQ(viewport_calls, 0);
+
+    // Recolouring the circle only affects the first band
+    viewport_calls = 0;
+    draw_scene(43);
+    EXPECT_TRUE(qp_tiled_surface_draw(tiled, target, 0, 0, false));
+    EXPECT_EQ(viewport_calls, 1);
+    expect_target_matches_reference();
+
+    // Forcing a full redraw sends every band
+    viewport_calls = 0;
+    EXPECT_TRUE(qp_tiled_surface_draw(tiled, target, 0, 0, true));
+    EXPECT_EQ(viewport_calls, BAND_COUNT);
+    expect_target_matches_reference();
+}
+
+TEST_F(PainterTiledSurface, LaterOperationsAreLayeredOnTop) {
+    ASSERT_TRUE(qp_tiled_surface_rect(tiled, 0, 0, PANEL_WIDTH - 1, PANEL_HEIGHT - 1, 0, 255, 255, true));
+    ASSERT_TRUE(qp_tiled_surface_rect(tiled, 4, 6, 9, 10, 0, 0, 255, true));
+    EXPECT_TRUE(qp_tiled_surface_draw(tiled, target, 0, 0, false));
+
+    const uint16_t* actual = ((surface_painter_device_t*)target)->u16buffer;
+    EXPECT_EQ(actual[8 * PANEL_WIDTH + 5], 0xFFFF);
+    EXPECT_EQ(actual[8 * PANEL_WIDTH + 12], 0x00F8); // byte-swapped red
+}
+
+TEST_F(PainterTiledSurface, RejectsOverfullDisplayList) {
+    for (uint16_t i = 0; i < TILED_SURFACE_MAX_OPS; ++i) {
+        EXPECT_TRUE(qp_tiled_surface_line(tiled, 0, 0, 1, 1, 0, 0, 255));
+    }
+    EXPECT_FALSE(qp_tiled_surface_line(tiled, 0, 0, 1, 1, 0, 0, 255));
+    EXPECT_TRUE(qp_tiled_surface_reset(tiled));
+    EXPECT_TRUE(qp_tiled_surface_line(tiled, 0, 0, 1, 1, 0, 0, 255));
+}
+
+TEST_F(PainterTiledSurface, RejectsNonTiledDevices) {
+    EXPECT_FALSE(qp_tiled_surface_rect(target, 0, 0, 1, 1, 0, 0, 255, true));
+    EXPECT_FALSE(qp_tiled_surface_draw(target, reference, 0, 0, false));
+}
+
+} // namespace
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_HIRES_ENABLE
+#define POINTING_DEVICE_ACCEL_CURVE \
+    { {64, POINTING_DEVICE_HIRES_Q16(1)}, {96, POINTING_DEVICE_HIRES_Q16(2)} }
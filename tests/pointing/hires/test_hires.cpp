@@ -0,0 +1,153 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::InSequence;
+
+class PointingHires : public TestFixture {
+   public:
+    void SetUp() override {
+        pd_clear_movement();
+        pointing_device_hires_reset();
+        pointing_device_hires_set_scale(POINTING_DEVICE_HIRES_Q16(1));
+        pointing_device_hires_set_wheel_scale(POINTING_DEVICE_HIRES_Q16(1));
+    }
+};
+
+TEST_F(PointingHires, UnitScaleKeepsMotion) {
+    TestDriver driver;
+
+    pd_set_x(10);
+    pd_set_y(-20);
+    EXPECT_MOUSE_REPORT(driver, (10, -20, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingHires, FractionsCarryIntoNextReport) {
+    TestDriver driver;
+    InSequence s;
+
+    pointing_device_hires_set_scale(POINTING_DEVICE_HIRES_Q16(0.5));
+    pd_set_x(3);
+    pd_set_y(-3);
+    EXPECT_MOUSE_REPORT(driver, (1, -1, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (2, -2, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (1, -1, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (2, -2, 0, 0, 0));
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingHires, SlowMotionIsNotLost) {
+    TestDriver driver;
+
+    pointing_device_hires_set_scale(POINTING_DEVICE_HIRES_Q16(0.25));
+    pd_set_x(1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    run_one_scan_loop();
+    pd_clear_movement();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingHires, OverflowCarriesIntoNextReports) {
+    TestDriver driver;
+    InSequence s;
+
+    pointing_device_hires_set_scale(POINTING_DEVICE_HIRES_Q16(10));
+    pd_set_x(30);
+    EXPECT_MOUSE_REPORT(driver, (127, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    EXPECT_MOUSE_REPORT(driver, (127, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (46, 0, 0, 0, 0));
+    run_one_scan_loop();
+    run_one_scan_loop();
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingHires, AccelerationFollowsCurve) {
+    TestDriver driver;
+    InSequence s;
+
+    // Below the curve the gain of its first point holds
+    pd_set_x(-40);
+    EXPECT_MOUSE_REPORT(driver, (-40, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    // Halfway between the points
+    pd_set_x(80);
+    EXPECT_MOUSE_REPORT(driver, (120, 0, 0, 0, 0));
+    run_one_scan_loop();
+
+    // Beyond the curve the gain of its last point holds, and the excess carries over
+    pd_set_x(0);
+    pd_set_y(100);
+    EXPECT_MOUSE_REPORT(driver, (0, 127, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    EXPECT_MOUSE_REPORT(driver, (0, 73, 0, 0, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingHires, WheelScalesSeparately) {
+    TestDriver driver;
+
+    pointing_device_hires_set_scale(POINTING_DEVICE_HIRES_Q16(2));
+    pointing_device_hires_set_wheel_scale(POINTING_DEVICE_HIRES_Q16(0.5));
+    pd_set_x(5);
+    pd_set_v(1);
+    pd_set_h(-1);
+    EXPECT_MOUSE_REPORT(driver, (10, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (10, 0, -1, 1, 0));
+    run_one_scan_loop();
+    pd_clear_movement();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingHires, ResetDropsRemainder) {
+    TestDriver driver;
+
+    pointing_device_hires_set_scale(POINTING_DEVICE_HIRES_Q16(0.5));
+    pd_set_x(1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    pointing_device_hires_reset();
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    VERIFY_AND_CLEAR(driver);
+}
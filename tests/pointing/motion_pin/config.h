@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_TASK_THROTTLE_MS 10
+#define POINTING_DEVICE_MOTION_PIN 0
+#define POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+
+// The test platform has no GPIO, the motion pin is mocked by the test pointing device driver
+#include <stdbool.h>
+#ifdef __cplusplus
+extern "C"
+#endif
+    bool
+    pd_read_motion_pin(void);
+#define gpio_set_pin_input_high(pin)
+#define gpio_read_pin(pin) pd_read_motion_pin()
@@ -0,0 +1,83 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+class PointingMotionPin : public TestFixture {
+   public:
+    void SetUp() override {
+        pd_clear_movement();
+        pd_set_motion(false);
+    }
+
+    void TearDown() override {
+        pd_clear_movement();
+        pd_set_motion(false);
+        TestFixture::TearDown();
+    }
+};
+
+TEST_F(PointingMotionPin, SensorIsNotReadWithoutMotion) {
+    TestDriver driver;
+
+    pd_set_x(10);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(POINTING_DEVICE_TASK_THROTTLE_MS * 3);
+    VERIFY_AND_CLEAR(driver);
+
+    pd_set_motion(true);
+    EXPECT_MOUSE_REPORT(driver, (10, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingMotionPin, MotionBypassesThrottle) {
+    TestDriver driver;
+
+    pd_set_x(10);
+    pd_set_motion(true);
+    EXPECT_MOUSE_REPORT(driver, (10, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Without the motion pin the next report would wait for the throttle
+    pd_set_x(-5);
+    pd_set_y(7);
+    EXPECT_MOUSE_REPORT(driver, (-5, 7, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_set_motion(false);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingMotionPin, MotionIsTimestamped) {
+    TestDriver driver;
+
+    pd_set_x(1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    uint32_t idle_time = pointing_device_get_motion_time();
+    VERIFY_AND_CLEAR(driver);
+
+    advance_time(3);
+    uint32_t detected = timer_read32();
+    pd_set_motion(true);
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NE(pointing_device_get_motion_time(), idle_time);
+    EXPECT_EQ(pointing_device_get_motion_time(), detected);
+}
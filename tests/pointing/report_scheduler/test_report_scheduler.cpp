@@ -0,0 +1,100 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::InSequence;
+
+class ReportScheduler : public TestFixture {
+   public:
+    void SetUp() override {
+        pd_clear_movement();
+    }
+
+    void TearDown() override {
+        pd_clear_movement();
+    }
+};
+
+TEST_F(ReportScheduler, SendsRightAwayWhenHostIsReady) {
+    TestDriver driver;
+
+    pd_set_x(10);
+    pd_set_y(-20);
+    EXPECT_MOUSE_REPORT(driver, (10, -20, 0, 0, 0));
+    run_one_scan_loop();
+    pd_clear_movement();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportScheduler, MergesMotionUntilHostTakesReport) {
+    TestDriver driver;
+
+    driver.set_mouse_ready(false);
+    pd_set_x(3);
+    pd_set_y(-1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    pd_set_x(4);
+    pd_set_y(0);
+    run_one_scan_loop();
+    pd_clear_movement();
+    VERIFY_AND_CLEAR(driver);
+
+    driver.set_mouse_ready(true);
+    EXPECT_MOUSE_REPORT(driver, (10, -2, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportScheduler, MergedMotionBeyondReportRangeCarriesOver) {
+    TestDriver driver;
+    InSequence s;
+
+    driver.set_mouse_ready(false);
+    pd_set_x(100);
+    pd_set_v(-100);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    pd_clear_movement();
+
+    driver.set_mouse_ready(true);
+    EXPECT_MOUSE_REPORT(driver, (127, 0, 0, -128, 0));
+    EXPECT_MOUSE_REPORT(driver, (73, 0, 0, -72, 0));
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportScheduler, ButtonChangesAreNotMerged) {
+    TestDriver driver;
+    InSequence s;
+
+    driver.set_mouse_ready(false);
+    pd_set_x(5);
+    run_one_scan_loop();
+    pd_clear_movement();
+
+    // The press and the release each get their own report, after the motion they followed
+    EXPECT_MOUSE_REPORT(driver, (5, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    run_one_scan_loop();
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    driver.set_mouse_ready(true);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
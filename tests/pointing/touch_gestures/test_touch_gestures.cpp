@@ -0,0 +1,166 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+using testing::InSequence;
+
+class TouchGestures : public TestFixture {
+   public:
+    void SetUp() override {
+        pd_clear_movement();
+        touch_gesture_reset();
+    }
+
+    // Records a sample with up to two contacts, the time being relative to the start of the touch
+    void touch(uint16_t time, uint8_t fingers, uint16_t x0 = 0, uint16_t y0 = 0, uint16_t x1 = 0, uint16_t y1 = 0) {
+        touch_sample_t sample = {.time = time, .fingers = fingers, .contacts = {{x0, y0}, {x1, y1}}};
+        touch_gesture_record(&sample);
+    }
+};
+
+TEST_F(TouchGestures, OneFingerTapClicksFirstButton) {
+    TestDriver driver;
+    InSequence s;
+
+    touch(0, 1, 500, 500);
+    touch(40, 1, 505, 498);
+    touch(80, 0);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TouchGestures, TwoFingerTapClicksSecondButton) {
+    TestDriver driver;
+    InSequence s;
+
+    // The second finger lands a little after the first
+    touch(0, 1, 500, 500);
+    touch(10, 2, 500, 500, 700, 500);
+    touch(60, 2, 502, 500, 700, 503);
+    touch(100, 0);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 2));
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TouchGestures, LongPressIsNoTap) {
+    TestDriver driver;
+
+    touch(0, 1, 500, 500);
+    touch(POINTING_DEVICE_GESTURES_TAP_TERM + 1, 0);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_EQ(pointing_device_get_touch_gesture().type, TOUCH_GESTURE_NONE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TouchGestures, TwoFingerDragScrolls) {
+    TestDriver driver;
+    InSequence s;
+
+    // Motion below the scroll threshold is kept for the first scroll
+    touch(0, 2, 500, 500, 700, 500);
+    touch(10, 2, 500, 520, 700, 520);
+    touch(20, 2, 500, 540, 700, 540);
+    touch(30, 2, 500, 560, 700, 560);
+    touch(40, 2, 500, 580, 700, 580);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, -80 / POINTING_DEVICE_GESTURES_SCROLL_DIVISOR, 0));
+    run_one_scan_loop();
+    EXPECT_EQ(pointing_device_get_touch_gesture().type, TOUCH_GESTURE_SCROLL);
+    VERIFY_AND_CLEAR(driver);
+
+    // Lifting after a scroll doesn't tap
+    touch(50, 0);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TouchGestures, ScrollKeepsRemainderBetweenReports) {
+    TestDriver driver;
+    InSequence s;
+
+    touch(0, 2, 500, 500, 700, 500);
+    touch(10, 2, 540, 500, 740, 500);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 2, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // 40 counts at 16 per step leave 8, which the next 8 counts complete
+    touch(20, 2, 548, 500, 748, 500);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 1, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TouchGestures, SpreadingFingersPinches) {
+    TestDriver driver;
+
+    touch(0, 2, 500, 500, 600, 500);
+    touch(20, 2, 470, 500, 630, 500);
+    touch(40, 2, 450, 500, 650, 500);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    touch_gesture_t gesture = pointing_device_get_touch_gesture();
+    EXPECT_EQ(gesture.type, TOUCH_GESTURE_PINCH);
+    EXPECT_EQ(gesture.pinch, 100);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TouchGestures, QuickThreeFingerMotionSwipes) {
+    TestDriver driver;
+
+    touch(0, 3, 300, 500, 400, 500);
+    touch(50, 3, 400, 500, 500, 500);
+    touch(100, 3, 550, 500, 650, 500);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    touch_gesture_t gesture = pointing_device_get_touch_gesture();
+    EXPECT_EQ(gesture.type, TOUCH_GESTURE_SWIPE);
+    EXPECT_EQ(gesture.fingers, 3);
+    EXPECT_EQ(gesture.x, 250);
+    EXPECT_EQ(gesture.y, 0);
+
+    // The swipe is reported once
+    touch(150, 3, 700, 500, 800, 500);
+    touch(200, 0);
+    run_one_scan_loop();
+    EXPECT_EQ(pointing_device_get_touch_gesture().type, TOUCH_GESTURE_NONE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TouchGestures, SlowThreeFingerMotionIsNoSwipe) {
+    TestDriver driver;
+
+    touch(0, 3, 300, 500, 400, 500);
+    touch(200, 3, 400, 500, 500, 500);
+    touch(POINTING_DEVICE_GESTURES_SWIPE_TERM + 100, 3, 550, 500, 650, 500);
+    touch(POINTING_DEVICE_GESTURES_SWIPE_TERM + 150, 0);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_EQ(pointing_device_get_touch_gesture().type, TOUCH_GESTURE_NONE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TouchGestures, FullBufferDropsOldestSamples) {
+    TestDriver driver;
+
+    // Only the last samples of the drag are left, which stay under the scroll threshold
+    for (uint16_t i = 0; i < POINTING_DEVICE_GESTURES_TOUCH_SAMPLES * 2; i++) {
+        touch(i, 2, 500, 500 + i, 700, 500 + i);
+    }
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_EQ(pointing_device_get_touch_gesture().type, TOUCH_GESTURE_NONE);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,154 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "process_dispatch.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+
+namespace {
+
+std::vector<std::string> calls;
+bool                     block_in_second = false;
+
+bool process_first(uint16_t keycode, keyrecord_t* record) {
+    calls.push_back("first");
+    return true;
+}
+
+bool process_second(uint16_t keycode, keyrecord_t* record) {
+    calls.push_back("second");
+    return !block_in_second;
+}
+
+bool process_third(uint16_t keycode, keyrecord_t* record) {
+    calls.push_back("third");
+    return true;
+}
+
+// clang-format off
+const process_record_handler_t handlers[] PROGMEM = {
+    PROCESS_RECORD_RANGE(process_first, QK_LIGHTING, QK_LIGHTING_MAX, PROCESS_ON_PRESS),
+    PROCESS_RECORD_ALL(process_second),
+    PROCESS_RECORD_KEYCODE(process_third, QK_GRAVE_ESCAPE, PROCESS_ON_RELEASE),
+    PROCESS_RECORD_RANGE(process_third, QK_USER, QK_USER_MAX, PROCESS_ON_ANY),
+};
+// clang-format on
+
+std::vector<uint16_t> user_keycodes;
+uint16_t              user_blocked_keycode = KC_NO;
+
+} // namespace
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+    user_keycodes.push_back(keycode);
+    return keycode != user_blocked_keycode;
+}
+
+class ProcessDispatch : public TestFixture {
+   public:
+    void SetUp() override {
+        calls.clear();
+        block_in_second = false;
+        user_keycodes.clear();
+        user_blocked_keycode = KC_NO;
+    }
+
+    std::vector<std::string> dispatch(uint16_t keycode, bool pressed) {
+        keyrecord_t record   = {};
+        record.event.type    = KEY_EVENT;
+        record.event.pressed = pressed;
+        calls.clear();
+        last_result = process_record_dispatch(handlers, sizeof(handlers) / sizeof(handlers[0]), keycode, &record);
+        return calls;
+    }
+
+    bool last_result;
+};
+
+using Calls = std::vector<std::string>;
+
+TEST_F(ProcessDispatch, PlainKeycodesOnlyVisitHandlersObservingEveryKey) {
+    EXPECT_EQ(dispatch(KC_A, true), Calls({"second"}));
+    EXPECT_EQ(dispatch(KC_A, false), Calls({"second"}));
+    EXPECT_TRUE(last_result);
+}
+
+TEST_F(ProcessDispatch, HandlersRunInTableOrder) {
+    EXPECT_EQ(dispatch(QK_UNDERGLOW_TOGGLE, true), Calls({"first", "second"}));
+    EXPECT_EQ(dispatch(QK_USER, true), Calls({"second", "third"}));
+}
+
+TEST_F(ProcessDispatch, EventKindsAreFiltered) {
+    EXPECT_EQ(dispatch(QK_UNDERGLOW_TOGGLE, false), Calls({"second"}));
+    EXPECT_EQ(dispatch(QK_GRAVE_ESCAPE, true), Calls({"second"}));
+    EXPECT_EQ(dispatch(QK_GRAVE_ESCAPE, false), Calls({"second", "third"}));
+}
+
+TEST_F(ProcessDispatch, StopsAtFirstHandlerReturningFalse) {
+    block_in_second = true;
+    EXPECT_EQ(dispatch(QK_USER_MAX, true), Calls({"second"}));
+    EXPECT_FALSE(last_result);
+}
+
+TEST_F(ProcessDispatch, RecordedBeforeUserProcessing) {
+    TestDriver driver;
+    KeymapKey  key_b = KeymapKey(0, 0, 0, KC_B);
+    set_keymap({key_b});
+
+    // Repeat Key's last key tracking precedes process_record_user, so it sees keys the user swallows
+    user_blocked_keycode = KC_B;
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(get_last_keycode(), KC_B);
+    EXPECT_EQ(user_keycodes, std::vector<uint16_t>({KC_B, KC_B}));
+}
+
+TEST_F(ProcessDispatch, UserProcessingPrecedesFeatureKeycodes) {
+    TestDriver driver;
+    KeymapKey  lower = KeymapKey(0, 0, 0, QK_TRI_LAYER_LOWER);
+    set_keymap({lower});
+
+    user_blocked_keycode = QK_TRI_LAYER_LOWER;
+    EXPECT_NO_REPORT(driver);
+    lower.press();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+    lower.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    user_blocked_keycode = KC_NO;
+    lower.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+    lower.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessDispatch, FeaturesObservingEveryKeySeePlainKeycodes) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    caps_word_on();
+    EXPECT_REPORT(driver, (KC_LSFT)).Times(AnyNumber());
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_TRUE(is_caps_word_on());
+
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    caps_word_off();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,166 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+namespace {
+
+struct callback_result_t {
+    send_string_token_t token;
+    bool                completed;
+};
+
+std::vector<callback_result_t> callbacks;
+
+void record_callback(send_string_token_t token, bool completed, void* cb_arg) {
+    callbacks.push_back({token, completed});
+}
+
+class SendStringAsync : public TestFixture {
+   public:
+    void SetUp() override {
+        callbacks.clear();
+    }
+};
+
+TEST_F(SendStringAsync, TypesInBackgroundAndReportsCompletion) {
+    TestDriver driver;
+    InSequence s;
+
+    // Nothing is typed until the task gets a chance to run
+    EXPECT_NO_REPORT(driver);
+    send_string_token_t token = send_string_async("aB", 0, record_callback, nullptr);
+    ASSERT_NE(token, INVALID_SEND_STRING_TOKEN);
+    EXPECT_TRUE(send_string_async_is_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_FALSE(send_string_async_is_busy());
+    ASSERT_EQ(callbacks.size(), 1);
+    EXPECT_EQ(callbacks[0].token, token);
+    EXPECT_TRUE(callbacks[0].completed);
+}
+
+TEST_F(SendStringAsync, DelaysDoNotBlock) {
+    TestDriver driver;
+    KeymapKey  key_x = KeymapKey(0, 0, 0, KC_X);
+    set_keymap({key_x});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_async("a" SS_DELAY(100) "b", 0, record_callback, nullptr);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+
+    // Keys pressed while the string waits are still processed
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_x);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_TRUE(callbacks.empty());
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+    ASSERT_EQ(callbacks.size(), 1);
+    EXPECT_TRUE(callbacks[0].completed);
+}
+
+TEST_F(SendStringAsync, HonoursInterval) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    send_string_async("C", 10, record_callback, nullptr);
+    idle_for(5);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT, KC_C));
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(40);
+    VERIFY_AND_CLEAR(driver);
+    ASSERT_EQ(callbacks.size(), 1);
+}
+
+TEST_F(SendStringAsync, QueuedStringsAreTypedInOrder) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_token_t first  = send_string_async("1", 0, record_callback, nullptr);
+    send_string_token_t second = send_string_async("2", 0, record_callback, nullptr);
+    EXPECT_NE(first, second);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    ASSERT_EQ(callbacks.size(), 2);
+    EXPECT_EQ(callbacks[0].token, first);
+    EXPECT_EQ(callbacks[1].token, second);
+}
+
+TEST_F(SendStringAsync, CancelReleasesHeldKeys) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_D));
+    send_string_token_t token   = send_string_async("Dd", 10, record_callback, nullptr);
+    send_string_token_t pending = send_string_async("e", 10, record_callback, nullptr);
+    idle_for(15);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_TRUE(send_string_async_cancel(token));
+    EXPECT_FALSE(send_string_async_cancel(token));
+    VERIFY_AND_CLEAR(driver);
+    ASSERT_EQ(callbacks.size(), 1);
+    EXPECT_FALSE(callbacks[0].completed);
+
+    // The next string in the queue carries on
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(50);
+    VERIFY_AND_CLEAR(driver);
+    ASSERT_EQ(callbacks.size(), 2);
+    EXPECT_EQ(callbacks[1].token, pending);
+    EXPECT_TRUE(callbacks[1].completed);
+}
+
+TEST_F(SendStringAsync, RejectsWhenQueueIsFull) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+
+    for (int i = 0; i < SEND_STRING_ASYNC_QUEUE_SIZE; ++i) {
+        EXPECT_NE(send_string_async("x", 0, record_callback, nullptr), INVALID_SEND_STRING_TOKEN);
+    }
+    EXPECT_EQ(send_string_async("x", 0, record_callback, nullptr), INVALID_SEND_STRING_TOKEN);
+
+    send_string_async_cancel_all();
+    EXPECT_FALSE(send_string_async_is_busy());
+    EXPECT_EQ(callbacks.size(), SEND_STRING_ASYNC_QUEUE_SIZE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+} // namespace
@@ -129,3 +129,93 @@ TEST_F(PermissiveHold, tap_regular_key_while_layer_tap_key_is_held) {
     run_one_scan_loop();
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(PermissiveHold, tap_regular_key_while_two_mod_tap_keys_are_held) {
+    TestDriver driver;
+    InSequence s;
+    auto       first_mod_tap_hold_key  = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    auto       second_mod_tap_hold_key = KeymapKey(0, 2, 0, CTL_T(KC_A));
+    auto       regular_key             = KeymapKey(0, 3, 0, KC_B);
+
+    set_keymap({first_mod_tap_hold_key, second_mod_tap_hold_key, regular_key});
+
+    /* Press first mod-tap-hold key */
+    EXPECT_NO_REPORT(driver);
+    first_mod_tap_hold_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Press second mod-tap-hold key */
+    EXPECT_NO_REPORT(driver);
+    second_mod_tap_hold_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Press regular key */
+    EXPECT_NO_REPORT(driver);
+    regular_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release regular key, which settles both mod-tap-hold keys as held */
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_LEFT_CTRL, regular_key.report_code));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_LEFT_CTRL));
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release second mod-tap-hold key */
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    second_mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release first mod-tap-hold key */
+    EXPECT_EMPTY_REPORT(driver);
+    first_mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PermissiveHold, roll_two_mod_tap_keys_with_regular_key_under_tapping_term) {
+    TestDriver driver;
+    InSequence s;
+    auto       first_mod_tap_hold_key  = KeymapKey(0, 1, 0, SFT_T(KC_P));
+    auto       second_mod_tap_hold_key = KeymapKey(0, 2, 0, CTL_T(KC_A));
+    auto       regular_key             = KeymapKey(0, 3, 0, KC_B);
+
+    set_keymap({first_mod_tap_hold_key, second_mod_tap_hold_key, regular_key});
+
+    /* Press all keys */
+    EXPECT_NO_REPORT(driver);
+    first_mod_tap_hold_key.press();
+    run_one_scan_loop();
+    second_mod_tap_hold_key.press();
+    run_one_scan_loop();
+    regular_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release first mod-tap-hold key, settling it as tapped */
+    EXPECT_REPORT(driver, (first_mod_tap_hold_key.report_code));
+    first_mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release second mod-tap-hold key, which is tapped as well since it was released before the regular key */
+    EXPECT_REPORT(driver, (first_mod_tap_hold_key.report_code, second_mod_tap_hold_key.report_code));
+    EXPECT_REPORT(driver, (first_mod_tap_hold_key.report_code, second_mod_tap_hold_key.report_code, regular_key.report_code));
+    EXPECT_REPORT(driver, (second_mod_tap_hold_key.report_code, regular_key.report_code));
+    EXPECT_REPORT(driver, (regular_key.report_code));
+    second_mod_tap_hold_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Release regular key */
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
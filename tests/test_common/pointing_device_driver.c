@@ -18,6 +18,7 @@ typedef struct {
     pd_button_state_t button_state[8];
     uint16_t          cpi;
     bool              initiated;
+    bool              motion;
 } pd_config_t;
 
 static pd_config_t pd_config = {0};
@@ -107,3 +108,12 @@ void pd_clear_movement(void) {
 void pd_set_init(bool success) {
     pd_config.initiated = success;
 }
+
+void pd_set_motion(bool motion) {
+    pd_config.motion = motion;
+}
+
+bool pd_read_motion_pin(void) {
+    // The pin of the sensors is active low
+    return !pd_config.motion;
+}
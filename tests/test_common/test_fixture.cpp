@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include "gmock/gmock-cardinalities.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -23,11 +24,17 @@ extern "C" {
 #include "debug.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#include "deferred_exec.h"
 
-void set_time(uint32_t t);
-void advance_time(uint32_t ms);
+void     set_time(uint32_t t);
+void     advance_time(uint32_t ms);
+uint32_t timer_read_internal(void);
 }
 
+#ifndef FAST_FORWARD_SETTLE_TIME
+#    define FAST_FORWARD_SETTLE_TIME (TAPPING_TERM * 2)
+#endif
+
 using testing::_;
 
 /* This is used for dynamic dispatching keymap_key_to_keycode calls to the current active test_fixture. */
@@ -185,6 +192,100 @@ void TestFixture::idle_for(unsigned time) {
     }
 }
 
+void TestFixture::fast_forward(unsigned time) {
+    test_logger.trace() << +time << " keyboard task " << (time > 1 ? "loops" : "loop") << ", fast-forwarded" << std::endl;
+
+    const uint32_t end          = timer_read_internal() + time;
+    KeyboardState  last         = snapshot_state();
+    uint32_t       settled_from = timer_read_internal();
+
+    while (timer_read_internal() < end) {
+        keyboard_task();
+#ifdef DEFERRED_EXEC_ENABLE
+        deferred_exec_task();
+#endif
+        housekeeping_task();
+        advance_time(1);
+
+        const KeyboardState current = snapshot_state();
+        if (!current.same_as(last)) {
+            last         = current;
+            settled_from = current.time;
+            continue;
+        }
+
+        if (current.time - settled_from < FAST_FORWARD_SETTLE_TIME) {
+            continue;
+        }
+
+        // Nothing happens until the next deadline, so skip straight to the loop which handles it
+        uint32_t target = end;
+#ifdef DEFERRED_EXEC_ENABLE
+        uint32_t deadline;
+        if (deferred_exec_next_deadline(&deadline) && deadline < target) {
+            target = deadline;
+        }
+#endif
+        if (target > current.time) {
+            set_time(target);
+        }
+    }
+}
+
+KeyboardState TestFixture::snapshot_state() const {
+    KeyboardState state = {};
+
+    state.time = timer_read_internal();
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        state.matrix[row] = matrix_get_row(row);
+    }
+    state.layer_state         = layer_state;
+    state.default_layer_state = default_layer_state;
+    state.mods                = get_mods();
+    state.weak_mods           = get_weak_mods();
+#ifndef NO_ACTION_ONESHOT
+    state.oneshot_mods        = get_oneshot_mods();
+    state.oneshot_locked_mods = get_oneshot_locked_mods();
+    state.oneshot_layer       = get_oneshot_layer();
+    state.oneshot_layer_state = get_oneshot_layer_state();
+#endif
+    state.keyboard_report = *keyboard_report;
+    return state;
+}
+
+void TestFixture::restore_state(const KeyboardState& state) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(state.matrix[row], 0) << "keyboard state was captured while keys were held";
+    }
+
+    layer_state         = state.layer_state;
+    default_layer_state = state.default_layer_state;
+    set_mods(state.mods);
+    set_weak_mods(state.weak_mods);
+#ifndef NO_ACTION_ONESHOT
+    set_oneshot_mods(state.oneshot_mods);
+    set_oneshot_locked_mods(state.oneshot_locked_mods);
+    set_oneshot_layer(state.oneshot_layer, state.oneshot_layer_state);
+#endif
+    *keyboard_report = state.keyboard_report;
+    set_time(state.time);
+}
+
+bool KeyboardState::same_as(const KeyboardState& other) const {
+    // clang-format off
+    return memcmp(matrix, other.matrix, sizeof(matrix)) == 0 &&
+           layer_state == other.layer_state &&
+           default_layer_state == other.default_layer_state &&
+           mods == other.mods &&
+           weak_mods == other.weak_mods &&
+           oneshot_mods == other.oneshot_mods &&
+           oneshot_locked_mods == other.oneshot_locked_mods &&
+           oneshot_layer == other.oneshot_layer &&
+           oneshot_layer_state == other.oneshot_layer_state &&
+           memcmp(&keyboard_report, &other.keyboard_report, sizeof(keyboard_report)) == 0;
+    // clang-format on
+}
+
 void TestFixture::print_test_log() const {
     const ::testing::TestInfo* const test_info = ::testing::UnitTest::GetInstance()->current_test_info();
     if (HasFailure()) {
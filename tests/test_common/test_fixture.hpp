@@ -21,8 +21,36 @@
 #include <optional>
 #include "gtest/gtest.h"
 #include "keyboard.h"
+#include "matrix.h"
 #include "test_keymap_key.hpp"
 
+extern "C" {
+#include "action_layer.h"
+#include "report.h"
+}
+
+/**
+ * @brief The keyboard state that persists between key events, as captured by `TestFixture::snapshot_state()`.
+ */
+struct KeyboardState {
+    uint32_t          time;
+    matrix_row_t      matrix[MATRIX_ROWS];
+    layer_state_t     layer_state;
+    layer_state_t     default_layer_state;
+    uint8_t           mods;
+    uint8_t           weak_mods;
+    uint8_t           oneshot_mods;
+    uint8_t           oneshot_locked_mods;
+    uint8_t           oneshot_layer;
+    uint8_t           oneshot_layer_state;
+    report_keyboard_t keyboard_report;
+
+    /**
+     * @brief Whether both states are the same, apart from the time they were taken at.
+     */
+    bool same_as(const KeyboardState& other) const;
+};
+
 class TestFixture : public testing::Test {
    public:
     static TestFixture* m_this;
@@ -63,6 +91,30 @@ class TestFixture : public testing::Test {
     void run_one_scan_loop();
     void idle_for(unsigned ms);
 
+    /**
+     * @brief Idles for `ms` like `idle_for()`, but jumps ahead in time while the keyboard is settled. Deferred
+     * executors are run as in the main loop.
+     *
+     * The keyboard counts as settled once its state has not changed for `FAST_FORWARD_SETTLE_TIME` milliseconds,
+     * after which time jumps straight to the next deferred executor deadline, or the end of the idle period.
+     * Timeouts longer than the settle time which don't run on deferred executors may be skipped.
+     */
+    void fast_forward(unsigned ms);
+
+    /**
+     * @brief Captures the keyboard state, which must be taken while no keys are held.
+     *
+     * Only state which persists between key events is captured, so the state of keys still being resolved, such as
+     * pending tap-hold keys, combos or tap dances, is not. Use `fast_forward()` to let these settle first.
+     */
+    KeyboardState snapshot_state() const;
+
+    /**
+     * @brief Returns the keyboard to a state captured by `snapshot_state()`, including the time, without sending
+     * any reports.
+     */
+    void restore_state(const KeyboardState& state);
+
     void expect_layer_state(layer_t layer) const;
 
    protected:
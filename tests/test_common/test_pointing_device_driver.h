@@ -27,6 +27,9 @@ void pd_clear_movement(void);
 
 void pd_set_init(bool success);
 
+void pd_set_motion(bool motion);
+bool pd_read_motion_pin(void);
+
 #ifdef __cplusplus
 }
 #endif
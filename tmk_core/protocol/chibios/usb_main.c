@@ -476,6 +476,20 @@ void send_mouse(report_mouse_t *report) {
 #endif
 }
 
+/**
+ * @brief Checks whether the host has taken every mouse report sent so far
+ *
+ * @return true The mouse endpoint is idle, a new report goes out on the next poll
+ * @return false A report is still waiting for the host
+ */
+bool mouse_ready(void) {
+#ifdef MOUSE_ENABLE
+    return usb_endpoint_in_is_inactive(&usb_endpoints_in[USB_ENDPOINT_IN_MOUSE]);
+#else
+    return true;
+#endif
+}
+
 /* ---------------------------------------------------------
  *                   Extrakey functions
  * ---------------------------------------------------------
@@ -505,6 +519,20 @@ void send_digitizer(report_digitizer_t *report) {
 #endif
 }
 
+/**
+ * @brief Checks whether the host has taken every digitizer report sent so far
+ *
+ * @return true The digitizer endpoint is idle, a new report goes out on the next poll
+ * @return false A report is still waiting for the host
+ */
+bool digitizer_ready(void) {
+#ifdef DIGITIZER_ENABLE
+    return usb_endpoint_in_is_inactive(&usb_endpoints_in[USB_ENDPOINT_IN_DIGITIZER]);
+#else
+    return true;
+#endif
+}
+
 /* ---------------------------------------------------------
  *                   Console functions
  * ---------------------------------------------------------
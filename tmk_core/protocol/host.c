@@ -16,6 +16,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <stdint.h>
+#include <string.h>
 #include "keyboard.h"
 #include "keycode.h"
 #include "host.h"
@@ -44,6 +45,34 @@ static host_driver_t *driver;
 static uint16_t       last_system_usage   = 0;
 static uint16_t       last_consumer_usage = 0;
 
+#ifdef MOUSE_REPORT_SCHEDULER
+#    ifdef MOUSE_EXTENDED_REPORT
+#        define MOUSE_XY_MIN INT16_MIN
+#        define MOUSE_XY_MAX INT16_MAX
+#    else
+#        define MOUSE_XY_MIN INT8_MIN
+#        define MOUSE_XY_MAX INT8_MAX
+#    endif
+#    ifdef WHEEL_EXTENDED_REPORT
+#        define MOUSE_HV_MIN INT16_MIN
+#        define MOUSE_HV_MAX INT16_MAX
+#    else
+#        define MOUSE_HV_MIN INT8_MIN
+#        define MOUSE_HV_MAX INT8_MAX
+#    endif
+
+/* motion and buttons waiting for the host to take the previous mouse report */
+static struct {
+    int32_t x;
+    int32_t y;
+    int32_t h;
+    int32_t v;
+    uint8_t buttons;
+    uint8_t sent_buttons;
+    bool    pending;
+} mouse_pending = {};
+#endif
+
 void host_set_driver(host_driver_t *d) {
     driver = d;
 }
@@ -109,6 +138,62 @@ void host_nkro_send(report_nkro_t *report) {
     }
 }
 
+static void send_mouse_report(report_mouse_t *report) {
+#ifdef MOUSE_SHARED_EP
+    report->report_id = REPORT_ID_MOUSE;
+#endif
+#ifdef MOUSE_EXTENDED_REPORT
+    // clip and copy to Boot protocol XY
+    report->boot_x = (report->x > 127) ? 127 : ((report->x < -127) ? -127 : report->x);
+    report->boot_y = (report->y > 127) ? 127 : ((report->y < -127) ? -127 : report->y);
+#endif
+    (*driver->send_mouse)(report);
+}
+
+#ifdef MOUSE_REPORT_SCHEDULER
+static void mouse_pending_add(int32_t *pending, int32_t motion) {
+    int64_t total = (int64_t)*pending + motion;
+    *pending      = total > INT32_MAX ? INT32_MAX : (total < INT32_MIN ? INT32_MIN : total);
+}
+
+// Takes out as much motion as one report can hold, leaving the rest pending
+static int32_t mouse_pending_take(int32_t *pending, int32_t min, int32_t max) {
+    int32_t motion = *pending < min ? min : (*pending > max ? max : *pending);
+    *pending -= motion;
+    return motion;
+}
+
+static void mouse_pending_flush(void) {
+    report_mouse_t report = {
+        .buttons = mouse_pending.buttons,
+        .x       = mouse_pending_take(&mouse_pending.x, MOUSE_XY_MIN, MOUSE_XY_MAX),
+        .y       = mouse_pending_take(&mouse_pending.y, MOUSE_XY_MIN, MOUSE_XY_MAX),
+        .h       = mouse_pending_take(&mouse_pending.h, MOUSE_HV_MIN, MOUSE_HV_MAX),
+        .v       = mouse_pending_take(&mouse_pending.v, MOUSE_HV_MIN, MOUSE_HV_MAX),
+    };
+    mouse_pending.sent_buttons = mouse_pending.buttons;
+    mouse_pending.pending      = mouse_pending.x || mouse_pending.y || mouse_pending.h || mouse_pending.v;
+    send_mouse_report(&report);
+}
+
+/**
+ * @brief Sends the motion merged since the last mouse report, once the host has taken that report
+ *
+ * Called from the keyboard task, so that motion which piled up while the host was polling goes out in the following
+ * poll interval.
+ */
+void host_mouse_task(void) {
+    if (!driver || !driver->mouse_ready || !mouse_pending.pending) return;
+#    ifdef BLUETOOTH_ENABLE
+    if (where_to_send() == OUTPUT_BLUETOOTH) return;
+#    endif
+
+    if ((*driver->mouse_ready)()) {
+        mouse_pending_flush();
+    }
+}
+#endif
+
 void host_mouse_send(report_mouse_t *report) {
 #ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
@@ -118,15 +203,25 @@ void host_mouse_send(report_mouse_t *report) {
 #endif
 
     if (!driver) return;
-#ifdef MOUSE_SHARED_EP
-    report->report_id = REPORT_ID_MOUSE;
-#endif
-#ifdef MOUSE_EXTENDED_REPORT
-    // clip and copy to Boot protocol XY
-    report->boot_x = (report->x > 127) ? 127 : ((report->x < -127) ? -127 : report->x);
-    report->boot_y = (report->y > 127) ? 127 : ((report->y < -127) ? -127 : report->y);
+#ifdef MOUSE_REPORT_SCHEDULER
+    if (driver->mouse_ready) {
+        // Button changes are never merged, the motion before them goes out first even if that queues a report
+        if (mouse_pending.pending && report->buttons != mouse_pending.buttons) {
+            mouse_pending_flush();
+        }
+
+        mouse_pending_add(&mouse_pending.x, report->x);
+        mouse_pending_add(&mouse_pending.y, report->y);
+        mouse_pending_add(&mouse_pending.h, report->h);
+        mouse_pending_add(&mouse_pending.v, report->v);
+        mouse_pending.buttons = report->buttons;
+        mouse_pending.pending = mouse_pending.x || mouse_pending.y || mouse_pending.h || mouse_pending.v || mouse_pending.buttons != mouse_pending.sent_buttons;
+
+        host_mouse_task();
+        return;
+    }
 #endif
-    (*driver->send_mouse)(report);
+    send_mouse_report(report);
 }
 
 void host_system_send(uint16_t usage) {
@@ -221,7 +316,21 @@ void host_joystick_send(joystick_t *joystick) {
 
 __attribute__((weak)) void send_joystick(report_joystick_t *report) {}
 
-#ifdef DIGITIZER_ENABLE
+#if defined(DIGITIZER_ENABLE) && defined(DIGITIZER_CONTACT_COUNT)
+void host_digitizer_send(digitizer_t *digitizer) {
+    report_digitizer_t report = {
+#    ifdef DIGITIZER_SHARED_EP
+        .report_id = REPORT_ID_DIGITIZER,
+#    endif
+        .scan_time     = digitizer->scan_time,
+        .contact_count = digitizer->contact_count,
+        .button        = digitizer->button,
+    };
+    memcpy(report.contacts, digitizer->contacts, digitizer->contact_count * sizeof(report_digitizer_contact_t));
+
+    send_digitizer(&report);
+}
+#elif defined(DIGITIZER_ENABLE)
 void host_digitizer_send(digitizer_t *digitizer) {
     report_digitizer_t report = {
 #    ifdef DIGITIZER_SHARED_EP
@@ -240,6 +349,10 @@ void host_digitizer_send(digitizer_t *digitizer) {
 
 __attribute__((weak)) void send_digitizer(report_digitizer_t *report) {}
 
+__attribute__((weak)) bool digitizer_ready(void) {
+    return true;
+}
+
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
 void host_programmable_button_send(uint32_t data) {
     report_programmable_button_t report = {
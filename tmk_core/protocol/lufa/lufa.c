@@ -79,7 +79,8 @@ static void   send_keyboard(report_keyboard_t *report);
 static void   send_nkro(report_nkro_t *report);
 static void   send_mouse(report_mouse_t *report);
 static void   send_extra(report_extra_t *report);
-host_driver_t lufa_driver = {.keyboard_leds = usb_device_state_get_leds, .send_keyboard = send_keyboard, .send_nkro = send_nkro, .send_mouse = send_mouse, .send_extra = send_extra};
+static bool   mouse_ready(void);
+host_driver_t lufa_driver = {.keyboard_leds = usb_device_state_get_leds, .send_keyboard = send_keyboard, .send_nkro = send_nkro, .send_mouse = send_mouse, .send_extra = send_extra, .mouse_ready = mouse_ready};
 
 void send_report(uint8_t endpoint, void *report, size_t size) {
     uint8_t timeout = 255;
@@ -553,6 +554,21 @@ static void send_mouse(report_mouse_t *report) {
 #endif
 }
 
+/** \brief Mouse Ready
+ *
+ * Whether the host has taken the last mouse report, leaving the IN bank free
+ */
+static bool mouse_ready(void) {
+#ifdef MOUSE_ENABLE
+    if (USB_DeviceState != DEVICE_STATE_Configured) return false;
+
+    Endpoint_SelectEndpoint(MOUSE_IN_EPNUM);
+    return Endpoint_IsINReady();
+#else
+    return true;
+#endif
+}
+
 /** \brief Send Extra
  *
  * FIXME: Needs doc
@@ -581,6 +597,21 @@ void send_digitizer(report_digitizer_t *report) {
 #endif
 }
 
+/** \brief Digitizer Ready
+ *
+ * Whether the host has taken the last digitizer report, leaving the IN bank free
+ */
+bool digitizer_ready(void) {
+#ifdef DIGITIZER_ENABLE
+    if (USB_DeviceState != DEVICE_STATE_Configured) return false;
+
+    Endpoint_SelectEndpoint(DIGITIZER_IN_EPNUM);
+    return Endpoint_IsINReady();
+#else
+    return true;
+#endif
+}
+
 /*******************************************************************************
  * sendchar
  ******************************************************************************/
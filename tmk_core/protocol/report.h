@@ -220,10 +220,35 @@ typedef struct {
     mouse_hv_report_t h;
 } PACKED report_mouse_t;
 
+#ifdef DIGITIZER_CONTACT_COUNT
+#    if DIGITIZER_CONTACT_COUNT < 1 || DIGITIZER_CONTACT_COUNT > 5
+#        error "DIGITIZER_CONTACT_COUNT must be between 1 and 5"
+#    endif
+
+typedef struct {
+    bool     tip : 1;
+    bool     confidence : 1;
+    uint8_t  reserved : 6;
+    uint8_t  contact_id;
+    uint16_t x;
+    uint16_t y;
+} PACKED report_digitizer_contact_t;
+
 typedef struct {
-#ifdef DIGITIZER_SHARED_EP
+#    ifdef DIGITIZER_SHARED_EP
     uint8_t report_id;
-#endif
+#    endif
+    report_digitizer_contact_t contacts[DIGITIZER_CONTACT_COUNT];
+    uint16_t                   scan_time; // 100us units
+    uint8_t                    contact_count;
+    bool                       button : 1;
+    uint8_t                    reserved : 7;
+} PACKED report_digitizer_t;
+#else
+typedef struct {
+#    ifdef DIGITIZER_SHARED_EP
+    uint8_t report_id;
+#    endif
     bool     in_range : 1;
     bool     tip : 1;
     bool     barrel : 1;
@@ -231,6 +256,7 @@ typedef struct {
     uint16_t x;
     uint16_t y;
 } PACKED report_digitizer_t;
+#endif
 
 #if JOYSTICK_AXIS_RESOLUTION > 8
 typedef int16_t joystick_axis_t;
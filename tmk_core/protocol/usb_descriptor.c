@@ -288,12 +288,95 @@ const USB_Descriptor_HIDReport_Datatype_t PROGMEM SharedReport[] = {
 #endif
 
 #ifdef DIGITIZER_ENABLE
+#    ifdef DIGITIZER_CONTACT_COUNT
+// Finger contact, repeated for every contact of the report
+#        define DIGITIZER_CONTACT_DESCRIPTOR \
+        HID_RI_USAGE(8, 0x22),             /* Finger */ \
+        HID_RI_COLLECTION(8, 0x02),        /* Logical */ \
+            /* Tip Switch & Confidence (2 bits) */ \
+            HID_RI_USAGE(8, 0x42),         /* Tip Switch */ \
+            HID_RI_USAGE(8, 0x47),         /* Confidence */ \
+            HID_RI_LOGICAL_MINIMUM(8, 0x00), \
+            HID_RI_LOGICAL_MAXIMUM(8, 0x01), \
+            HID_RI_REPORT_COUNT(8, 0x02), \
+            HID_RI_REPORT_SIZE(8, 0x01), \
+            HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE), \
+            /* Padding (6 bits) */ \
+            HID_RI_REPORT_COUNT(8, 0x06), \
+            HID_RI_INPUT(8, HID_IOF_CONSTANT), \
+            /* Contact Identifier (1 byte) */ \
+            HID_RI_USAGE(8, 0x51),         /* Contact Identifier */ \
+            HID_RI_LOGICAL_MAXIMUM(16, 0x00FF), \
+            HID_RI_REPORT_COUNT(8, 0x01), \
+            HID_RI_REPORT_SIZE(8, 0x08), \
+            HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE), \
+            /* X/Y Position (4 bytes) */ \
+            HID_RI_USAGE_PAGE(8, 0x01),    /* Generic Desktop */ \
+            HID_RI_USAGE(8, 0x30),         /* X */ \
+            HID_RI_USAGE(8, 0x31),         /* Y */ \
+            HID_RI_LOGICAL_MAXIMUM(16, 0x7FFF), \
+            HID_RI_REPORT_COUNT(8, 0x02), \
+            HID_RI_REPORT_SIZE(8, 0x10), \
+            HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE), \
+            HID_RI_USAGE_PAGE(8, 0x0D),    /* Digitizers */ \
+        HID_RI_END_COLLECTION(0)
+
+#    endif
 #    ifndef DIGITIZER_SHARED_EP
 const USB_Descriptor_HIDReport_Datatype_t PROGMEM DigitizerReport[] = {
 #    elif !defined(SHARED_REPORT_STARTED)
 const USB_Descriptor_HIDReport_Datatype_t PROGMEM SharedReport[] = {
 #        define SHARED_REPORT_STARTED
 #    endif
+#    ifdef DIGITIZER_CONTACT_COUNT
+    HID_RI_USAGE_PAGE(8, 0x0D),            // Digitizers
+    HID_RI_USAGE(8, 0x05),                 // Touch Pad
+    HID_RI_COLLECTION(8, 0x01),            // Application
+#        ifdef DIGITIZER_SHARED_EP
+        HID_RI_REPORT_ID(8, REPORT_ID_DIGITIZER),
+#        endif
+        DIGITIZER_CONTACT_DESCRIPTOR,
+#        if DIGITIZER_CONTACT_COUNT > 1
+        DIGITIZER_CONTACT_DESCRIPTOR,
+#        endif
+#        if DIGITIZER_CONTACT_COUNT > 2
+        DIGITIZER_CONTACT_DESCRIPTOR,
+#        endif
+#        if DIGITIZER_CONTACT_COUNT > 3
+        DIGITIZER_CONTACT_DESCRIPTOR,
+#        endif
+#        if DIGITIZER_CONTACT_COUNT > 4
+        DIGITIZER_CONTACT_DESCRIPTOR,
+#        endif
+
+        // Scan Time (2 bytes)
+        HID_RI_USAGE(8, 0x56),             // Scan Time
+        HID_RI_LOGICAL_MAXIMUM(32, 0xFFFF),
+        HID_RI_REPORT_COUNT(8, 0x01),
+        HID_RI_REPORT_SIZE(8, 0x10),
+        HID_RI_UNIT(16, 0x1001),           // Seconds, SI Linear
+        HID_RI_UNIT_EXPONENT(8, 0x0C),     // -4
+        HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE),
+        HID_RI_UNIT(8, 0x00),
+        HID_RI_UNIT_EXPONENT(8, 0x00),
+
+        // Contact Count (1 byte)
+        HID_RI_USAGE(8, 0x54),             // Contact Count
+        HID_RI_LOGICAL_MAXIMUM(8, DIGITIZER_CONTACT_COUNT),
+        HID_RI_REPORT_SIZE(8, 0x08),
+        HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE),
+
+        // Button (1 bit)
+        HID_RI_USAGE_PAGE(8, 0x09),        // Button
+        HID_RI_USAGE(8, 0x01),             // Button 1
+        HID_RI_LOGICAL_MAXIMUM(8, 0x01),
+        HID_RI_REPORT_SIZE(8, 0x01),
+        HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE),
+        // Padding (7 bits)
+        HID_RI_REPORT_COUNT(8, 0x07),
+        HID_RI_INPUT(8, HID_IOF_CONSTANT),
+    HID_RI_END_COLLECTION(0),
+#    else
     HID_RI_USAGE_PAGE(8, 0x0D),            // Digitizers
     HID_RI_USAGE(8, 0x01),                 // Digitizer
     HID_RI_COLLECTION(8, 0x01),            // Application
@@ -327,6 +410,7 @@ const USB_Descriptor_HIDReport_Datatype_t PROGMEM SharedReport[] = {
             HID_RI_INPUT(8, HID_IOF_DATA | HID_IOF_VARIABLE | HID_IOF_ABSOLUTE),
         HID_RI_END_COLLECTION(0),
     HID_RI_END_COLLECTION(0),
+#    endif
 #    ifndef DIGITIZER_SHARED_EP
 };
 #    endif
@@ -292,6 +292,13 @@ enum usb_endpoints {
 #define CDC_NOTIFICATION_EPSIZE 8
 #define CDC_EPSIZE 16
 #define JOYSTICK_EPSIZE 8
-#define DIGITIZER_EPSIZE 8
+#ifdef DIGITIZER_CONTACT_COUNT
+#    define DIGITIZER_EPSIZE 64
+#    if defined(DIGITIZER_SHARED_EP) && DIGITIZER_CONTACT_COUNT > 4
+#        error "Only 4 digitizer contacts fit in the shared endpoint, reduce DIGITIZER_CONTACT_COUNT or disable SHARED_EP_ENABLE"
+#    endif
+#else
+#    define DIGITIZER_EPSIZE 8
+#endif
 
 uint16_t get_usb_descriptor(const uint16_t wValue, const uint16_t wIndex, const uint16_t wLength, const void** const DescriptorAddress);
@@ -213,8 +213,9 @@ static void send_keyboard(report_keyboard_t *report);
 static void send_nkro(report_nkro_t *report);
 static void send_mouse(report_mouse_t *report);
 static void send_extra(report_extra_t *report);
+static bool mouse_ready(void);
 
-static host_driver_t driver = {.keyboard_leds = usb_device_state_get_leds, .send_keyboard = send_keyboard, .send_nkro = send_nkro, .send_mouse = send_mouse, .send_extra = send_extra};
+static host_driver_t driver = {.keyboard_leds = usb_device_state_get_leds, .send_keyboard = send_keyboard, .send_nkro = send_nkro, .send_mouse = send_mouse, .send_extra = send_extra, .mouse_ready = mouse_ready};
 
 host_driver_t *vusb_driver(void) {
     return &driver;
@@ -250,6 +251,18 @@ static void send_mouse(report_mouse_t *report) {
 #endif
 }
 
+static bool mouse_ready(void) {
+#ifdef MOUSE_ENABLE
+#    if MOUSE_IN_EPNUM == 1
+    return usbInterruptIsReady();
+#    else
+    return usbInterruptIsReady3();
+#    endif
+#else
+    return true;
+#endif
+}
+
 static void send_extra(report_extra_t *report) {
 #ifdef EXTRAKEY_ENABLE
     send_report(SHARED_IN_EPNUM, report, sizeof(report_extra_t));
@@ -268,6 +281,18 @@ void send_digitizer(report_digitizer_t *report) {
 #endif
 }
 
+bool digitizer_ready(void) {
+#ifdef DIGITIZER_ENABLE
+#    if SHARED_IN_EPNUM == 1
+    return usbInterruptIsReady();
+#    else
+    return usbInterruptIsReady3();
+#    endif
+#else
+    return true;
+#endif
+}
+
 void send_programmable_button(report_programmable_button_t *report) {
 #ifdef PROGRAMMABLE_BUTTON_ENABLE
     send_report(SHARED_IN_EPNUM, report, sizeof(report_programmable_button_t));
@@ -381,6 +406,36 @@ void usbFunctionWriteOut(uchar *data, uchar len) {
  * Descriptors                                                      *
  *------------------------------------------------------------------*/
 
+#if defined(DIGITIZER_ENABLE) && defined(DIGITIZER_CONTACT_COUNT)
+// Finger contact, repeated for every contact of the digitizer report
+#    define DIGITIZER_CONTACT_DESCRIPTOR \
+        0x09, 0x22,             /* Usage (Finger) */ \
+        0xA1, 0x02,             /* Collection (Logical) */ \
+        0x09, 0x42,             /*   Usage (Tip Switch) */ \
+        0x09, 0x47,             /*   Usage (Confidence) */ \
+        0x15, 0x00,             /*   Logical Minimum (0) */ \
+        0x25, 0x01,             /*   Logical Maximum (1) */ \
+        0x95, 0x02,             /*   Report Count (2) */ \
+        0x75, 0x01,             /*   Report Size (1) */ \
+        0x81, 0x02,             /*   Input (Data, Variable, Absolute) */ \
+        0x95, 0x06,             /*   Report Count (6) */ \
+        0x81, 0x03,             /*   Input (Constant) */ \
+        0x09, 0x51,             /*   Usage (Contact Identifier) */ \
+        0x26, 0xFF, 0x00,       /*   Logical Maximum (255) */ \
+        0x95, 0x01,             /*   Report Count (1) */ \
+        0x75, 0x08,             /*   Report Size (8) */ \
+        0x81, 0x02,             /*   Input (Data, Variable, Absolute) */ \
+        0x05, 0x01,             /*   Usage Page (Generic Desktop) */ \
+        0x09, 0x30,             /*   Usage (X) */ \
+        0x09, 0x31,             /*   Usage (Y) */ \
+        0x26, 0xFF, 0x7F,       /*   Logical Maximum (32767) */ \
+        0x95, 0x02,             /*   Report Count (2) */ \
+        0x75, 0x10,             /*   Report Size (16) */ \
+        0x81, 0x02,             /*   Input (Data, Variable, Absolute) */ \
+        0x05, 0x0D,             /*   Usage Page (Digitizers) */ \
+        0xC0                    /* End Collection */
+#endif
+
 #ifdef KEYBOARD_SHARED_EP
 const PROGMEM uchar shared_hid_report[] = {
 #    define SHARED_REPORT_STARTED
@@ -658,7 +713,54 @@ const PROGMEM uchar shared_hid_report[] = {
     0xC0, // End Collection
 #endif
 
-#ifdef DIGITIZER_ENABLE
+#if defined(DIGITIZER_ENABLE) && defined(DIGITIZER_CONTACT_COUNT)
+    // Digitizer report descriptor
+    0x05, 0x0D,                // Usage Page (Digitizers)
+    0x09, 0x05,                // Usage (Touch Pad)
+    0xA1, 0x01,                // Collection (Application)
+    0x85, REPORT_ID_DIGITIZER, //   Report ID
+    DIGITIZER_CONTACT_DESCRIPTOR,
+#    if DIGITIZER_CONTACT_COUNT > 1
+    DIGITIZER_CONTACT_DESCRIPTOR,
+#    endif
+#    if DIGITIZER_CONTACT_COUNT > 2
+    DIGITIZER_CONTACT_DESCRIPTOR,
+#    endif
+#    if DIGITIZER_CONTACT_COUNT > 3
+    DIGITIZER_CONTACT_DESCRIPTOR,
+#    endif
+#    if DIGITIZER_CONTACT_COUNT > 4
+    DIGITIZER_CONTACT_DESCRIPTOR,
+#    endif
+
+    // Scan Time (2 bytes)
+    0x09, 0x56,                   //   Usage (Scan Time)
+    0x27, 0xFF, 0xFF, 0x00, 0x00, //   Logical Maximum (65535)
+    0x95, 0x01,                   //   Report Count (1)
+    0x75, 0x10,                   //   Report Size (16)
+    0x66, 0x01, 0x10,             //   Unit (Seconds, SI Linear)
+    0x55, 0x0C,                   //   Unit Exponent (-4)
+    0x81, 0x02,                   //   Input (Data, Variable, Absolute)
+    0x65, 0x00,                   //   Unit (None)
+    0x55, 0x00,                   //   Unit Exponent (0)
+
+    // Contact Count (1 byte)
+    0x09, 0x54,                    //   Usage (Contact Count)
+    0x25, DIGITIZER_CONTACT_COUNT, //   Logical Maximum
+    0x75, 0x08,                    //   Report Size (8)
+    0x81, 0x02,                    //   Input (Data, Variable, Absolute)
+
+    // Button (1 bit)
+    0x05, 0x09, //   Usage Page (Button)
+    0x09, 0x01, //   Usage (Button 1)
+    0x25, 0x01, //   Logical Maximum (1)
+    0x75, 0x01, //   Report Size (1)
+    0x81, 0x02, //   Input (Data, Variable, Absolute)
+    // Padding (7 bits)
+    0x95, 0x07, //   Report Count (7)
+    0x81, 0x03, //   Input (Constant)
+    0xC0,       // End Collection
+#elif defined(DIGITIZER_ENABLE)
     // Digitizer report descriptor
     0x05, 0x0D,                // Usage Page (Digitizers)
     0x09, 0x01,                // Usage (Digitizer)